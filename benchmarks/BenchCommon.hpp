@@ -0,0 +1,75 @@
+/**
+ * @file BenchCommon.hpp
+ * @brief Shared fixtures and data generators for the nnv_bench microbenchmarks
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "core/NeuralNetwork.hpp"
+#include "core/Types.hpp"
+
+namespace nnv {
+namespace bench {
+
+using T = core::Scalar;
+using Batch = std::vector<std::vector<T>>;
+
+/**
+ * @brief Generate a vector of uniform random values
+ * @param size Number of values
+ * @param seed Generator seed (fixed so runs are comparable)
+ * @param low Lower bound
+ * @param high Upper bound
+ * @return Random vector
+ */
+std::vector<T> randomVector(std::size_t size, unsigned seed, T low = T{-1}, T high = T{1});
+
+/**
+ * @brief Generate a batch of uniform random vectors
+ * @param rows Number of vectors
+ * @param cols Values per vector
+ * @param seed Generator seed
+ * @return Random batch
+ */
+Batch randomBatch(std::size_t rows, std::size_t cols, unsigned seed);
+
+/**
+ * @brief Generate one-hot targets
+ * @param rows Number of targets
+ * @param classes Number of classes
+ * @param seed Generator seed
+ * @return One-hot batch
+ */
+Batch oneHotBatch(std::size_t rows, std::size_t classes, unsigned seed);
+
+/**
+ * @brief Build a network from one of the files in examples/configs
+ * @param filename Config file name, e.g. "mnist_classifier.json"
+ * @return Network, or nullptr if the config could not be read
+ */
+std::unique_ptr<core::NeuralNetwork<T>> loadExampleNetwork(const std::string& filename);
+
+/**
+ * @brief Get the batch size declared by an example config
+ * @param filename Config file name
+ * @return Batch size (32 if the config does not set one)
+ */
+std::size_t exampleBatchSize(const std::string& filename);
+
+/**
+ * @brief Get a per-process scratch directory for generated input files
+ * @return Directory path (created on first use)
+ */
+std::filesystem::path scratchDirectory();
+
+} // namespace bench
+} // namespace nnv
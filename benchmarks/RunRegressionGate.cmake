@@ -0,0 +1,46 @@
+# Runs a subset of nnv_bench repeatedly and compares it against a baseline.
+#
+# Invoked by CTest (nnv_bench_regression, with NNV_BENCH_REGRESSION_GATE) and the
+# run_bench_regression_gate and update_bench_baseline targets:
+#   cmake -DNNV_BENCH=<nnv_bench> -DNNV_BENCH_COMPARE=<nnv_bench_compare>
+#         -DBASELINE=<baseline.json> -DRESULTS=<results.json>
+#         -DFILTER=<regex> -DREPETITIONS=<n> [-DUPDATE=ON] [-DALLOW_MISSING=ON]
+#         -P RunRegressionGate.cmake
+
+foreach(var NNV_BENCH NNV_BENCH_COMPARE BASELINE RESULTS FILTER REPETITIONS)
+    if(NOT DEFINED ${var})
+        message(FATAL_ERROR "RunRegressionGate.cmake: ${var} is not set")
+    endif()
+endforeach()
+
+# Interleaving repetitions spreads slow drifts (thermal, noisy neighbours) across all benchmarks
+execute_process(
+    COMMAND ${NNV_BENCH}
+        --benchmark_filter=${FILTER}
+        --benchmark_repetitions=${REPETITIONS}
+        --benchmark_enable_random_interleaving=true
+        --benchmark_out=${RESULTS}
+        --benchmark_out_format=json
+    RESULT_VARIABLE bench_result
+)
+if(NOT bench_result EQUAL 0)
+    message(FATAL_ERROR "nnv_bench failed (${bench_result})")
+endif()
+
+set(compare_args ${BASELINE} ${RESULTS})
+if(UPDATE)
+    list(APPEND compare_args --update)
+endif()
+if(ALLOW_MISSING)
+    list(APPEND compare_args --allow-missing)
+endif()
+
+execute_process(
+    COMMAND ${NNV_BENCH_COMPARE} ${compare_args}
+    RESULT_VARIABLE compare_result
+)
+if(compare_result EQUAL 1)
+    message(FATAL_ERROR "Performance regression against ${BASELINE}")
+elseif(NOT compare_result EQUAL 0)
+    message(FATAL_ERROR "nnv_bench_compare failed (${compare_result})")
+endif()
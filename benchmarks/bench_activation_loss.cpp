@@ -0,0 +1,167 @@
+/**
+ * @file bench_activation_loss.cpp
+ * @brief Microbenchmarks for every activation and loss function
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "BenchCommon.hpp"
+#include "core/ActivationFunctions.hpp"
+#include "core/Layer.hpp"
+#include "core/LossFunctions.hpp"
+
+namespace nnv {
+namespace bench {
+namespace {
+
+using core::ActivationType;
+using core::LossType;
+
+constexpr std::size_t kActivationWidth = 1024;
+constexpr std::size_t kLossRows = 32;
+constexpr std::size_t kLossClasses = 10;
+
+const char* activationName(ActivationType type) {
+    switch (type) {
+        case ActivationType::None:      return "none";
+        case ActivationType::ReLU:      return "relu";
+        case ActivationType::Sigmoid:   return "sigmoid";
+        case ActivationType::Tanh:      return "tanh";
+        case ActivationType::LeakyReLU: return "leakyrelu";
+        case ActivationType::ELU:       return "elu";
+        case ActivationType::Swish:     return "swish";
+        case ActivationType::GELU:      return "gelu";
+        case ActivationType::Softmax:   return "softmax";
+        default:                        return "unknown";
+    }
+}
+
+const char* lossName(LossType type) {
+    switch (type) {
+        case LossType::MeanSquaredError:   return "mse";
+        case LossType::CrossEntropy:       return "crossentropy";
+        case LossType::BinaryCrossEntropy: return "binarycrossentropy";
+        case LossType::Huber:              return "huber";
+        case LossType::FocalLoss:          return "focal";
+        default:                           return "unknown";
+    }
+}
+
+void allActivations(benchmark::internal::Benchmark* b) {
+    for (int type = static_cast<int>(ActivationType::None);
+         type <= static_cast<int>(ActivationType::Softmax); ++type) {
+        b->Arg(type);
+    }
+}
+
+void allLosses(benchmark::internal::Benchmark* b) {
+    for (int type = static_cast<int>(LossType::MeanSquaredError);
+         type <= static_cast<int>(LossType::FocalLoss); ++type) {
+        b->Arg(type);
+    }
+}
+
+// Activation as applied by the layer (bias add + function, softmax over the row)
+void BM_Activation(benchmark::State& state) {
+    const auto type = static_cast<ActivationType>(state.range(0));
+    core::Layer<T> layer(kActivationWidth, type);
+    layer.initializeWeights(kActivationWidth);
+    layer.forward(randomVector(kActivationWidth, 5));
+
+    for (auto _ : state) {
+        layer.applyActivation();
+        benchmark::DoNotOptimize(layer.getActivations().data());
+    }
+
+    state.SetLabel(activationName(type));
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kActivationWidth));
+}
+BENCHMARK(BM_Activation)->Apply(allActivations);
+
+// Activation derivative as used in backpropagation of hidden layers
+void BM_ActivationDerivative(benchmark::State& state) {
+    const auto type = static_cast<ActivationType>(state.range(0));
+    const auto derivative = core::ActivationFactory::getDerivative<T>(type);
+    const auto inputs = randomVector(kActivationWidth, 6, T{-4}, T{4});
+    std::vector<T> outputs(kActivationWidth);
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < kActivationWidth; ++i) {
+            outputs[i] = derivative(inputs[i]);
+        }
+        benchmark::DoNotOptimize(outputs.data());
+    }
+
+    state.SetLabel(activationName(type));
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kActivationWidth));
+}
+BENCHMARK(BM_ActivationDerivative)->Apply(allActivations);
+
+// Probabilities strictly inside (0, 1) so every loss stays finite
+Batch lossOutputs() {
+    Batch outputs = randomBatch(kLossRows, kLossClasses, 7);
+    for (auto& row : outputs) {
+        for (auto& value : row) {
+            value = T{0.05} + T{0.9} * value;
+        }
+    }
+    return outputs;
+}
+
+// Per-sample loss and gradient through the factory functions
+void BM_LossSample(benchmark::State& state) {
+    const auto type = static_cast<LossType>(state.range(0));
+    const auto lossFunction = core::LossFactory::getFunction<T>(type);
+    const auto gradientFunction = core::LossFactory::getGradient<T>(type);
+    const auto outputs = lossOutputs();
+    const auto targets = oneHotBatch(kLossRows, kLossClasses, 8);
+
+    for (auto _ : state) {
+        T total = T{0};
+        for (std::size_t r = 0; r < kLossRows; ++r) {
+            total += lossFunction(outputs[r], targets[r]);
+            auto gradient = gradientFunction(outputs[r], targets[r]);
+            benchmark::DoNotOptimize(gradient.data());
+        }
+        benchmark::DoNotOptimize(total);
+    }
+
+    state.SetLabel(lossName(type));
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kLossRows));
+}
+BENCHMARK(BM_LossSample)->Apply(allLosses);
+
+// Fused batched loss and gradient as used by trainBatch
+void BM_LossFusedBatch(benchmark::State& state) {
+    const auto type = static_cast<LossType>(state.range(0));
+    const auto fused = core::LossFactory::getFused<T>(type);
+
+    std::vector<T> outputs;
+    std::vector<T> targets;
+    for (const auto& row : lossOutputs()) {
+        outputs.insert(outputs.end(), row.begin(), row.end());
+    }
+    for (const auto& row : oneHotBatch(kLossRows, kLossClasses, 8)) {
+        targets.insert(targets.end(), row.begin(), row.end());
+    }
+    std::vector<T> gradients(outputs.size());
+
+    const core::ConstMatrixView<T> outputView(outputs.data(), kLossRows, kLossClasses);
+    const core::ConstMatrixView<T> targetView(targets.data(), kLossRows, kLossClasses);
+    const core::MatrixView<T> gradientView(gradients.data(), kLossRows, kLossClasses);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(fused(outputView, targetView, gradientView));
+        benchmark::ClobberMemory();
+    }
+
+    state.SetLabel(lossName(type));
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kLossRows));
+}
+BENCHMARK(BM_LossFusedBatch)->Apply(allLosses);
+
+} // namespace
+} // namespace bench
+} // namespace nnv
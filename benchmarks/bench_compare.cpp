@@ -0,0 +1,388 @@
+/**
+ * @file bench_compare.cpp
+ * @brief Compares repeated nnv_bench results against a baseline and flags regressions
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ *
+ * Usage:
+ *   nnv_bench_compare <baseline.json> <results.json> [--threshold 0.10]
+ *                     [--confidence 0.95] [--metric cpu|real] [--update]
+ *                     [--allow-missing]
+ *
+ * results.json is Google Benchmark JSON output, normally produced with
+ * --benchmark_repetitions=N. The baseline is a small reviewable file:
+ *
+ *   { "default_threshold": 0.10,
+ *     "benchmarks": { "BM_LayerForward/128": { "median_ns": 14000, "ci_low_ns": 13800,
+ *                                               "ci_high_ns": 14300, "threshold": 0.15 } } }
+ *
+ * A benchmark regresses when its median is more than `threshold` slower than
+ * the baseline median and the two median confidence intervals do not overlap.
+ *
+ * The baseline may also bound the cost of a variant relative to the reference
+ * step it is interleaved with, which holds on any machine:
+ *
+ *   "overheads": { "BM_TrainBatchActivationStats/mnist_classifier":
+ *                      { "reference": "BM_TrainBatch/mnist_classifier", "limit": 0.02 } }
+ *
+ * The variant benchmark alternates its own steps with the reference step and
+ * reports that step as the "reference_ns" counter, so each repetition yields a
+ * paired cost ratio (CPU time over reference_ns) free of run-to-run drift.
+ * The variant fails when the median ratio exceeds `limit` and its interval
+ * lies entirely above zero; a variant without paired samples counts as missing.
+ * A baseline benchmark absent from the results (renamed, removed or failed)
+ * also fails the comparison unless --allow-missing is given.
+ * With --update the baseline is rewritten from the results (thresholds kept).
+ *
+ * Exit codes: 0 no regressions, 1 regressions found, 2 usage or input error.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+namespace {
+
+using json = nlohmann::json;
+
+struct Options {
+    std::string baselinePath;
+    std::string resultsPath;
+    double threshold = 0.10;
+    double confidence = 0.95;
+    std::string metric = "cpu_time";
+    bool update = false;
+    bool allowMissing = false;
+};
+
+struct Summary {
+    std::size_t samples = 0;
+    double median = 0.0;
+    double ciLow = 0.0;
+    double ciHigh = 0.0;
+    double coverage = 0.0;      ///< Actual confidence of [ciLow, ciHigh]
+};
+
+double toNanoseconds(double value, const std::string& unit) {
+    if (unit == "us") return value * 1e3;
+    if (unit == "ms") return value * 1e6;
+    if (unit == "s")  return value * 1e9;
+    return value;
+}
+
+// P(X <= k) for X ~ Binomial(n, 1/2)
+double binomialHalfCdf(std::size_t k, std::size_t n) {
+    double sum = 0.0;
+    for (std::size_t i = 0; i <= k; ++i) {
+        sum += std::exp(std::lgamma(n + 1.0) - std::lgamma(i + 1.0) - std::lgamma(n - i + 1.0)
+                        - static_cast<double>(n) * std::log(2.0));
+    }
+    return sum;
+}
+
+/**
+ * Distribution-free median interval: [x_(k), x_(n-1-k)] covers the median with
+ * probability 1 - 2 P(Binomial(n, 1/2) <= k). The largest k that still reaches
+ * the requested confidence gives the narrowest interval; with few samples the
+ * interval is [min, max] (about 94% for five samples).
+ */
+Summary summarize(std::vector<double> values, double confidence) {
+    Summary summary;
+    summary.samples = values.size();
+    if (values.empty()) {
+        return summary;
+    }
+
+    std::sort(values.begin(), values.end());
+    const std::size_t n = values.size();
+    summary.median = n % 2 == 1 ? values[n / 2] : 0.5 * (values[n / 2 - 1] + values[n / 2]);
+
+    std::size_t k = 0;
+    summary.coverage = n > 1 ? 1.0 - 2.0 * binomialHalfCdf(0, n) : 0.0;
+    while (k + 1 < n / 2) {
+        const double coverage = 1.0 - 2.0 * binomialHalfCdf(k + 1, n);
+        if (coverage < confidence) {
+            break;
+        }
+        ++k;
+        summary.coverage = coverage;
+    }
+
+    summary.ciLow = values[k];
+    summary.ciHigh = values[n - 1 - k];
+    return summary;
+}
+
+bool readJson(const std::string& path, json& out) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        std::cerr << "error: cannot open " << path << "\n";
+        return false;
+    }
+    out = json::parse(file, nullptr, false);
+    if (out.is_discarded()) {
+        std::cerr << "error: " << path << " is not valid JSON\n";
+        return false;
+    }
+    return true;
+}
+
+// Group per-repetition samples by benchmark name, skipping aggregate rows
+std::map<std::string, std::vector<double>> collectSamples(const json& results, const std::string& metric) {
+    std::map<std::string, std::vector<double>> samples;
+    if (!results.contains("benchmarks")) {
+        return samples;
+    }
+
+    for (const auto& entry : results["benchmarks"]) {
+        if (entry.value("run_type", "iteration") != "iteration" || entry.contains("error_occurred")) {
+            continue;
+        }
+        const std::string name = entry.value("run_name", entry.value("name", ""));
+        if (name.empty() || !entry.contains(metric)) {
+            continue;
+        }
+        samples[name].push_back(toNanoseconds(entry[metric].get<double>(), entry.value("time_unit", "ns")));
+    }
+    return samples;
+}
+
+// Per-repetition cost of each variant over its interleaved reference step
+std::map<std::string, std::vector<double>> collectPairedCosts(const json& results) {
+    std::map<std::string, std::vector<double>> costs;
+    if (!results.contains("benchmarks")) {
+        return costs;
+    }
+
+    for (const auto& entry : results["benchmarks"]) {
+        if (entry.value("run_type", "iteration") != "iteration" || entry.contains("error_occurred")
+            || !entry.contains("cpu_time") || !entry.contains("reference_ns")) {
+            continue;
+        }
+        const std::string name = entry.value("run_name", entry.value("name", ""));
+        const double reference = entry["reference_ns"].get<double>();
+        if (name.empty() || reference <= 0.0) {
+            continue;
+        }
+        const double variant = toNanoseconds(entry["cpu_time"].get<double>(), entry.value("time_unit", "ns"));
+        costs[name].push_back(variant / reference - 1.0);
+    }
+    return costs;
+}
+
+bool parseArguments(int argc, char** argv, Options& options) {
+    std::vector<std::string> positional;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+
+        if (arg == "--threshold" && hasValue) {
+            options.threshold = std::atof(argv[++i]);
+        } else if (arg == "--confidence" && hasValue) {
+            options.confidence = std::atof(argv[++i]);
+        } else if (arg == "--metric" && hasValue) {
+            const std::string metric = argv[++i];
+            if (metric != "cpu" && metric != "real") {
+                return false;
+            }
+            options.metric = metric + "_time";
+        } else if (arg == "--update") {
+            options.update = true;
+        } else if (arg == "--allow-missing") {
+            options.allowMissing = true;
+        } else if (!arg.empty() && arg[0] == '-') {
+            return false;
+        } else {
+            positional.push_back(arg);
+        }
+    }
+
+    if (positional.size() != 2 || options.confidence <= 0.0 || options.confidence >= 1.0) {
+        return false;
+    }
+    options.baselinePath = positional[0];
+    options.resultsPath = positional[1];
+    return true;
+}
+
+int updateBaseline(const Options& options, const json& results,
+                   const std::map<std::string, std::vector<double>>& samples) {
+    // Keep hand-tuned thresholds from the existing baseline, if any
+    json baseline = json::object();
+    {
+        std::ifstream existing(options.baselinePath);
+        if (existing.is_open()) {
+            baseline = json::parse(existing, nullptr, false);
+            if (baseline.is_discarded()) {
+                baseline = json::object();
+            }
+        }
+    }
+    if (!baseline.contains("default_threshold")) {
+        baseline["default_threshold"] = options.threshold;
+    }
+
+    json benchmarks = json::object();
+    for (const auto& [name, values] : samples) {
+        const Summary summary = summarize(values, options.confidence);
+        const auto round = [](double nanos) { return std::round(nanos * 10.0) / 10.0; };
+        json entry = {
+            {"median_ns", round(summary.median)},
+            {"ci_low_ns", round(summary.ciLow)},
+            {"ci_high_ns", round(summary.ciHigh)},
+            {"samples", summary.samples}
+        };
+        if (baseline.contains("benchmarks") && baseline["benchmarks"].contains(name)
+            && baseline["benchmarks"][name].contains("threshold")) {
+            entry["threshold"] = baseline["benchmarks"][name]["threshold"];
+        }
+        benchmarks[name] = entry;
+    }
+    baseline["benchmarks"] = benchmarks;
+
+    // Record where the numbers came from; comparisons across machines are meaningless
+    if (results.contains("context")) {
+        const json& context = results["context"];
+        baseline["context"] = json::object();
+        for (const char* key : {"host_name", "num_cpus", "mhz_per_cpu", "library_build_type", "date"}) {
+            if (context.contains(key)) {
+                baseline["context"][key] = context[key];
+            }
+        }
+    }
+
+    std::ofstream file(options.baselinePath);
+    file << baseline.dump(4) << "\n";
+    if (!file.good()) {
+        std::cerr << "error: cannot write " << options.baselinePath << "\n";
+        return 2;
+    }
+
+    std::cout << "Wrote " << benchmarks.size() << " benchmarks to " << options.baselinePath << "\n";
+    return 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseArguments(argc, argv, options)) {
+        std::cerr << "usage: " << argv[0] << " <baseline.json> <results.json> [--threshold 0.10]"
+                  << " [--confidence 0.95] [--metric cpu|real] [--update] [--allow-missing]\n";
+        return 2;
+    }
+
+    json results;
+    if (!readJson(options.resultsPath, results)) {
+        return 2;
+    }
+
+    const auto samples = collectSamples(results, options.metric);
+    if (samples.empty()) {
+        std::cerr << "error: no benchmark samples in " << options.resultsPath << "\n";
+        return 2;
+    }
+
+    if (options.update) {
+        return updateBaseline(options, results, samples);
+    }
+
+    json baseline;
+    if (!readJson(options.baselinePath, baseline)) {
+        return 2;
+    }
+
+    const double defaultThreshold = baseline.value("default_threshold", options.threshold);
+    const json& expected = baseline.contains("benchmarks") ? baseline["benchmarks"] : json::object();
+
+    std::size_t regressions = 0;
+    std::size_t compared = 0;
+
+    std::printf("%-44s %12s %12s %8s %6s  %s\n", "benchmark", "base ns", "median ns", "change", "limit", "status");
+    for (const auto& [name, values] : samples) {
+        if (!expected.contains(name)) {
+            std::printf("%-44s %12s %12s %8s %6s  %s\n", name.c_str(), "-", "-", "-", "-", "no baseline");
+            continue;
+        }
+
+        const json& base = expected[name];
+        const double baseMedian = base.value("median_ns", 0.0);
+        const double baseHigh = base.value("ci_high_ns", baseMedian);
+        const double baseLow = base.value("ci_low_ns", baseMedian);
+        const double threshold = base.value("threshold", defaultThreshold);
+        if (baseMedian <= 0.0) {
+            continue;
+        }
+
+        const Summary current = summarize(values, options.confidence);
+        const double change = current.median / baseMedian - 1.0;
+
+        // Slower beyond the threshold and not explainable by run-to-run noise
+        const char* status = "ok";
+        if (change > threshold && current.ciLow > baseHigh) {
+            status = "REGRESSION";
+            ++regressions;
+        } else if (change < -threshold && current.ciHigh < baseLow) {
+            status = "improved";
+        } else if (change > threshold) {
+            status = "noisy";
+        }
+
+        std::printf("%-44s %12.1f %12.1f %+7.1f%% %5.0f%%  %s [%.1f, %.1f] n=%zu, %.0f%% CI\n",
+                    name.c_str(), baseMedian, current.median, 100.0 * change, 100.0 * threshold,
+                    status, current.ciLow, current.ciHigh, current.samples, 100.0 * current.coverage);
+        ++compared;
+    }
+
+    // A benchmark that silently disappears would drop out of the gate
+    std::size_t missing = 0;
+    for (const auto& item : expected.items()) {
+        if (samples.find(item.key()) == samples.end()) {
+            std::printf("%-44s %s\n", item.key().c_str(),
+                        options.allowMissing ? "missing from results" : "MISSING from results");
+            ++missing;
+        }
+    }
+
+    const json& overheads = baseline.contains("overheads") ? baseline["overheads"] : json::object();
+    const auto pairedCosts = collectPairedCosts(results);
+    if (!overheads.empty()) {
+        std::printf("\n%-44s %8s %6s  %s\n", "variant", "cost", "limit", "status");
+    }
+    for (const auto& item : overheads.items()) {
+        const std::string reference = item.value().value("reference", "");
+        const double limit = item.value().value("limit", 0.0);
+        const auto costs = pairedCosts.find(item.key());
+        if (costs == pairedCosts.end()) {
+            std::printf("%-44s %s\n", item.key().c_str(),
+                        options.allowMissing ? "no paired samples in results" : "MISSING paired samples from results");
+            ++missing;
+            continue;
+        }
+
+        // Over budget and reliably slower than the reference step
+        const Summary cost = summarize(costs->second, options.confidence);
+        const char* status = "ok";
+        if (cost.median > limit && cost.ciLow > 0.0) {
+            status = "OVERHEAD";
+            ++regressions;
+        } else if (cost.median > limit) {
+            status = "noisy";
+        }
+
+        std::printf("%-44s %+7.2f%% %5.1f%%  %s vs %s [%+.2f%%, %+.2f%%] n=%zu, %.0f%% CI\n",
+                    item.key().c_str(), 100.0 * cost.median, 100.0 * limit, status, reference.c_str(),
+                    100.0 * cost.ciLow, 100.0 * cost.ciHigh, cost.samples, 100.0 * cost.coverage);
+    }
+
+    std::printf("\n%zu compared, %zu regressions, %zu missing\n", compared, regressions, missing);
+    return regressions > 0 || (missing > 0 && !options.allowMissing) ? 1 : 0;
+}
@@ -0,0 +1,117 @@
+/**
+ * @file bench_data_loader.cpp
+ * @brief DataLoader benchmarks on generated CSV and MNIST files
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <fstream>
+
+#include "BenchCommon.hpp"
+#include "utils/DataLoader.hpp"
+
+namespace nnv {
+namespace bench {
+namespace {
+
+constexpr std::size_t kCsvFeatures = 16;
+constexpr std::size_t kMnistSide = 28;
+
+std::string csvFile(std::size_t rows) {
+    const auto path = scratchDirectory() / ("data_" + std::to_string(rows) + ".csv");
+    if (std::filesystem::exists(path)) {
+        return path.string();
+    }
+
+    std::ofstream file(path);
+    for (std::size_t c = 0; c < kCsvFeatures; ++c) {
+        file << "x" << c << ",";
+    }
+    file << "label\n";
+
+    const auto values = randomVector(rows * kCsvFeatures, 11);
+    for (std::size_t r = 0; r < rows; ++r) {
+        for (std::size_t c = 0; c < kCsvFeatures; ++c) {
+            file << values[r * kCsvFeatures + c] << ",";
+        }
+        file << "class" << (r % 3) << "\n";
+    }
+    return path.string();
+}
+
+void writeBigEndian(std::ofstream& file, std::uint32_t value) {
+    const char bytes[4] = {
+        static_cast<char>(value >> 24), static_cast<char>(value >> 16),
+        static_cast<char>(value >> 8), static_cast<char>(value)
+    };
+    file.write(bytes, sizeof(bytes));
+}
+
+// IDX files in the same layout as the published MNIST set
+std::pair<std::string, std::string> mnistFiles(std::size_t images) {
+    const auto base = scratchDirectory() / ("mnist_" + std::to_string(images));
+    const std::string imagesPath = base.string() + "-images.idx3-ubyte";
+    const std::string labelsPath = base.string() + "-labels.idx1-ubyte";
+    if (std::filesystem::exists(imagesPath) && std::filesystem::exists(labelsPath)) {
+        return {imagesPath, labelsPath};
+    }
+
+    std::mt19937 gen(12);
+    std::uniform_int_distribution<int> pixel(0, 255);
+
+    std::ofstream imageFile(imagesPath, std::ios::binary);
+    writeBigEndian(imageFile, 0x803);
+    writeBigEndian(imageFile, static_cast<std::uint32_t>(images));
+    writeBigEndian(imageFile, kMnistSide);
+    writeBigEndian(imageFile, kMnistSide);
+    for (std::size_t i = 0; i < images * kMnistSide * kMnistSide; ++i) {
+        imageFile.put(static_cast<char>(pixel(gen)));
+    }
+
+    std::ofstream labelFile(labelsPath, std::ios::binary);
+    writeBigEndian(labelFile, 0x801);
+    writeBigEndian(labelFile, static_cast<std::uint32_t>(images));
+    for (std::size_t i = 0; i < images; ++i) {
+        labelFile.put(static_cast<char>(i % 10));
+    }
+
+    return {imagesPath, labelsPath};
+}
+
+void BM_LoadCSV(benchmark::State& state) {
+    const auto rows = static_cast<std::size_t>(state.range(0));
+    const std::string path = csvFile(rows);
+    utils::DataLoader<T> loader;
+
+    for (auto _ : state) {
+        auto dataset = loader.loadCSV(path);
+        benchmark::DoNotOptimize(dataset.inputs.data());
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * rows));
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * std::filesystem::file_size(path)));
+}
+BENCHMARK(BM_LoadCSV)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+void BM_LoadMNIST(benchmark::State& state) {
+    const auto images = static_cast<std::size_t>(state.range(0));
+    const auto files = mnistFiles(images);
+    utils::DataLoader<T> loader;
+
+    for (auto _ : state) {
+        auto dataset = loader.loadMNIST(files.first, files.second);
+        benchmark::DoNotOptimize(dataset.inputs.data());
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * images));
+    state.SetBytesProcessed(static_cast<std::int64_t>(
+        state.iterations() * (std::filesystem::file_size(files.first) + std::filesystem::file_size(files.second))));
+}
+BENCHMARK(BM_LoadMNIST)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+} // namespace
+} // namespace bench
+} // namespace nnv
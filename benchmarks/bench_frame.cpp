@@ -0,0 +1,109 @@
+/**
+ * @file bench_frame.cpp
+ * @brief Headless frame-generation benchmarks for the visualizer pipeline
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+
+#include "BenchCommon.hpp"
+#include "graphics/FrameBuilder.hpp"
+
+namespace nnv {
+namespace bench {
+namespace {
+
+using graphics::FrameBuilder;
+using graphics::FrameStage;
+
+constexpr float kScreenWidth = 1920.0f;
+constexpr float kScreenHeight = 1080.0f;
+constexpr double kFrameBudgetNanos = 1e9 / 60.0;
+
+// Layers at most 128 wide keep the weight matrices of 100k-neuron networks in memory
+std::unique_ptr<core::NeuralNetwork<T>> syntheticNetwork(std::size_t neurons) {
+    const std::size_t width = std::max<std::size_t>(1, std::min<std::size_t>(128, neurons / 2));
+    const std::size_t layers = std::max<std::size_t>(2, (neurons + width - 1) / width);
+
+    auto network = std::make_unique<core::NeuralNetwork<T>>("Synthetic");
+    for (std::size_t l = 0; l < layers; ++l) {
+        core::LayerConfig config;
+        config.size = width;
+        config.activation = l == 0 ? core::ActivationType::None : core::ActivationType::Sigmoid;
+        network->addLayer(config);
+    }
+    network->initializeWeights();
+
+    // Non-trivial activations so the color stage sees the full value range
+    network->predict(randomVector(width, 13, T{0}, T{1}));
+    return network;
+}
+
+// Viewport that shows the whole network (fit) or 1:1 pixels around its middle
+graphics::Viewport makeViewport(const graphics::RenderConfig& config,
+                                const core::NeuralNetwork<T>& network, bool fit) {
+    const std::size_t layers = network.getLayerCount();
+    const std::size_t width = network.getLayer(0).getSize();
+    const float worldWidth = static_cast<float>(layers - 1) * config.layer.spacing + 2.0f * config.neuron.radius;
+    const float worldHeight = static_cast<float>(width - 1) * config.layer.neuronSpacing + 2.0f * config.neuron.radius;
+
+    graphics::Viewport viewport;
+    viewport.bounds = sf::FloatRect(0.0f, 0.0f, kScreenWidth, kScreenHeight);
+    viewport.center = sf::Vector2f(config.networkPosition.x + 0.5f * static_cast<float>(layers - 1) * config.layer.spacing,
+                                   config.networkPosition.y);
+    viewport.zoom = fit ? std::min(kScreenWidth / worldWidth, kScreenHeight / worldHeight) : 1.0f;
+    return viewport;
+}
+
+void BM_FrameBuild(benchmark::State& state, bool fit) {
+    const auto neurons = static_cast<std::size_t>(state.range(0));
+    const auto network = syntheticNetwork(neurons);
+    const graphics::RenderConfig config;
+    const auto viewport = makeViewport(config, *network, fit);
+
+    FrameBuilder builder(config);
+    std::array<double, static_cast<std::size_t>(FrameStage::Count)> stageNanos{};
+    double totalNanos = 0.0;
+
+    for (auto _ : state) {
+        const auto& geometry = builder.build(*network, viewport);
+        benchmark::DoNotOptimize(geometry.neuronTriangles.data());
+
+        for (std::size_t s = 0; s < stageNanos.size(); ++s) {
+            stageNanos[s] += static_cast<double>(geometry.stats.stageNanos[s]);
+        }
+        totalNanos += static_cast<double>(geometry.stats.totalNanos());
+    }
+
+    const double iterations = static_cast<double>(state.iterations());
+    for (std::size_t s = 0; s < stageNanos.size(); ++s) {
+        const std::string name = std::string(graphics::getFrameStageName(static_cast<FrameStage>(s))) + "_us";
+        state.counters[name] = stageNanos[s] / iterations / 1000.0;
+    }
+
+    const auto& stats = builder.getGeometry().stats;
+    state.counters["neurons"] = static_cast<double>(stats.neuronsTotal);
+    state.counters["neurons_visible"] = static_cast<double>(stats.neuronsVisible);
+    state.counters["connections_visible"] = static_cast<double>(stats.connectionsVisible);
+    state.counters["connections_drawn"] = static_cast<double>(stats.connectionsDrawn);
+    state.counters["vertices"] = static_cast<double>(builder.getGeometry().vertexCount());
+    // Share of a 60 FPS frame spent building geometry; above 100 the size is not interactive
+    state.counters["frame_budget_pct"] = 100.0 * totalNanos / iterations / kFrameBudgetNanos;
+}
+
+void networkSizes(benchmark::internal::Benchmark* b) {
+    for (int neurons : {10, 100, 1000, 10000, 100000}) {
+        b->Arg(neurons);
+    }
+    b->Unit(benchmark::kMicrosecond);
+}
+
+BENCHMARK_CAPTURE(BM_FrameBuild, fit, true)->Apply(networkSizes);
+BENCHMARK_CAPTURE(BM_FrameBuild, zoomed, false)->Apply(networkSizes);
+
+} // namespace
+} // namespace bench
+} // namespace nnv
@@ -0,0 +1,96 @@
+/**
+ * @file bench_layer.cpp
+ * @brief Microbenchmarks for Layer forward, gradient and update kernels
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "BenchCommon.hpp"
+#include "core/Layer.hpp"
+
+namespace nnv {
+namespace bench {
+namespace {
+
+using core::ActivationType;
+using core::Layer;
+
+// Square layers (fanIn == size) from the XOR hidden layer up to MNIST width
+void layerSizes(benchmark::internal::Benchmark* b) {
+    for (int size : {4, 16, 64, 128, 256, 784}) {
+        b->Arg(size);
+    }
+}
+
+void setFlopCounters(benchmark::State& state, double flopsPerIteration) {
+    state.counters["FLOPS"] = benchmark::Counter(
+        flopsPerIteration * static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+}
+
+void BM_LayerForward(benchmark::State& state) {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    Layer<T> layer(size, ActivationType::ReLU);
+    layer.initializeWeights(size);
+    const auto inputs = randomVector(size, 1);
+
+    for (auto _ : state) {
+        layer.forward(inputs);
+        layer.applyActivation();
+        benchmark::DoNotOptimize(layer.getActivations().data());
+    }
+
+    setFlopCounters(state, 2.0 * static_cast<double>(size * size));
+}
+BENCHMARK(BM_LayerForward)->Apply(layerSizes);
+
+void BM_LayerComputeGradients(benchmark::State& state) {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    Layer<T> layer(size, ActivationType::ReLU);
+    Layer<T> next(size, ActivationType::ReLU);
+    layer.initializeWeights(size);
+    next.initializeWeights(size);
+
+    layer.forward(randomVector(size, 2));
+    layer.applyActivation();
+    const auto deltas = randomVector(size, 3);
+    for (std::size_t i = 0; i < size; ++i) {
+        next.getNeuron(i).setDelta(deltas[i]);
+    }
+
+    for (auto _ : state) {
+        layer.computeGradients(next);
+        benchmark::DoNotOptimize(layer.getDeltas().data());
+    }
+
+    setFlopCounters(state, 2.0 * static_cast<double>(size * size));
+}
+BENCHMARK(BM_LayerComputeGradients)->Apply(layerSizes);
+
+void BM_LayerUpdateWeights(benchmark::State& state) {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    Layer<T> layer(size, ActivationType::ReLU);
+    Layer<T> next(size, ActivationType::ReLU);
+    layer.initializeWeights(size);
+    next.initializeWeights(size);
+
+    const auto prevActivations = randomVector(size, 4);
+    layer.forward(prevActivations);
+    layer.applyActivation();
+    next.getNeuron(0).setDelta(T{0.5});
+    layer.computeGradients(next);
+
+    for (auto _ : state) {
+        // Tiny step so repeated updates keep the weights in range
+        layer.updateWeights(T{1e-6}, prevActivations);
+        benchmark::ClobberMemory();
+    }
+
+    setFlopCounters(state, 2.0 * static_cast<double>(size * size + size));
+}
+BENCHMARK(BM_LayerUpdateWeights)->Apply(layerSizes);
+
+} // namespace
+} // namespace bench
+} // namespace nnv
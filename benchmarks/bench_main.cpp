@@ -0,0 +1,116 @@
+/**
+ * @file bench_main.cpp
+ * @brief Entry point and shared helpers for nnv_bench
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <fstream>
+#include <nlohmann/json.hpp>
+#include <unistd.h>
+
+#include "BenchCommon.hpp"
+#include "utils/ConfigManager.hpp"
+#include "utils/Logger.hpp"
+
+#ifndef NNV_EXAMPLE_CONFIG_DIR
+#define NNV_EXAMPLE_CONFIG_DIR "examples/configs"
+#endif
+
+namespace nnv {
+namespace bench {
+
+std::vector<T> randomVector(std::size_t size, unsigned seed, T low, T high) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<T> dist(low, high);
+
+    std::vector<T> values(size);
+    for (auto& value : values) {
+        value = dist(gen);
+    }
+    return values;
+}
+
+Batch randomBatch(std::size_t rows, std::size_t cols, unsigned seed) {
+    Batch batch;
+    batch.reserve(rows);
+    for (std::size_t r = 0; r < rows; ++r) {
+        batch.push_back(randomVector(cols, seed + static_cast<unsigned>(r), T{0}, T{1}));
+    }
+    return batch;
+}
+
+Batch oneHotBatch(std::size_t rows, std::size_t classes, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<std::size_t> dist(0, classes - 1);
+
+    Batch batch(rows, std::vector<T>(classes, T{0}));
+    for (auto& row : batch) {
+        row[dist(gen)] = T{1};
+    }
+    return batch;
+}
+
+namespace {
+
+nlohmann::json readExampleConfig(const std::string& filename) {
+    std::ifstream file(std::string(NNV_EXAMPLE_CONFIG_DIR) + "/" + filename);
+    if (!file.is_open()) {
+        return {};
+    }
+    return nlohmann::json::parse(file, nullptr, false);
+}
+
+} // namespace
+
+std::unique_ptr<core::NeuralNetwork<T>> loadExampleNetwork(const std::string& filename) {
+    const auto json = readExampleConfig(filename);
+    if (!json.is_object()) {
+        return nullptr;
+    }
+
+    utils::ConfigManager configManager;
+    auto network = std::make_unique<core::NeuralNetwork<T>>(configManager.loadNetworkConfig(json));
+    network->initializeWeights();
+    return network;
+}
+
+std::size_t exampleBatchSize(const std::string& filename) {
+    const auto json = readExampleConfig(filename);
+    if (json.is_object() && json.contains("training") && json["training"].contains("batch_size")) {
+        return json["training"]["batch_size"].get<std::size_t>();
+    }
+    return 32;
+}
+
+std::filesystem::path scratchDirectory() {
+    static const std::filesystem::path directory = []() {
+        auto path = std::filesystem::temp_directory_path() / ("nnv_bench_" + std::to_string(::getpid()));
+        std::filesystem::create_directories(path);
+        return path;
+    }();
+    return directory;
+}
+
+} // namespace bench
+} // namespace nnv
+
+int main(int argc, char** argv) {
+    // Loader and serializer info messages would interleave with the report
+    nnv::utils::Logger::initialize("", nnv::utils::LogLevel::Error);
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    std::error_code ec;
+    std::filesystem::remove_all(nnv::bench::scratchDirectory(), ec);
+
+    nnv::utils::Logger::shutdown();
+    return 0;
+}
@@ -0,0 +1,125 @@
+/**
+ * @file bench_network.cpp
+ * @brief End-to-end trainBatch/predictBatch benchmarks on the example configs
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <ctime>
+
+#include "BenchCommon.hpp"
+
+namespace nnv {
+namespace bench {
+namespace {
+
+struct ExampleWorkload {
+    std::unique_ptr<core::NeuralNetwork<T>> network;
+    Batch inputs;
+    Batch targets;
+};
+
+// One batch of the config's own batch size; targets are one-hot over the outputs
+bool makeWorkload(benchmark::State& state, const std::string& config, ExampleWorkload& workload) {
+    workload.network = loadExampleNetwork(config);
+    if (!workload.network || workload.network->getLayerCount() < 2) {
+        state.SkipWithError(("Failed to load examples/configs/" + config).c_str());
+        return false;
+    }
+
+    const auto& network = *workload.network;
+    const std::size_t batchSize = exampleBatchSize(config);
+    const std::size_t inputSize = network.getLayer(0).getSize();
+    const std::size_t outputSize = network.getLayer(network.getLayerCount() - 1).getSize();
+
+    workload.inputs = randomBatch(batchSize, inputSize, 9);
+    workload.targets = outputSize > 1 ? oneHotBatch(batchSize, outputSize, 10)
+                                      : randomBatch(batchSize, outputSize, 10);
+    return true;
+}
+
+void BM_TrainBatch(benchmark::State& state, const std::string& config) {
+    ExampleWorkload workload;
+    if (!makeWorkload(state, config, workload)) {
+        return;
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(workload.network->trainBatch(workload.inputs, workload.targets));
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * workload.inputs.size()));
+}
+BENCHMARK_CAPTURE(BM_TrainBatch, simple_xor, std::string("simple_xor.json"));
+BENCHMARK_CAPTURE(BM_TrainBatch, mnist_classifier, std::string("mnist_classifier.json"));
+
+// Times an instrumented trainBatch step against a plain copy of the same
+// network, alternating one step of each so both see the same machine state;
+// separate benchmarks drift apart by more than the budgets being checked.
+// Only the instrumented step is timed by the benchmark; the plain step's
+// process CPU time is reported as "reference_ns", and nnv_bench_compare holds
+// the per-repetition ratio to the limit under "overheads" in the baseline.
+template<typename Instrument>
+void runPairedTrainBatch(benchmark::State& state, const std::string& config, Instrument instrument) {
+    ExampleWorkload plain;
+    ExampleWorkload instrumented;
+    if (!makeWorkload(state, config, plain) || !makeWorkload(state, config, instrumented)) {
+        return;
+    }
+    instrument(*instrumented.network);
+
+    std::clock_t referenceTime = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        const std::clock_t start = std::clock();
+        benchmark::DoNotOptimize(plain.network->trainBatch(plain.inputs, plain.targets));
+        referenceTime += std::clock() - start;
+        state.ResumeTiming();
+
+        benchmark::DoNotOptimize(instrumented.network->trainBatch(instrumented.inputs, instrumented.targets));
+    }
+
+    state.counters["reference_ns"] = benchmark::Counter(
+        1e9 * static_cast<double>(referenceTime) / CLOCKS_PER_SEC, benchmark::Counter::kAvgIterations);
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * instrumented.inputs.size()));
+}
+
+// Activation statistics at the default sample interval, held to 2%
+void BM_TrainBatchActivationStats(benchmark::State& state, const std::string& config) {
+    runPairedTrainBatch(state, config, [](core::NeuralNetwork<T>& network) {
+        network.enableActivationStats();
+    });
+}
+BENCHMARK_CAPTURE(BM_TrainBatchActivationStats, mnist_classifier, std::string("mnist_classifier.json"));
+
+// PerfStats timing every phase and layer; each timed region costs a clock read
+// pair, so simple_xor, with almost no work per layer, shows that fixed cost
+void BM_TrainBatchPerfStats(benchmark::State& state, const std::string& config) {
+    runPairedTrainBatch(state, config, [](core::NeuralNetwork<T>& network) {
+        network.enablePerfStats();
+    });
+}
+BENCHMARK_CAPTURE(BM_TrainBatchPerfStats, simple_xor, std::string("simple_xor.json"));
+BENCHMARK_CAPTURE(BM_TrainBatchPerfStats, mnist_classifier, std::string("mnist_classifier.json"));
+
+void BM_PredictBatch(benchmark::State& state, const std::string& config) {
+    ExampleWorkload workload;
+    if (!makeWorkload(state, config, workload)) {
+        return;
+    }
+
+    for (auto _ : state) {
+        auto outputs = workload.network->predictBatch(workload.inputs);
+        benchmark::DoNotOptimize(outputs.data());
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * workload.inputs.size()));
+}
+BENCHMARK_CAPTURE(BM_PredictBatch, simple_xor, std::string("simple_xor.json"));
+BENCHMARK_CAPTURE(BM_PredictBatch, mnist_classifier, std::string("mnist_classifier.json"));
+
+} // namespace
+} // namespace bench
+} // namespace nnv
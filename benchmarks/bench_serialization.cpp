@@ -0,0 +1,77 @@
+/**
+ * @file bench_serialization.cpp
+ * @brief JSON save/load benchmarks for networks
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "BenchCommon.hpp"
+
+namespace nnv {
+namespace bench {
+namespace {
+
+void BM_NetworkToJson(benchmark::State& state, const std::string& config) {
+    auto network = loadExampleNetwork(config);
+    if (!network) {
+        state.SkipWithError(("Failed to load examples/configs/" + config).c_str());
+        return;
+    }
+
+    for (auto _ : state) {
+        auto json = network->toJson();
+        benchmark::DoNotOptimize(json);
+    }
+}
+BENCHMARK_CAPTURE(BM_NetworkToJson, mnist_classifier, std::string("mnist_classifier.json"))
+    ->Unit(benchmark::kMillisecond);
+
+void BM_NetworkFromJson(benchmark::State& state, const std::string& config) {
+    auto network = loadExampleNetwork(config);
+    if (!network) {
+        state.SkipWithError(("Failed to load examples/configs/" + config).c_str());
+        return;
+    }
+
+    const auto json = network->toJson();
+    core::NeuralNetwork<T> restored;
+
+    for (auto _ : state) {
+        restored.fromJson(json);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK_CAPTURE(BM_NetworkFromJson, mnist_classifier, std::string("mnist_classifier.json"))
+    ->Unit(benchmark::kMillisecond);
+
+// Full file round trip including JSON text formatting and parsing
+void BM_NetworkSaveLoadFile(benchmark::State& state, const std::string& config) {
+    auto network = loadExampleNetwork(config);
+    if (!network) {
+        state.SkipWithError(("Failed to load examples/configs/" + config).c_str());
+        return;
+    }
+
+    const std::string path = (scratchDirectory() / "network.json").string();
+    core::NeuralNetwork<T> restored;
+
+    for (auto _ : state) {
+        if (!network->saveToFile(path) || !restored.loadFromFile(path)) {
+            state.SkipWithError("Network save/load failed");
+            break;
+        }
+    }
+
+    if (std::filesystem::exists(path)) {
+        state.SetBytesProcessed(static_cast<std::int64_t>(
+            2 * state.iterations() * std::filesystem::file_size(path)));
+    }
+}
+BENCHMARK_CAPTURE(BM_NetworkSaveLoadFile, mnist_classifier, std::string("mnist_classifier.json"))
+    ->Unit(benchmark::kMillisecond);
+
+} // namespace
+} // namespace bench
+} // namespace nnv
@@ -222,30 +222,119 @@ inline T geluDerivative(T x) {
 }
 
 /**
- * @brief Softmax activation function for a vector
+ * @brief Softmax activation function over a buffer
  * @tparam T Numeric type
- * @param x Input vector
- * @return Softmax output vector
+ * @param x Input values
+ * @param out Output values (may alias x)
+ * @param n Number of values
  */
 template<typename T>
-std::vector<T> softmax(const std::vector<T>& x) {
-    std::vector<T> result(x.size());
+void softmax(const T* x, T* out, std::size_t n) {
+    if (n == 0) {
+        return;
+    }
     
     // Find maximum for numerical stability
-    T max_val = *std::max_element(x.begin(), x.end());
+    T max_val = *std::max_element(x, x + n);
     
     // Compute exponentials and sum
     T sum = T{0};
-    for (std::size_t i = 0; i < x.size(); ++i) {
-        result[i] = std::exp(x[i] - max_val);
-        sum += result[i];
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = std::exp(x[i] - max_val);
+        sum += out[i];
     }
     
     // Normalize
-    for (std::size_t i = 0; i < x.size(); ++i) {
-        result[i] /= sum;
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] /= sum;
     }
-    
+}
+
+/**
+ * @brief Softmax activation function for a vector
+ * @tparam T Numeric type
+ * @param x Input vector
+ * @return Softmax output vector
+ */
+template<typename T>
+std::vector<T> softmax(const std::vector<T>& x) {
+    std::vector<T> result(x.size());
+    softmax(x.data(), result.data(), x.size());
+    return result;
+}
+
+/**
+ * @brief Softmax Jacobian-vector product for a batch of rows
+ *
+ * Computes out = s * (g - dot(s, g)) row by row, i.e. J(s) * g for each row
+ * of a row-major batch. The softmax Jacobian diag(s) - s s^T is symmetric,
+ * so this is also the vector-Jacobian product. O(rows * cols), and the
+ * Jacobian itself is never formed.
+ *
+ * @tparam T Numeric type
+ * @param s Softmax outputs, rows x cols
+ * @param g Vectors to multiply, rows x cols
+ * @param out Result, rows x cols (may alias g)
+ * @param rows Number of rows
+ * @param cols Number of columns (softmax width)
+ */
+template<typename T>
+void softmaxJvp(const T* s, const T* g, T* out, std::size_t rows, std::size_t cols) {
+    for (std::size_t r = 0; r < rows; ++r) {
+        const T* sr = s + r * cols;
+        const T* gr = g + r * cols;
+        T* outr = out + r * cols;
+        
+        T dot = T{0};
+        for (std::size_t c = 0; c < cols; ++c) {
+            dot += sr[c] * gr[c];
+        }
+        
+        for (std::size_t c = 0; c < cols; ++c) {
+            outr[c] = sr[c] * (gr[c] - dot);
+        }
+    }
+}
+
+/**
+ * @brief Softmax vector-Jacobian product for a batch of rows
+ * @tparam T Numeric type
+ * @param s Softmax outputs, rows x cols
+ * @param g Upstream gradients with respect to s, rows x cols
+ * @param out Gradients with respect to the softmax inputs (may alias g)
+ * @param rows Number of rows
+ * @param cols Number of columns (softmax width)
+ */
+template<typename T>
+void softmaxVjp(const T* s, const T* g, T* out, std::size_t rows, std::size_t cols) {
+    softmaxJvp(s, g, out, rows, cols);
+}
+
+/**
+ * @brief Softmax Jacobian-vector product
+ * @tparam T Numeric type
+ * @param s Softmax output (as returned by softmax())
+ * @param v Input-space direction
+ * @return J(s) * v
+ */
+template<typename T>
+std::vector<T> softmaxJvp(const std::vector<T>& s, const std::vector<T>& v) {
+    std::vector<T> result(s.size());
+    softmaxJvp(s.data(), v.data(), result.data(), 1, s.size());
+    return result;
+}
+
+/**
+ * @brief Softmax vector-Jacobian product (backpropagation through softmax)
+ * @tparam T Numeric type
+ * @param s Softmax output (as returned by softmax())
+ * @param g Gradient with respect to the softmax output
+ * @return Gradient with respect to the softmax input
+ */
+template<typename T>
+std::vector<T> softmaxVjp(const std::vector<T>& s, const std::vector<T>& g) {
+    std::vector<T> result(s.size());
+    softmaxVjp(s.data(), g.data(), result.data(), 1, s.size());
     return result;
 }
 
@@ -256,8 +345,10 @@ std::vector<T> softmax(const std::vector<T>& x) {
  * @param i Index for which to compute derivative
  * @param j Index of the output
  * @return Derivative of softmax[i] with respect to x[j]
+ * @deprecated Recomputes the softmax on every call; use softmaxJvp()/softmaxVjp()
  */
 template<typename T>
+[[deprecated("recomputes softmax per element; use softmaxJvp/softmaxVjp")]]
 T softmaxDerivative(const std::vector<T>& x, std::size_t i, std::size_t j) {
     auto sm = softmax(x);
     if (i == j) {
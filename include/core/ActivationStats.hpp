@@ -0,0 +1,160 @@
+/**
+ * @file ActivationStats.hpp
+ * @brief Sampled per-neuron activation statistics
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <limits>
+
+#include "core/Types.hpp"
+#include "utils/Common.hpp"
+#include "utils/SnapshotBuffer.hpp"
+
+namespace nnv {
+namespace core {
+
+/**
+ * @brief Streaming statistics of one neuron's activation (Welford)
+ */
+struct NeuronActivationStats {
+    std::uint64_t count = 0;        ///< Number of samples
+    std::uint64_t zeroCount = 0;    ///< Samples that were exactly zero
+    double mean = 0.0;              ///< Running mean
+    double m2 = 0.0;                ///< Sum of squared deviations from the mean
+    double min = std::numeric_limits<double>::infinity();   ///< Minimum seen
+    double max = -std::numeric_limits<double>::infinity();  ///< Maximum seen
+
+    /**
+     * @brief Add one activation sample
+     * @param value Activation value
+     */
+    void add(double value) {
+        ++count;
+        double delta = value - mean;
+        mean += delta / static_cast<double>(count);
+        m2 += delta * (value - mean);
+        zeroCount += (value == 0.0);
+        min = value < min ? value : min;
+        max = value > max ? value : max;
+    }
+
+    /**
+     * @brief Get population variance
+     * @return Variance (0 if fewer than two samples)
+     */
+    double variance() const {
+        return count > 1 ? m2 / static_cast<double>(count) : 0.0;
+    }
+
+    /**
+     * @brief Get fraction of zero activations (dead ReLU indicator)
+     * @return Fraction in [0, 1]
+     */
+    double zeroFraction() const {
+        return count > 0 ? static_cast<double>(zeroCount) / static_cast<double>(count) : 0.0;
+    }
+};
+
+/**
+ * @brief Published activation statistics for all layers
+ */
+struct ActivationStatsSnapshot {
+    std::uint64_t sampledBatches = 0;                           ///< Batches that contributed
+    std::vector<std::vector<NeuronActivationStats>> layers;     ///< Per-layer, per-neuron stats
+};
+
+/**
+ * @brief Collects activation statistics from a sample of training batches
+ *
+ * The training thread accumulates into private per-layer arrays from inside
+ * Layer::applyActivation (no extra pass over the activations) and publishes
+ * a copy at the end of every sampled batch. Renderer and UI threads poll
+ * snapshot() without locking and without stalling training.
+ */
+class ActivationStatsCollector {
+public:
+    /**
+     * @brief Constructor
+     * @param sampleInterval Sample one of every N training batches
+     */
+    explicit ActivationStatsCollector(std::size_t sampleInterval = 16);
+
+    /**
+     * @brief Destructor
+     */
+    ~ActivationStatsCollector() = default;
+
+    // Disable copy and move
+    NNV_DISABLE_COPY_AND_MOVE(ActivationStatsCollector)
+
+    /**
+     * @brief Set batch sampling interval
+     * @param interval Sample one of every N batches (0 is treated as 1)
+     */
+    void setSampleInterval(std::size_t interval) { sampleInterval_ = interval > 0 ? interval : 1; }
+
+    /**
+     * @brief Get batch sampling interval
+     * @return Sampling interval
+     */
+    std::size_t getSampleInterval() const { return sampleInterval_; }
+
+    /**
+     * @brief Start a training batch (training thread)
+     * @param layerCount Number of layers in the network
+     * @return True if this batch is sampled
+     */
+    bool beginBatch(std::size_t layerCount);
+
+    /**
+     * @brief Get accumulator array for a layer of the current sampled batch
+     * @param layer Layer index
+     * @param size Layer size (stats are reset if the layer was resized)
+     * @return Pointer to size accumulators
+     */
+    NeuronActivationStats* layerAccumulators(LayerIndex layer, LayerSize size);
+
+    /**
+     * @brief Finish the current batch and publish if it was sampled (training thread)
+     */
+    void endBatch();
+
+    /**
+     * @brief Discard accumulated statistics (training thread)
+     */
+    void reset();
+
+    /**
+     * @brief Copy the latest published statistics (any thread)
+     * @param out Destination snapshot (capacity is reused)
+     */
+    void snapshot(ActivationStatsSnapshot& out) const { published_.read(out); }
+
+    /**
+     * @brief Copy the latest published statistics (any thread)
+     * @return Snapshot copy
+     */
+    ActivationStatsSnapshot snapshot() const { return published_.read(); }
+
+    /**
+     * @brief Get number of published snapshots
+     * @return Version counter, useful to skip unchanged snapshots
+     */
+    std::uint64_t getVersion() const { return published_.version(); }
+
+private:
+    std::size_t sampleInterval_;                    ///< Sample one of every N batches
+    std::size_t batchCounter_;                      ///< Batches seen
+    bool sampling_;                                 ///< Current batch is sampled
+    bool pendingPublish_;                           ///< Last publish was skipped
+    ActivationStatsSnapshot accumulators_;          ///< Training-thread state
+    utils::SnapshotBuffer<ActivationStatsSnapshot> published_; ///< Reader-visible state
+};
+
+} // namespace core
+} // namespace nnv
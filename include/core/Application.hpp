@@ -12,8 +12,11 @@
 #include <SFML/Graphics.hpp>
 
 #include "core/Types.hpp"
+#include "graphics/RenderConfig.hpp"
+#include "utils/AllocationTracker.hpp"
 #include "utils/ConfigManager.hpp"
 #include "utils/Common.hpp"
+#include "utils/SnapshotBuffer.hpp"
 
 // Forward declarations
 namespace nnv {
@@ -29,6 +32,7 @@ namespace ui {
 }
 namespace utils {
     class PerformanceMonitor;
+    class MetricsServer;
 }
 }
 
@@ -149,6 +153,13 @@ private:
     std::unique_ptr<ui::InputHandler> inputHandler_;
     std::unique_ptr<utils::PerformanceMonitor> performanceMonitor_;
     
+    // Metrics (the server is declared last so it stops before the state it reads is destroyed)
+    utils::SnapshotBuffer<graphics::RenderStats> publishedRenderStats_; ///< Render stats for the metrics thread
+    std::size_t networkMetricsId_;
+    float lastRenderMs_;
+    utils::AllocationCounts lastFrameAllocations_;  ///< Heap allocations of the main thread in the last frame
+    std::unique_ptr<utils::MetricsServer> metricsServer_;
+    
     // Application state
     bool running_;
     bool initialized_;
@@ -170,6 +181,16 @@ private:
      */
     bool initializeSubsystems();
     
+    /**
+     * @brief Start the Prometheus endpoint if metrics.port is set
+     */
+    void initializeMetrics();
+    
+    /**
+     * @brief Point the network metrics collector at the current network
+     */
+    void updateNetworkMetrics();
+    
     /**
      * @brief Process SFML events
      */
@@ -0,0 +1,158 @@
+/**
+ * @file CostModel.hpp
+ * @brief Analytic per-layer work and memory traffic, and roofline analysis
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "core/PerfStats.hpp"
+#include "utils/MachinePeaks.hpp"
+
+namespace nnv {
+namespace core {
+
+/**
+ * @brief Work and memory traffic of one training phase of a layer
+ */
+struct PhaseCost {
+    double flops = 0.0;     ///< Floating point operations
+    double bytes = 0.0;     ///< Bytes read and written
+
+    /**
+     * @brief Get arithmetic intensity
+     * @return FLOP per byte (0 if no traffic)
+     */
+    double intensity() const { return bytes > 0.0 ? flops / bytes : 0.0; }
+
+    PhaseCost& operator+=(const PhaseCost& other) {
+        flops += other.flops;
+        bytes += other.bytes;
+        return *this;
+    }
+};
+
+/**
+ * @brief Analytic cost of one layer for a batch
+ *
+ * FLOPs match the PerfStats accounting: 2 per weight in forward, 2 per
+ * weight of the next layer in backward and 3 per weight in the SGD update.
+ * Bytes count every array a pass touches once (parameters that are updated
+ * twice), per sample, since batches are processed one sample at a time.
+ * That is the DRAM traffic when nothing stays cached between passes; layers
+ * whose weights fit in cache move less and can exceed the memory roof.
+ */
+struct LayerCost {
+    std::size_t inputSize = 0;          ///< Inputs per neuron (fan-in)
+    std::size_t outputSize = 0;         ///< Neurons
+    PhaseCost forward;                  ///< Weighted sum and activation
+    PhaseCost backward;                 ///< Delta propagation from the next layer
+    PhaseCost update;                   ///< Weight and bias update
+    std::size_t parameterBytes = 0;     ///< Weights and biases
+    std::size_t activationBytes = 0;    ///< Layer outputs for the whole batch
+
+    /**
+     * @brief Get cost of a phase
+     * @param phase Forward, Backward or Update
+     * @return Phase cost (zero for other phases)
+     */
+    const PhaseCost& phase(TrainingPhase phase) const;
+
+    /**
+     * @brief Get cost of all phases
+     * @return Summed cost
+     */
+    PhaseCost total() const {
+        PhaseCost sum = forward;
+        sum += backward;
+        sum += update;
+        return sum;
+    }
+};
+
+/**
+ * @brief Analytic cost of a training step
+ */
+struct CostModel {
+    std::size_t batchSize = 0;          ///< Samples per step
+    std::vector<LayerCost> layers;      ///< Per-layer cost (index 0 is the input layer)
+
+    /**
+     * @brief Get cost of all layers and phases
+     * @return Summed cost
+     */
+    PhaseCost total() const;
+
+    /**
+     * @brief Get bytes of all weights and biases
+     * @return Parameter bytes
+     */
+    std::size_t parameterBytes() const;
+
+    /**
+     * @brief Get bytes of all layer outputs for the batch
+     * @return Activation bytes
+     */
+    std::size_t activationBytes() const;
+};
+
+/**
+ * @brief What limits a layer phase in the roofline model
+ */
+enum class RooflineBound {
+    Compute,    ///< Intensity above the ridge point: the compute roof applies
+    Memory,     ///< Intensity below the ridge point: the bandwidth roof applies
+    Cache       ///< Achieved bandwidth above DRAM peak: the working set is cached, efficiency is against the compute roof
+};
+
+/**
+ * @brief Get display name of a roofline bound
+ * @param bound Roofline bound
+ * @return Bound name
+ */
+const char* getRooflineBoundName(RooflineBound bound);
+
+/**
+ * @brief Measured performance of one layer phase against the roofs
+ */
+struct RooflinePoint {
+    std::size_t layer = 0;                  ///< Layer index
+    TrainingPhase phase = TrainingPhase::Forward; ///< Forward, Backward or Update
+    double seconds = 0.0;                   ///< Measured time over all timed samples
+    double intensity = 0.0;                 ///< Analytic FLOP per byte
+    double gflops = 0.0;                    ///< Achieved GFLOP/s
+    double gbps = 0.0;                      ///< Achieved GB/s of modeled traffic
+    double attainableGflops = 0.0;          ///< min(peak GFLOP/s, intensity * peak GB/s)
+    double efficiency = 0.0;                ///< gflops / attainableGflops
+    RooflineBound bound = RooflineBound::Compute; ///< Applicable roof
+};
+
+/**
+ * @brief Combine the cost model with measured layer timings
+ * @param model Cost model of the network (any batch size)
+ * @param stats Timings gathered with NeuralNetwork::enablePerfStats
+ * @param peaks Machine peaks
+ * @return One point per layer and phase that was timed
+ *
+ * Low efficiency means the code leaves the hardware idle (overheads,
+ * missed vectorization); efficiency near 1 means the layer runs at the
+ * roof and only less work or less traffic makes it faster.
+ */
+std::vector<RooflinePoint> computeRoofline(const CostModel& model, const PerfStats& stats,
+                                           const utils::MachinePeaks& peaks);
+
+/**
+ * @brief Format roofline points as a table
+ * @param points Roofline points
+ * @param peaks Machine peaks used for the points
+ * @return Multi-line report
+ */
+std::string formatRoofline(const std::vector<RooflinePoint>& points, const utils::MachinePeaks& peaks);
+
+} // namespace core
+} // namespace nnv
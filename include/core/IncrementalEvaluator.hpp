@@ -0,0 +1,192 @@
+/**
+ * @file IncrementalEvaluator.hpp
+ * @brief Incremental forward propagation for interactive weight edits
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#pragma once
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+#include "core/Types.hpp"
+#include "utils/Common.hpp"
+
+namespace nnv {
+namespace core {
+
+/**
+ * @brief Re-evaluates a network after single weight or bias edits
+ *
+ * After a full evaluation the evaluator caches the weighted inputs and
+ * activations of every layer. Editing one weight only changes the
+ * pre-activation of one neuron, so instead of running a new forward pass
+ * the change is pushed downstream as a rank-1 update: the edited neuron,
+ * one weight column of the next layer, then only the neurons whose
+ * activation actually moved in the layers after that.
+ *
+ * Results are written back into the network's neurons so the renderer
+ * shows the what-if state. Evaluation uses inference semantics (no dropout).
+ * If any layer's parameters changed since the cached evaluation (training,
+ * or edits through getLayer()), the next edit refreshes the cache first.
+ *
+ * @tparam T Numeric type (float, double)
+ */
+template<typename T = Scalar>
+class IncrementalEvaluator {
+public:
+    /**
+     * @brief Constructor
+     * @param network Network to evaluate (must outlive the evaluator)
+     */
+    explicit IncrementalEvaluator(NeuralNetwork<T>& network);
+
+    /**
+     * @brief Destructor
+     */
+    ~IncrementalEvaluator() = default;
+
+    // Disable copy and move
+    NNV_DISABLE_COPY_AND_MOVE(IncrementalEvaluator)
+
+    /**
+     * @brief Run a full forward pass and cache all intermediate values
+     * @param inputs Input vector
+     * @return True if successful
+     */
+    bool evaluate(const std::vector<T>& inputs);
+
+    /**
+     * @brief Re-run the full forward pass with the cached inputs
+     * @return True if successful
+     */
+    bool refresh();
+
+    /**
+     * @brief Check if cached values are usable for incremental updates
+     * @return True if valid
+     */
+    bool isValid() const { return valid_; }
+
+    /**
+     * @brief Discard cached values (e.g. after structural network changes)
+     */
+    void invalidate() { valid_ = false; }
+
+    /**
+     * @brief Set a single weight and propagate the change
+     * @param layer Layer index (must be > 0)
+     * @param neuron Neuron index within the layer
+     * @param input Index of the input connection
+     * @param weight New weight value
+     * @return True if successful
+     */
+    bool setWeight(LayerIndex layer, NeuronIndex neuron, std::size_t input, T weight);
+
+    /**
+     * @brief Set a single bias and propagate the change
+     * @param layer Layer index (must be > 0)
+     * @param neuron Neuron index within the layer
+     * @param bias New bias value
+     * @return True if successful
+     */
+    bool setBias(LayerIndex layer, NeuronIndex neuron, T bias);
+
+    /**
+     * @brief Get cached network outputs
+     * @return Output activations
+     */
+    const std::vector<T>& getOutputs() const { return activations_.back(); }
+
+    /**
+     * @brief Get cached activations of a layer
+     * @param layer Layer index
+     * @return Activation values
+     */
+    const std::vector<T>& getActivations(LayerIndex layer) const {
+        NNV_ASSERT(layer < activations_.size());
+        return activations_[layer];
+    }
+
+    /**
+     * @brief Get cached weighted inputs (without bias) of a layer
+     * @param layer Layer index
+     * @return Weighted input values
+     */
+    const std::vector<T>& getWeightedInputs(LayerIndex layer) const {
+        NNV_ASSERT(layer < weightedInputs_.size());
+        return weightedInputs_[layer];
+    }
+
+    /**
+     * @brief Set how many incremental edits are applied before a full refresh
+     * @param interval Edit count (0 disables automatic refresh)
+     *
+     * Incremental updates accumulate rounding error; a periodic full pass
+     * keeps the cached state from drifting.
+     */
+    void setRefreshInterval(std::size_t interval) { refreshInterval_ = interval; }
+
+    /**
+     * @brief Get automatic refresh interval
+     * @return Edit count between full refreshes
+     */
+    std::size_t getRefreshInterval() const { return refreshInterval_; }
+
+private:
+    NeuralNetwork<T>& network_;                     ///< Evaluated network
+    std::vector<T> inputs_;                         ///< Cached inputs
+    std::vector<std::vector<T>> weightedInputs_;    ///< Cached weighted sums per layer
+    std::vector<std::vector<T>> activations_;       ///< Cached activations per layer
+    std::vector<std::uint64_t> parameterVersions_;  ///< Layer parameter versions the cache reflects
+    bool valid_;                                    ///< Cache validity flag
+    std::size_t editsSinceRefresh_;                 ///< Edits since last full pass
+    std::size_t refreshInterval_;                   ///< Edits between full passes
+
+    // Scratch buffers for propagation
+    std::vector<T> changedValues_;                  ///< Activation deltas of changed neurons
+    std::vector<NeuronIndex> changedNeurons_;       ///< Indices of changed neurons
+    std::vector<T> nextValues_;
+    std::vector<NeuronIndex> nextNeurons_;
+
+    /**
+     * @brief Verify the network still matches the cached shapes
+     * @return True if shapes match
+     */
+    bool checkShape() const;
+    
+    /**
+     * @brief Refresh the cache if any layer's parameters changed since it was built
+     * @return False if the refresh failed
+     */
+    bool refreshIfStale();
+
+    /**
+     * @brief Recompute activations of a layer after weighted input changes
+     * @param layer Layer index
+     * @param neurons Neurons whose weighted input changed
+     *
+     * Fills changedNeurons_/changedValues_ with the resulting activation deltas.
+     */
+    void updateActivations(LayerIndex layer, const std::vector<NeuronIndex>& neurons);
+
+    /**
+     * @brief Push the current activation deltas through the remaining layers
+     * @param fromLayer Layer whose activation deltas are pending
+     */
+    void propagate(LayerIndex fromLayer);
+
+    /**
+     * @brief Count an edit and refresh if the interval is reached
+     */
+    void finishEdit();
+};
+
+// Type aliases
+using FloatIncrementalEvaluator = IncrementalEvaluator<float>;
+using DoubleIncrementalEvaluator = IncrementalEvaluator<double>;
+
+} // namespace core
+} // namespace nnv
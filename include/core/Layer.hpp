@@ -7,19 +7,114 @@
 
 #pragma once
 
+#include <cstdint>
 #include <vector>
 #include <memory>
 #include <string>
 #include <functional>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "core/Types.hpp"
-#include "core/Neuron.hpp"
 #include "core/ActivationFunctions.hpp"
 #include "utils/Common.hpp"
+#include "utils/AlignedAllocator.hpp"
 
 namespace nnv {
 namespace core {
 
+struct NeuronActivationStats;
+struct LayerUpdateMetrics;
+
+/**
+ * @brief Memory footprint of one layer in bytes
+ */
+struct LayerMemoryUsage {
+    std::size_t weights = 0;            ///< Weight matrix and biases
+    std::size_t optimizerState = 0;     ///< Optimizer moments (none for SGD)
+    std::size_t activations = 0;        ///< Per-neuron forward/backward state
+    std::size_t scratch = 0;            ///< Reusable work buffers
+    std::size_t metadata = 0;           ///< Names, flags and layer bookkeeping
+    
+    std::size_t total() const { return weights + optimizerState + activations + scratch + metadata; }
+};
+
+/**
+ * @brief Lightweight handle to one neuron of a layer
+ *
+ * Neuron state is stored in per-layer arrays; this proxy keeps the
+ * Neuron-style accessors for code that works one neuron at a time.
+ * It is only valid while the layer is alive and not resized.
+ *
+ * @tparam T Numeric type
+ * @tparam LayerT Layer<T> or const Layer<T>
+ */
+template<typename T, typename LayerT>
+class NeuronHandle {
+public:
+    NeuronHandle(LayerT& layer, NeuronIndex index) : layer_(&layer), index_(index) {}
+    
+    NeuronIndex getId() const { return index_; }
+    
+    T getActivation() const { return layer_->activations_[index_]; }
+    void setActivation(T activation) { layer_->activations_[index_] = activation; }
+    
+    T getBias() const { return layer_->getBiases()[index_]; }
+    void setBias(T bias) { layer_->mutableParams().biases[index_] = bias; }
+    
+    T getWeightedInput() const { return layer_->weightedInputs_[index_]; }
+    void setWeightedInput(T input) { layer_->weightedInputs_[index_] = input; }
+    
+    T getGradient() const { return layer_->gradients_[index_]; }
+    void setGradient(T gradient) { layer_->gradients_[index_] = gradient; }
+    
+    T getDelta() const { return layer_->deltas_[index_]; }
+    void setDelta(T delta) { layer_->deltas_[index_] = delta; }
+    
+    bool isTrainable() const { return layer_->isNeuronTrainable(index_); }
+    void setTrainable(bool trainable) { layer_->setNeuronTrainable(index_, trainable); }
+    
+    const std::string& getName() const { return layer_->getNeuronName(index_); }
+    void setName(const std::string& name) { layer_->setNeuronName(index_, name); }
+    
+    std::size_t getInputCount() const { return layer_->getInputSize(); }
+    
+    /**
+     * @brief Get pointer to this neuron's weight row
+     * @return getInputCount() contiguous weights
+     */
+    auto getInputWeightData() const { return layer_->getWeightRow(index_); }
+    
+    /**
+     * @brief Copy this neuron's input weights
+     * @return Weight vector
+     */
+    std::vector<T> getInputWeights() const {
+        auto row = getInputWeightData();
+        return std::vector<T>(row, row + getInputCount());
+    }
+    
+    void setInputWeights(const std::vector<T>& weights) {
+        NNV_ASSERT(weights.size() == getInputCount());
+        std::copy(weights.begin(), weights.begin() + std::min(weights.size(), getInputCount()),
+                  layer_->getMutableWeightRow(index_));
+    }
+    
+    T getInputWeight(std::size_t input) const {
+        return input < getInputCount() ? getInputWeightData()[input] : T{0};
+    }
+    
+    void setInputWeight(std::size_t input, T weight) {
+        if (input < getInputCount()) {
+            layer_->getMutableWeightRow(index_)[input] = weight;
+        }
+    }
+
+private:
+    LayerT* layer_;
+    NeuronIndex index_;
+};
+
 /**
  * @brief Neural network layer class
  * @tparam T Numeric type (float, double)
@@ -27,6 +122,10 @@ namespace core {
 template<typename T = Scalar>
 class Layer {
 public:
+    using WeightBuffer = utils::AlignedVector<T, utils::MemoryCategory::Weights>;
+    using ActivationBuffer = utils::AlignedVector<T, utils::MemoryCategory::Activations>;
+    using WorkspaceBuffer = utils::AlignedVector<T, utils::MemoryCategory::Workspace>;
+    
     /**
      * @brief Constructor
      * @param size Number of neurons in this layer
@@ -59,7 +158,13 @@ public:
      * @brief Get layer size (number of neurons)
      * @return Number of neurons
      */
-    LayerSize getSize() const { return neurons_.size(); }
+    LayerSize getSize() const { return size_; }
+    
+    /**
+     * @brief Get number of inputs per neuron (previous layer size)
+     * @return Fan-in
+     */
+    std::size_t getInputSize() const { return fanIn_; }
     
     /**
      * @brief Get layer name
@@ -112,35 +217,28 @@ public:
     /**
      * @brief Get neuron by index
      * @param index Neuron index
-     * @return Reference to neuron
+     * @return Handle to the neuron's state
      */
-    Neuron<T>& getNeuron(NeuronIndex index) {
-        NNV_ASSERT(index < neurons_.size());
-        return neurons_[index];
+    NeuronHandle<T, Layer> getNeuron(NeuronIndex index) {
+        NNV_ASSERT(index < size_);
+        return NeuronHandle<T, Layer>(*this, index);
     }
     
     /**
      * @brief Get neuron by index (const version)
      * @param index Neuron index
-     * @return Const reference to neuron
+     * @return Read-only handle to the neuron's state
      */
-    const Neuron<T>& getNeuron(NeuronIndex index) const {
-        NNV_ASSERT(index < neurons_.size());
-        return neurons_[index];
+    NeuronHandle<T, const Layer> getNeuron(NeuronIndex index) const {
+        NNV_ASSERT(index < size_);
+        return NeuronHandle<T, const Layer>(*this, index);
     }
     
-    /**
-     * @brief Get all neurons
-     * @return Vector of neurons
-     */
-    std::vector<Neuron<T>>& getNeurons() { return neurons_; }
-    const std::vector<Neuron<T>>& getNeurons() const { return neurons_; }
-    
     /**
      * @brief Get activations of all neurons
      * @return Vector of activation values
      */
-    std::vector<T> getActivations() const;
+    const ActivationBuffer& getActivations() const { return activations_; }
     
     /**
      * @brief Set activations of all neurons
@@ -148,11 +246,23 @@ public:
      */
     void setActivations(const std::vector<T>& activations);
     
+    /**
+     * @brief Get weighted inputs (w . x, without bias) of all neurons
+     * @return Vector of weighted inputs
+     */
+    const ActivationBuffer& getWeightedInputs() const { return weightedInputs_; }
+    
+    /**
+     * @brief Get backpropagation deltas of all neurons
+     * @return Vector of deltas
+     */
+    const ActivationBuffer& getDeltas() const { return deltas_; }
+    
     /**
      * @brief Get biases of all neurons
      * @return Vector of bias values
      */
-    std::vector<T> getBiases() const;
+    const WeightBuffer& getBiases() const { return params_->biases; }
     
     /**
      * @brief Set biases of all neurons
@@ -160,6 +270,87 @@ public:
      */
     void setBiases(const std::vector<T>& biases);
     
+    /**
+     * @brief Get contiguous row-major weights (getSize() x getInputSize())
+     * @return Pointer to the weight matrix
+     */
+    const T* getWeightData() const { return params_->weights.data(); }
+    
+    /**
+     * @brief Get weights of one neuron
+     * @param index Neuron index
+     * @return Pointer to getInputSize() weights
+     */
+    const T* getWeightRow(NeuronIndex index) const { return params_->weights.data() + index * fanIn_; }
+    
+    /**
+     * @brief Get writable weights, detaching them from any clone first
+     * @return Pointer to the weight matrix
+     */
+    T* getMutableWeightData() { return mutableParams().weights.data(); }
+    
+    /**
+     * @brief Get writable weights of one neuron, detaching them from any clone first
+     * @param index Neuron index
+     * @return Pointer to getInputSize() weights
+     */
+    T* getMutableWeightRow(NeuronIndex index) { return mutableParams().weights.data() + index * fanIn_; }
+    
+    /**
+     * @brief Check if weights and biases are still shared with a clone
+     * @return True if another layer references the same parameters
+     */
+    bool hasSharedParameters() const { return params_.use_count() > 1; }
+    
+    /**
+     * @brief Get a counter bumped whenever weights or biases may have been written
+     * @return Parameter version (only meaningful compared with an earlier value of the same layer)
+     *
+     * Training, NeuronHandle edits and the mutable weight accessors all bump
+     * it, so caches derived from the parameters can detect that they are stale.
+     */
+    std::uint64_t getParameterVersion() const { return parameterVersion_; }
+    
+    /**
+     * @brief Create a copy that shares weights and biases until either side writes them
+     * @return Cloned layer; O(neurons), weights are not copied
+     */
+    std::unique_ptr<Layer> clone() const;
+    
+    /**
+     * @brief Get neuron name
+     * @param index Neuron index
+     * @return Name, or an empty string if none was set
+     */
+    const std::string& getNeuronName(NeuronIndex index) const;
+    
+    /**
+     * @brief Set neuron name (stored only for named neurons)
+     * @param index Neuron index
+     * @param name Name (empty to clear)
+     */
+    void setNeuronName(NeuronIndex index, const std::string& name);
+    
+    /**
+     * @brief Check per-neuron trainable flag
+     * @param index Neuron index
+     * @return True unless the neuron was frozen
+     */
+    bool isNeuronTrainable(NeuronIndex index) const { return frozenNeurons_.count(index) == 0; }
+    
+    /**
+     * @brief Set per-neuron trainable flag (stored only for frozen neurons)
+     * @param index Neuron index
+     * @param trainable New trainable state
+     */
+    void setNeuronTrainable(NeuronIndex index, bool trainable);
+    
+    /**
+     * @brief Get memory footprint of this layer
+     * @return Byte counts by category
+     */
+    LayerMemoryUsage memoryUsage() const;
+    
     /**
      * @brief Initialize weights connecting to previous layer
      * @param prevLayerSize Size of previous layer
@@ -171,12 +362,31 @@ public:
      * @brief Forward pass computation
      * @param inputs Input values from previous layer
      */
-    void forward(const std::vector<T>& inputs);
+    void forward(const std::vector<T>& inputs) { forward(inputs.data(), inputs.size()); }
+    
+    /**
+     * @brief Forward pass computation
+     * @param inputs Input values from previous layer
+     * @param count Number of inputs (must equal getInputSize())
+     */
+    void forward(const T* inputs, std::size_t count);
     
     /**
      * @brief Apply activation function to all neurons
+     * @param stats Optional per-neuron accumulators updated with each activation
      */
-    void applyActivation();
+    void applyActivation(NeuronActivationStats* stats = nullptr);
+    
+    /**
+     * @brief Compute inference outputs without touching layer state
+     * @param inputs Input activations
+     * @param count Number of inputs (must equal getInputSize())
+     * @param outputs Receives getSize() activations (must not alias inputs)
+     *
+     * Weighted sum, bias and activation as in forward() + applyActivation();
+     * dropout is the identity at inference. Safe on a shared read-only layer.
+     */
+    void infer(const T* inputs, std::size_t count, T* outputs) const;
     
     /**
      * @brief Apply dropout during training
@@ -192,12 +402,32 @@ public:
     void computeGradients(const std::vector<T>& nextLayerDeltas,
                          const std::vector<std::vector<T>>& nextLayerWeights);
     
+    /**
+     * @brief Compute gradients for backpropagation from the next layer's state
+     * @param nextLayer Next layer (deltas and weights are read in place)
+     */
+    void computeGradients(const Layer& nextLayer);
+    
+    /**
+     * @brief Update weights using computed gradients
+     * @param learningRate Learning rate for updates
+     * @param prevLayerActivations Activations from previous layer
+     * @param metrics Optional gradient/update reductions gathered in the same pass
+     */
+    void updateWeights(T learningRate, const std::vector<T>& prevLayerActivations,
+                      LayerUpdateMetrics* metrics = nullptr) {
+        updateWeights(learningRate, prevLayerActivations.data(), prevLayerActivations.size(), metrics);
+    }
+    
     /**
      * @brief Update weights using computed gradients
      * @param learningRate Learning rate for updates
      * @param prevLayerActivations Activations from previous layer
+     * @param count Number of activations (must equal getInputSize())
+     * @param metrics Optional gradient/update reductions gathered in the same pass
      */
-    void updateWeights(T learningRate, const std::vector<T>& prevLayerActivations);
+    void updateWeights(T learningRate, const T* prevLayerActivations, std::size_t count,
+                      LayerUpdateMetrics* metrics = nullptr);
     
     /**
      * @brief Reset layer state
@@ -229,7 +459,27 @@ public:
     void fromJson(const nlohmann::json& json);
 
 private:
-    std::vector<Neuron<T>> neurons_;        ///< Neurons in this layer
+    template<typename, typename> friend class NeuronHandle;
+    
+    LayerSize size_;                        ///< Number of neurons
+    std::size_t fanIn_;                     ///< Inputs per neuron
+    /**
+     * @brief Trainable parameters, shared copy-on-write between clones
+     */
+    struct ParameterBlock {
+        WeightBuffer weights;               ///< Row-major size_ x fanIn_ weights
+        WeightBuffer biases;                ///< Per-neuron biases
+    };
+    
+    std::shared_ptr<ParameterBlock> params_; ///< Weights and biases
+    std::uint64_t parameterVersion_;        ///< Bumped by mutableParams() and freshParams()
+    ActivationBuffer weightedInputs_;       ///< Per-neuron w . x (without bias)
+    ActivationBuffer activations_;          ///< Per-neuron activations
+    ActivationBuffer gradients_;            ///< Per-neuron gradients
+    ActivationBuffer deltas_;               ///< Per-neuron error deltas
+    WorkspaceBuffer scratch_;               ///< Backpropagation work buffer
+    std::unordered_map<NeuronIndex, std::string> neuronNames_;  ///< Sparse neuron names
+    std::unordered_set<NeuronIndex> frozenNeurons_;             ///< Sparse non-trainable neurons
     std::string name_;                      ///< Layer name
     ActivationType activationType_;         ///< Activation function type
     T dropoutRate_;                        ///< Dropout rate (0.0 to 1.0)
@@ -248,9 +498,27 @@ private:
     void updateActivationFunctions();
     
     /**
-     * @brief Initialize neuron IDs
+     * @brief Get parameters for writing, copying them first if shared
+     * @return Exclusively owned parameter block
+     */
+    ParameterBlock& mutableParams();
+    
+    /**
+     * @brief Get an exclusively owned parameter block without copying its contents
+     * @return Parameter block to be overwritten
+     */
+    ParameterBlock& freshParams();
+    
+    /**
+     * @brief Apply the activation derivative to the summed upstream deltas in scratch_
      */
-    void initializeNeuronIds();
+    void finishGradients();
+    
+    /**
+     * @brief Resize per-neuron arrays
+     * @param size Number of neurons
+     */
+    void resizeNeurons(LayerSize size);
     
     /**
      * @brief Apply Xavier/Glorot initialization
@@ -271,6 +539,13 @@ private:
     void initializeRandom(LayerSize prevLayerSize);
 };
 
+// Neuron handle aliases
+template<typename T = Scalar>
+using NeuronRef = NeuronHandle<T, Layer<T>>;
+
+template<typename T = Scalar>
+using ConstNeuronRef = NeuronHandle<T, const Layer<T>>;
+
 // Type aliases
 using FloatLayer = Layer<float>;
 using DoubleLayer = Layer<double>;
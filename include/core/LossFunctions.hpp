@@ -208,6 +208,63 @@ std::vector<T> huberLossGradient(const std::vector<T>& outputs, const std::vecto
     return gradients;
 }
 
+/**
+ * @brief Raise to a non-negative integer power by repeated squaring
+ * @tparam T Numeric type
+ * @param base Base
+ * @param exponent Exponent
+ * @return base^exponent
+ */
+template<typename T>
+inline T powInt(T base, unsigned exponent) {
+    T result = T{1};
+    while (exponent != 0) {
+        if (exponent & 1u) {
+            result *= base;
+        }
+        base *= base;
+        exponent >>= 1;
+    }
+    return result;
+}
+
+/**
+ * @brief Classify focal gamma for the integer fast path
+ * @tparam T Numeric type
+ * @param gamma Focusing parameter
+ * @return Gamma as an integer, or -1 if std::pow is needed
+ */
+template<typename T>
+inline int focalIntegerGamma(T gamma) {
+    return (gamma >= T{0} && gamma <= T{16} && gamma == std::floor(gamma)) ? static_cast<int>(gamma) : -1;
+}
+
+/**
+ * @brief Focal modulating factor (1 - pt)^gamma
+ * @tparam T Numeric type
+ * @param q 1 - pt
+ * @param gamma Focusing parameter
+ * @param intGamma Result of focalIntegerGamma(gamma)
+ * @param qPowM1 Optional output for (1 - pt)^(gamma - 1)
+ * @return (1 - pt)^gamma
+ */
+template<typename T>
+inline T focalModulator(T q, T gamma, int intGamma, T* qPowM1 = nullptr) {
+    if (intGamma > 0) {
+        T lower = powInt(q, static_cast<unsigned>(intGamma - 1));
+        if (qPowM1) *qPowM1 = lower;
+        return lower * q;
+    }
+    
+    if (intGamma == 0) {
+        if (qPowM1) *qPowM1 = T{0}; // Multiplied by gamma == 0
+        return T{1};
+    }
+    
+    if (qPowM1) *qPowM1 = std::pow(q, gamma - T{1});
+    return std::pow(q, gamma);
+}
+
 /**
  * @brief Focal loss function (for imbalanced classification)
  * @tparam T Numeric type
@@ -225,13 +282,14 @@ T focalLoss(const std::vector<T>& outputs, const std::vector<T>& targets, T alph
     
     T loss = T{0};
     const T epsilon = T{1e-15};
+    const int intGamma = focalIntegerGamma(gamma);
     
     for (std::size_t i = 0; i < outputs.size(); ++i) {
         T clampedOutput = std::max(epsilon, std::min(T{1} - epsilon, outputs[i]));
         T pt = targets[i] * clampedOutput + (T{1} - targets[i]) * (T{1} - clampedOutput);
         T logPt = std::log(pt);
         
-        loss -= alpha * std::pow(T{1} - pt, gamma) * logPt;
+        loss -= alpha * focalModulator(T{1} - pt, gamma, intGamma) * logPt;
     }
     
     return loss / static_cast<T>(outputs.size());
@@ -251,13 +309,15 @@ std::vector<T> focalLossGradient(const std::vector<T>& outputs, const std::vecto
                                 T alpha = T{1}, T gamma = T{2}) {
     std::vector<T> gradients(outputs.size());
     const T epsilon = T{1e-15};
+    const int intGamma = focalIntegerGamma(gamma);
     
     for (std::size_t i = 0; i < outputs.size(); ++i) {
         T clampedOutput = std::max(epsilon, std::min(T{1} - epsilon, outputs[i]));
         T pt = targets[i] * clampedOutput + (T{1} - targets[i]) * (T{1} - clampedOutput);
         
-        T factor1 = alpha * std::pow(T{1} - pt, gamma);
-        T factor2 = gamma * std::pow(T{1} - pt, gamma - T{1}) * std::log(pt);
+        T qPowM1;
+        T factor1 = alpha * focalModulator(T{1} - pt, gamma, intGamma, &qPowM1);
+        T factor2 = alpha * gamma * qPowM1 * std::log(pt);
         
         if (targets[i] == T{1}) {
             gradients[i] = -factor1 / clampedOutput + factor2;
@@ -271,6 +331,194 @@ std::vector<T> focalLossGradient(const std::vector<T>& outputs, const std::vecto
     return gradients;
 }
 
+/**
+ * @brief Fused batched loss kernel signature
+ *
+ * Takes B x K output and target views, writes the per-sample gradient
+ * (identical to the matching *Gradient function) into a B x K buffer and
+ * returns the loss averaged over the B rows. Both are produced in a single
+ * pass, without allocating. An empty gradient view (MatrixView<T>{}) skips
+ * the gradient, e.g. for evaluation.
+ */
+template<typename T>
+using FusedLossFunction = std::function<T(ConstMatrixView<T>, ConstMatrixView<T>, MatrixView<T>)>;
+
+/**
+ * @brief Fused batched MSE loss and gradient
+ * @tparam T Numeric type
+ * @param outputs Network outputs (B x K)
+ * @param targets Target values (B x K)
+ * @param gradients Gradient output (B x K, or empty for the loss only)
+ * @return Mean loss over rows
+ */
+template<typename T>
+T meanSquaredErrorBatch(ConstMatrixView<T> outputs, ConstMatrixView<T> targets, MatrixView<T> gradients) {
+    const bool withGradients = gradients.data != nullptr;
+    if (outputs.rows != targets.rows || outputs.cols != targets.cols ||
+        (withGradients && gradients.size() < outputs.size()) || outputs.size() == 0) {
+        return T{0};
+    }
+    
+    const std::size_t n = outputs.size();
+    const T scale = T{2} / static_cast<T>(outputs.cols);
+    T loss = T{0};
+    
+    for (std::size_t i = 0; i < n; ++i) {
+        T diff = outputs.data[i] - targets.data[i];
+        loss += diff * diff;
+        if (withGradients) {
+            gradients.data[i] = scale * diff;
+        }
+    }
+    
+    return loss / static_cast<T>(n);
+}
+
+/**
+ * @brief Fused batched cross-entropy loss and gradient
+ * @tparam T Numeric type
+ * @param outputs Network outputs (B x K probabilities)
+ * @param targets Target values (B x K one-hot)
+ * @param gradients Gradient output (B x K, or empty for the loss only)
+ * @return Mean loss over rows
+ */
+template<typename T>
+T crossEntropyBatch(ConstMatrixView<T> outputs, ConstMatrixView<T> targets, MatrixView<T> gradients) {
+    const bool withGradients = gradients.data != nullptr;
+    if (outputs.rows != targets.rows || outputs.cols != targets.cols ||
+        (withGradients && gradients.size() < outputs.size()) || outputs.size() == 0) {
+        return T{0};
+    }
+    
+    const std::size_t n = outputs.size();
+    const T epsilon = T{1e-15};
+    T loss = T{0};
+    
+    for (std::size_t i = 0; i < n; ++i) {
+        T clampedOutput = std::max(epsilon, std::min(T{1} - epsilon, outputs.data[i]));
+        loss -= targets.data[i] * std::log(clampedOutput);
+        if (withGradients) {
+            gradients.data[i] = -targets.data[i] / clampedOutput;
+        }
+    }
+    
+    return loss / static_cast<T>(outputs.rows);
+}
+
+/**
+ * @brief Fused batched binary cross-entropy loss and gradient
+ * @tparam T Numeric type
+ * @param outputs Network outputs (B x K probabilities)
+ * @param targets Target values (B x K binary)
+ * @param gradients Gradient output (B x K, or empty for the loss only)
+ * @return Mean loss over rows
+ */
+template<typename T>
+T binaryCrossEntropyBatch(ConstMatrixView<T> outputs, ConstMatrixView<T> targets, MatrixView<T> gradients) {
+    const bool withGradients = gradients.data != nullptr;
+    if (outputs.rows != targets.rows || outputs.cols != targets.cols ||
+        (withGradients && gradients.size() < outputs.size()) || outputs.size() == 0) {
+        return T{0};
+    }
+    
+    const std::size_t n = outputs.size();
+    const T epsilon = T{1e-15};
+    const T invCols = T{1} / static_cast<T>(outputs.cols);
+    T loss = T{0};
+    
+    for (std::size_t i = 0; i < n; ++i) {
+        T clampedOutput = std::max(epsilon, std::min(T{1} - epsilon, outputs.data[i]));
+        T target = targets.data[i];
+        loss -= target * std::log(clampedOutput) + (T{1} - target) * std::log(T{1} - clampedOutput);
+        if (withGradients) {
+            gradients.data[i] = invCols * (clampedOutput - target) / (clampedOutput * (T{1} - clampedOutput));
+        }
+    }
+    
+    return loss / static_cast<T>(n);
+}
+
+/**
+ * @brief Fused batched Huber loss and gradient
+ * @tparam T Numeric type
+ * @param outputs Network outputs (B x K)
+ * @param targets Target values (B x K)
+ * @param gradients Gradient output (B x K, or empty for the loss only)
+ * @param delta Huber delta parameter
+ * @return Mean loss over rows
+ */
+template<typename T>
+T huberLossBatch(ConstMatrixView<T> outputs, ConstMatrixView<T> targets, MatrixView<T> gradients,
+                 T delta = T{1}) {
+    const bool withGradients = gradients.data != nullptr;
+    if (outputs.rows != targets.rows || outputs.cols != targets.cols ||
+        (withGradients && gradients.size() < outputs.size()) || outputs.size() == 0) {
+        return T{0};
+    }
+    
+    const std::size_t n = outputs.size();
+    const T invCols = T{1} / static_cast<T>(outputs.cols);
+    T loss = T{0};
+    
+    for (std::size_t i = 0; i < n; ++i) {
+        T diff = outputs.data[i] - targets.data[i];
+        // Clamped residual is both the gradient and the quadratic part
+        T clipped = std::max(-delta, std::min(delta, diff));
+        T absClipped = std::abs(clipped);
+        loss += absClipped * (std::abs(diff) - T{0.5} * absClipped);
+        if (withGradients) {
+            gradients.data[i] = invCols * clipped;
+        }
+    }
+    
+    return loss / static_cast<T>(n);
+}
+
+/**
+ * @brief Fused batched focal loss and gradient
+ * @tparam T Numeric type
+ * @param outputs Network outputs (B x K probabilities)
+ * @param targets Target values (B x K one-hot)
+ * @param gradients Gradient output (B x K, or empty for the loss only)
+ * @param alpha Weighting factor for rare class
+ * @param gamma Focusing parameter (integer values avoid std::pow)
+ * @return Mean loss over rows
+ */
+template<typename T>
+T focalLossBatch(ConstMatrixView<T> outputs, ConstMatrixView<T> targets, MatrixView<T> gradients,
+                 T alpha = T{1}, T gamma = T{2}) {
+    const bool withGradients = gradients.data != nullptr;
+    if (outputs.rows != targets.rows || outputs.cols != targets.cols ||
+        (withGradients && gradients.size() < outputs.size()) || outputs.size() == 0) {
+        return T{0};
+    }
+    
+    const std::size_t n = outputs.size();
+    const T epsilon = T{1e-15};
+    const T invCols = T{1} / static_cast<T>(outputs.cols);
+    const int intGamma = focalIntegerGamma(gamma);
+    T loss = T{0};
+    
+    for (std::size_t i = 0; i < n; ++i) {
+        T clampedOutput = std::max(epsilon, std::min(T{1} - epsilon, outputs.data[i]));
+        T target = targets.data[i];
+        T pt = target * clampedOutput + (T{1} - target) * (T{1} - clampedOutput);
+        T logPt = std::log(pt);
+        
+        T qPowM1;
+        T factor1 = alpha * focalModulator(T{1} - pt, gamma, intGamma, &qPowM1);
+        T factor2 = alpha * gamma * qPowM1 * logPt;
+        
+        loss -= factor1 * logPt;
+        if (withGradients) {
+            gradients.data[i] = invCols * (target == T{1} ? factor2 - factor1 / clampedOutput
+                                                           : factor1 / (T{1} - clampedOutput) - factor2);
+        }
+    }
+    
+    return loss / static_cast<T>(n);
+}
+
 } // namespace loss
 
 /**
@@ -334,6 +582,34 @@ public:
                 return loss::meanSquaredErrorGradient<T>;
         }
     }
+    
+    /**
+     * @brief Get fused batched loss and gradient kernel by type
+     * @tparam T Numeric type
+     * @param type Loss function type
+     * @return Fused loss kernel
+     */
+    template<typename T>
+    static loss::FusedLossFunction<T> getFused(LossType type) {
+        switch (type) {
+            case LossType::MeanSquaredError:
+                return loss::meanSquaredErrorBatch<T>;
+            case LossType::CrossEntropy:
+                return loss::crossEntropyBatch<T>;
+            case LossType::BinaryCrossEntropy:
+                return loss::binaryCrossEntropyBatch<T>;
+            case LossType::Huber:
+                return [](ConstMatrixView<T> outputs, ConstMatrixView<T> targets, MatrixView<T> gradients) {
+                    return loss::huberLossBatch(outputs, targets, gradients);
+                };
+            case LossType::FocalLoss:
+                return [](ConstMatrixView<T> outputs, ConstMatrixView<T> targets, MatrixView<T> gradients) {
+                    return loss::focalLossBatch(outputs, targets, gradients);
+                };
+            default:
+                return loss::meanSquaredErrorBatch<T>;
+        }
+    }
 };
 
 } // namespace core
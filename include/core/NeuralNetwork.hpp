@@ -14,14 +14,54 @@
 #include <thread>
 #include <atomic>
 #include <mutex>
+#include <condition_variable>
+#include <future>
 
 #include "core/Types.hpp"
 #include "core/Layer.hpp"
+#include "core/ActivationStats.hpp"
+#include "core/CostModel.hpp"
+#include "core/TrainingMetrics.hpp"
+#include "core/PerfStats.hpp"
 #include "utils/Common.hpp"
+#include "utils/EpochReclamation.hpp"
+#include "utils/EventLog.hpp"
+#include "utils/ThreadPool.hpp"
 
 namespace nnv {
+namespace utils {
+    class MetricsWriter;
+}
+
 namespace core {
 
+/**
+ * @brief Memory footprint of a network in bytes
+ */
+struct NetworkMemoryUsage {
+    std::vector<LayerMemoryUsage> layers;   ///< Per-layer breakdown
+    LayerMemoryUsage network;               ///< Network-level buffers and telemetry
+    
+    /**
+     * @brief Sum all layers and network-level usage by category
+     * @return Totals
+     */
+    LayerMemoryUsage total() const {
+        LayerMemoryUsage sum = network;
+        for (const auto& layer : layers) {
+            sum.weights += layer.weights;
+            sum.optimizerState += layer.optimizerState;
+            sum.activations += layer.activations;
+            sum.scratch += layer.scratch;
+            sum.metadata += layer.metadata;
+        }
+        return sum;
+    }
+};
+
+// Subscribers of NeuralNetwork::subscribeBatchMetrics(); published as a whole, never modified in place
+using BatchMetricsStreamList = std::vector<std::shared_ptr<BatchMetricsStream>>;
+
 /**
  * @brief Main neural network class with training and inference capabilities
  * @tparam T Numeric type (float, double)
@@ -177,6 +217,27 @@ public:
                          const std::vector<std::vector<T>>* validationTargets = nullptr,
                          ProgressCallback progressCallback = nullptr);
     
+    /**
+     * @brief Train on the shared library thread pool
+     * @param inputData Training input data (moved into the task)
+     * @param targetData Training target data (moved into the task)
+     * @param epochs Number of epochs
+     * @param batchSize Batch size
+     * @param cancellation Token checked before every batch
+     * @param progressCallback Optional progress callback (runs on the pool thread)
+     * @return Future of the training history; ready immediately with an empty
+     *         history if the network is already training
+     *
+     * The network must not be modified by other threads until the future is
+     * ready; read it through getPublishedWeights() instead.
+     */
+    std::future<TrainingHistory> trainAsync(std::vector<std::vector<T>> inputData,
+                                            std::vector<std::vector<T>> targetData,
+                                            std::size_t epochs,
+                                            std::size_t batchSize = 32,
+                                            utils::CancellationToken cancellation = {},
+                                            ProgressCallback progressCallback = nullptr);
+    
     /**
      * @brief Evaluate the network on test data
      * @param inputData Test input data
@@ -193,6 +254,19 @@ public:
      */
     std::vector<T> predict(const std::vector<T>& inputs);
     
+    /**
+     * @brief Predict outputs without modifying the network
+     * @param inputs Input vector
+     * @param outputs Receives the output activations
+     * @param scratch Caller-owned buffer for hidden activations
+     * @return False if the network is empty or the input size doesn't match
+     *
+     * Works on a PublishedWeights version or any network no thread is
+     * modifying, so readers need no clone(). Allocates nothing once the
+     * buffers have grown to size.
+     */
+    bool predict(const std::vector<T>& inputs, std::vector<T>& outputs, std::vector<T>& scratch) const;
+    
     /**
      * @brief Predict outputs for batch of inputs
      * @param inputBatch Batch of input vectors
@@ -249,8 +323,31 @@ public:
     
     /**
      * @brief Stop training (for async training)
+     *
+     * Takes effect before the next batch, also while paused.
+     */
+    void stopTraining();
+    
+    /**
+     * @brief Pause training before the next batch
+     */
+    void pauseTraining();
+    
+    /**
+     * @brief Resume paused training
+     */
+    void resumeTraining();
+    
+    /**
+     * @brief Check if training is paused
+     * @return True if paused
+     */
+    bool isPaused() const { return isPaused_.load(); }
+    
+    /**
+     * @brief Block until no training run is active
      */
-    void stopTraining() { shouldStop_.store(true); }
+    void waitForTraining() const;
     
     /**
      * @brief Get training progress (0.0 to 1.0)
@@ -258,6 +355,217 @@ public:
      */
     T getTrainingProgress() const { return trainingProgress_.load(); }
     
+    /**
+     * @brief Get memory footprint per layer
+     * @return Byte counts for weights, optimizer state, activations and scratch
+     *
+     * Reads the live layers; call while the network is not training.
+     * writeMetrics() reports the copy published after each training step.
+     */
+    NetworkMemoryUsage memoryUsage() const;
+    
+    /**
+     * @brief Get analytic work and memory traffic per layer
+     * @param batchSize Samples per training step
+     * @return FLOPs and bytes per phase, parameter and activation bytes
+     * @see computeRoofline() to compare with getPerfStats() timings
+     */
+    CostModel costModel(std::size_t batchSize = 1) const;
+    
+    /**
+     * @brief Create an independent copy of the network
+     * @return Cloned network
+     *
+     * Weights and biases are shared copy-on-write: a layer's parameters are
+     * copied only when either network next writes them, so cloning costs
+     * O(layers + neurons) rather than O(parameters). Activation statistics,
+     * step telemetry and callbacks are not carried over. Call from the
+     * training thread (e.g. a step callback) or while not training.
+     */
+    std::unique_ptr<NeuralNetwork> clone() const;
+    
+    /**
+     * @brief Create an immutable copy-on-write snapshot for readers
+     * @return Read-only network sharing parameters with this one
+     *
+     * Intended for rendering and checkpointing while training continues on
+     * the original. Same threading rules as clone().
+     */
+    std::shared_ptr<const NeuralNetwork> snapshot() const { return clone(); }
+    
+    /// Read guard pinning one published weight version
+    using PublishedWeights = typename utils::RcuPointer<NeuralNetwork>::ReadGuard;
+    
+    /**
+     * @brief Publish a read-only weight version every N optimizer steps
+     * @param interval Steps between publishes (0 is treated as 1)
+     *
+     * Publishing swaps in a copy-on-write snapshot, so the next weight update
+     * after each publish copies the parameters once. Call while not training.
+     */
+    void enableWeightPublishing(std::size_t interval = 1);
+    
+    /**
+     * @brief Stop publishing weight versions
+     *
+     * Call while not training and while no reader holds PublishedWeights.
+     */
+    void disableWeightPublishing();
+    
+    /**
+     * @brief Publish the current weights now (training thread, or while not training)
+     */
+    void publishWeights();
+    
+    /**
+     * @brief Get the latest published weight version (any thread, lock-free)
+     * @return Guard to a consistent read-only network; empty if none was published
+     *
+     * The version stays alive until the guard is destroyed; hold it only for
+     * the duration of a frame or an inference call. The guard is read-only:
+     * run inference with the const predict(inputs, outputs, scratch).
+     */
+    PublishedWeights getPublishedWeights() const {
+        return publishedWeights_ ? publishedWeights_->read() : PublishedWeights();
+    }
+    
+    /**
+     * @brief Enable sampled activation statistics during training
+     * @param sampleInterval Sample one of every N training batches
+     *
+     * Call while the network is not training.
+     */
+    void enableActivationStats(std::size_t sampleInterval = 16);
+    
+    /**
+     * @brief Disable activation statistics
+     *
+     * Call while the network is not training.
+     */
+    void disableActivationStats();
+    
+    /**
+     * @brief Get activation statistics collector
+     * @return Collector to poll with snapshot(), or nullptr if disabled
+     */
+    std::shared_ptr<const ActivationStatsCollector> getActivationStats() const { return activationStats_; }
+    
+    /**
+     * @brief Enable per-step gradient/update telemetry
+     * @param enabled Whether weight updates gather per-layer metrics
+     *
+     * Call while the network is not training.
+     */
+    void enableStepMetrics(bool enabled = true) { stepMetricsEnabled_ = enabled; }
+    
+    /**
+     * @brief Check if per-step telemetry is enabled
+     * @return True if enabled
+     */
+    bool isStepMetricsEnabled() const { return stepMetricsEnabled_; }
+    
+    /**
+     * @brief Set callback invoked on the training thread after every step
+     * @param callback Step metrics callback (nullptr to clear)
+     *
+     * Call while the network is not training.
+     */
+    void setStepMetricsCallback(StepMetricsCallback callback) { stepMetricsCallback_ = std::move(callback); }
+    
+    /**
+     * @brief Copy the most recently published step metrics (any thread)
+     * @param out Destination record (capacity is reused)
+     */
+    void getLastStepMetrics(StepMetrics& out) const { publishedStepMetrics_.read(out); }
+    
+    /**
+     * @brief Copy the most recently published step metrics (any thread)
+     * @return Step metrics record
+     */
+    StepMetrics getLastStepMetrics() const { return publishedStepMetrics_.read(); }
+    
+    /**
+     * @brief Subscribe to per-batch metrics (any thread)
+     * @param capacity Records buffered before new ones are dropped
+     * @return Stream to drain from exactly one consumer thread
+     */
+    std::shared_ptr<BatchMetricsStream> subscribeBatchMetrics(std::size_t capacity = 1024);
+    
+    /**
+     * @brief Stop pushing metrics to a stream (any thread)
+     * @param stream Stream returned by subscribeBatchMetrics()
+     */
+    void unsubscribeBatchMetrics(const std::shared_ptr<BatchMetricsStream>& stream);
+    
+    /**
+     * @brief Record run, epoch, step and checkpoint events to a binary log
+     * @param eventLog Open log (nullptr to stop recording)
+     *
+     * Call while the network is not training.
+     */
+    void setEventLog(std::shared_ptr<utils::EventLog> eventLog) { eventLog_ = std::move(eventLog); }
+    
+    /**
+     * @brief Get the event log
+     * @return Event log (nullptr if none)
+     */
+    std::shared_ptr<utils::EventLog> getEventLog() const { return eventLog_; }
+    
+    /**
+     * @brief Enable per-phase and per-layer training timers
+     * @param enabled Whether training steps are timed
+     *
+     * Call while the network is not training.
+     */
+    void enablePerfStats(bool enabled = true);
+    
+    /**
+     * @brief Check if training timers are enabled
+     * @return True if enabled
+     */
+    bool isPerfStatsEnabled() const { return perfStatsEnabled_.load(std::memory_order_relaxed); }
+    
+    /**
+     * @brief Count hardware events per layer forward, backward and update
+     * @param enabled Whether to collect counters (enabling also enables perf stats)
+     * @return False if counters are unavailable; training and timers are unaffected
+     *
+     * Reads cycles, instructions, LLC references/misses and branches/misses
+     * through perf_event_open around every layer of timed steps; see
+     * LayerPerfStats for IPC and miss rates. Each reading is a system call,
+     * so use this for diagnostic runs. Call while the network is not training.
+     */
+    bool enableHardwareCounters(bool enabled = true);
+    
+    /**
+     * @brief Check if hardware counters are collected
+     * @return True if enabled and available
+     */
+    bool isHardwareCountersEnabled() const { return hardwareCountersEnabled_; }
+    
+    /**
+     * @brief Copy the accumulated performance statistics (any thread)
+     * @return Phase and layer histograms, samples/s and GFLOP/s per layer
+     */
+    PerfStats getPerfStats() const { return publishedPerfStats_.read(); }
+    
+    /**
+     * @brief Discard accumulated performance statistics
+     *
+     * Call from the training thread or while not training.
+     */
+    void resetPerfStats();
+    
+    /**
+     * @brief Write Prometheus metrics for this network (any thread)
+     * @param out Metrics writer; samples are labelled with the network name
+     *
+     * Progress, throughput and loss counters, step and phase latency
+     * quantiles when perf stats are enabled, batch metrics queue depths and
+     * memory per category. Reads only published state.
+     */
+    void writeMetrics(utils::MetricsWriter& out) const;
+    
     /**
      * @brief Serialize network to JSON
      * @return JSON representation
@@ -295,11 +603,83 @@ private:
     std::atomic<bool> isTraining_;                ///< Training flag
     std::atomic<bool> shouldStop_;                ///< Stop training flag
     std::atomic<T> trainingProgress_;             ///< Training progress
+    std::atomic<bool> isPaused_;                  ///< Pause training flag
+    bool dropoutActive_;                          ///< Forward passes apply dropout
+    mutable std::mutex trainingStateMutex_;       ///< Guards run/pause state changes
+    mutable std::condition_variable trainingStateChanged_; ///< Signals pause, stop and completion
     mutable std::mutex networkMutex_;             ///< Thread safety
     
+    // Diagnostics
+    std::shared_ptr<ActivationStatsCollector> activationStats_; ///< Sampled activation stats
+    bool statsSampling_;                          ///< Current batch is sampled
+    bool stepMetricsEnabled_;                     ///< Gather per-step update metrics
+    std::uint64_t stepCounter_;                   ///< Optimizer steps taken
+    StepMetrics stepMetrics_;                     ///< Training-thread metrics record
+    StepMetricsCallback stepMetricsCallback_;     ///< Per-step metrics callback
+    utils::SnapshotBuffer<StepMetrics> publishedStepMetrics_; ///< Reader-visible metrics
+    utils::RcuPointer<BatchMetricsStreamList> batchMetricsStreams_; ///< Immutable subscriber list, replaced on (un)subscribe
+    mutable std::mutex batchMetricsMutex_;        ///< Serializes subscribe/unsubscribe (never taken by training)
+    std::atomic<bool> hasBatchMetricsStreams_;    ///< Subscriber list is non-empty
+    std::shared_ptr<utils::EventLog> eventLog_;   ///< Structured event sink
+    std::atomic<bool> perfStatsEnabled_;          ///< Time training steps (set from any thread)
+    bool timingStep_;                             ///< Current forward pass belongs to a timed step
+    bool hardwareCountersEnabled_;                ///< Count hardware events in timed steps
+    bool countingStep_;                           ///< Current timed step reads hardware counters
+    std::unique_ptr<utils::PerfCounterGroup> counters_; ///< Counters of the training thread
+    std::thread::id countersThread_;              ///< Thread counters_ was opened on
+    utils::HardwareCounterValues counterMark_;    ///< Reading at the start of the current layer
+    utils::AllocationCounts allocationMark_;      ///< Thread allocations at the start of the timed step
+    PerfStats perfStats_;                         ///< Training-thread timings
+    utils::SnapshotBuffer<PerfStats> publishedPerfStats_; ///< Reader-visible timings
+    utils::SnapshotBuffer<NetworkMemoryUsage> publishedMemoryUsage_; ///< Reader-visible memory footprint
+    std::atomic<std::uint64_t> batchesTrained_;   ///< Training batches completed
+    std::atomic<std::uint64_t> samplesTrained_;   ///< Training samples processed
+    std::atomic<double> lastLoss_;                ///< Mean loss of the last batch or sample
+    
+    // Published weights
+    std::size_t publishInterval_;                 ///< Steps between weight publishes
+    std::unique_ptr<utils::RcuPointer<NeuralNetwork>> publishedWeights_; ///< Reader-visible weights
+    
     // Loss and optimizer functions
     std::function<T(const std::vector<T>&, const std::vector<T>&)> lossFunction_;
-    std::function<std::vector<T>(const std::vector<T>&, const std::vector<T>&)> lossGradientFunction_;
+    std::function<T(ConstMatrixView<T>, ConstMatrixView<T>, MatrixView<T>)> fusedLossFunction_;
+    utils::AlignedVector<T, utils::MemoryCategory::Workspace> outputGradients_; ///< Loss gradient scratch buffer
+    utils::AlignedVector<T, utils::MemoryCategory::Workspace> evaluationOutputs_; ///< evaluate() B x K outputs
+    utils::AlignedVector<T, utils::MemoryCategory::Workspace> evaluationTargets_; ///< evaluate() B x K targets
+    
+    /**
+     * @brief Mark the network as training
+     * @return False if a run is already active
+     */
+    bool beginTraining();
+    
+    /**
+     * @brief Mark the run as finished and wake waiters
+     */
+    void finishTraining();
+    
+    /**
+     * @brief Block while paused
+     * @param cancellation Optional token that also ends the wait
+     * @return False if training should stop
+     */
+    bool waitWhilePaused(const utils::CancellationToken* cancellation);
+    
+    /**
+     * @brief Epoch loop shared by train() and trainAsync()
+     * @param inputs Training inputs (shuffled in place)
+     * @param targets Training targets (shuffled in place)
+     * @param cancellation Optional token checked before every batch
+     * @return Training history of completed epochs
+     */
+    TrainingHistory runTraining(std::vector<std::vector<T>>& inputs,
+                                std::vector<std::vector<T>>& targets,
+                                std::size_t epochs,
+                                std::size_t batchSize,
+                                const std::vector<std::vector<T>>* validationInputs,
+                                const std::vector<std::vector<T>>* validationTargets,
+                                ProgressCallback progressCallback,
+                                const utils::CancellationToken* cancellation);
     
     /**
      * @brief Update loss function based on type
@@ -311,6 +691,79 @@ private:
      */
     void updateOptimizer();
     
+    /**
+     * @brief Measure the memory footprint without locking
+     * @param usage Destination (its capacity is reused)
+     */
+    void collectMemoryUsage(NetworkMemoryUsage& usage) const;
+    
+    /**
+     * @brief Publish the memory footprint for writeMetrics()
+     *
+     * Called by whichever thread currently owns the layers: the training
+     * thread after each step, or the caller of a structural change.
+     */
+    void publishMemoryUsage();
+    
+    /**
+     * @brief Finalize and publish the current step metrics record
+     * @param loss Loss of the step
+     */
+    void publishStepMetrics(T loss);
+    
+    /**
+     * @brief Forward pass leaving the outputs in the output layer's activations
+     * @param inputs Input vector
+     * @return False if the input size is wrong
+     */
+    bool forwardPass(const std::vector<T>& inputs);
+    
+    /**
+     * @brief Backward pass on outputs that need not be a std::vector
+     * @param targets Target values
+     * @param outputs Network outputs
+     * @param outputSize Number of outputs
+     * @return Loss value
+     */
+    T backwardPass(const std::vector<T>& targets, const T* outputs, std::size_t outputSize);
+    
+    /**
+     * @brief Start timing a training step if enabled
+     * @return Start time of the step (epoch if not timed)
+     */
+    PerfClock::time_point beginTimedStep();
+    
+    /**
+     * @brief Add hardware events since the last reading to a layer's totals
+     * @param into Layer counters
+     */
+    void accumulateCounters(utils::HardwareCounterValues& into);
+    
+    /**
+     * @brief Record a timed step's wall time and publish the statistics
+     * @param start Value returned by beginTimedStep()
+     * @param samples Samples processed in the step
+     */
+    void endTimedStep(PerfClock::time_point start, std::size_t samples);
+    
+    /**
+     * @brief Push a batch record to all subscribers without blocking
+     * @param record Batch metrics
+     *
+     * Reads the published subscriber list, so every subscriber gets the
+     * record or counts it as dropped even while another thread subscribes.
+     */
+    void publishBatchMetrics(BatchMetrics& record);
+    
+    /**
+     * @brief Check if one prediction is correct
+     * @param outputs Network outputs
+     * @param targets Target values
+     * @param size Output size
+     * @return True if the predicted class matches the target
+     */
+    static bool isCorrectPrediction(const T* outputs, const T* targets, std::size_t size);
+    
     /**
      * @brief Compute accuracy for classification tasks
      * @param outputs Network outputs
@@ -0,0 +1,205 @@
+/**
+ * @file PerfStats.hpp
+ * @brief Training throughput telemetry with per-phase and per-layer timing
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "utils/AllocationTracker.hpp"
+#include "utils/PerfCounters.hpp"
+
+namespace nnv {
+namespace core {
+
+/**
+ * @brief Phases of a training step
+ */
+enum class TrainingPhase {
+    DataFetch,      ///< Shuffling and batching (per epoch)
+    Forward,        ///< Forward pass through all layers
+    Loss,           ///< Loss and output gradient
+    Backward,       ///< Delta propagation through hidden layers
+    Update,         ///< Weight and bias updates
+    Count
+};
+
+/**
+ * @brief Get display name of a training phase
+ * @param phase Training phase
+ * @return Phase name
+ */
+const char* getTrainingPhaseName(TrainingPhase phase);
+
+/**
+ * @brief Log2-bucketed histogram of durations
+ *
+ * Bucket i counts durations in [2^i, 2^(i+1)) nanoseconds, which gives
+ * constant-time recording and percentiles within a factor of two.
+ */
+struct TimingHistogram {
+    static constexpr std::size_t kBucketCount = 40;    ///< Up to ~18 minutes
+
+    std::array<std::uint64_t, kBucketCount> buckets{};  ///< Counts per bucket
+    std::uint64_t count = 0;                            ///< Recorded durations
+    std::uint64_t totalNanos = 0;                       ///< Sum of durations
+    std::uint64_t minNanos = std::numeric_limits<std::uint64_t>::max(); ///< Shortest duration
+    std::uint64_t maxNanos = 0;                         ///< Longest duration
+
+    /**
+     * @brief Record one duration
+     * @param nanos Duration in nanoseconds
+     */
+    void record(std::uint64_t nanos);
+
+    /**
+     * @brief Add another histogram's samples
+     * @param other Histogram to merge
+     */
+    void merge(const TimingHistogram& other);
+
+    /**
+     * @brief Discard all samples
+     */
+    void clear() { *this = TimingHistogram{}; }
+
+    /**
+     * @brief Get mean duration
+     * @return Mean in nanoseconds (0 if empty)
+     */
+    double meanNanos() const {
+        return count > 0 ? static_cast<double>(totalNanos) / static_cast<double>(count) : 0.0;
+    }
+
+    /**
+     * @brief Estimate a percentile
+     * @param p Percentile in [0, 1]
+     * @return Duration in nanoseconds, interpolated within the bucket
+     */
+    double percentileNanos(double p) const;
+};
+
+/**
+ * @brief Timing and work of one layer
+ */
+struct LayerPerfStats {
+    TimingHistogram forward;        ///< Weighted sum, activation and dropout
+    TimingHistogram backward;       ///< Delta propagation from the next layer
+    TimingHistogram update;         ///< Weight and bias update
+    double forwardFlops = 0.0;      ///< Floating point operations in forward
+    double backwardFlops = 0.0;     ///< Floating point operations in backward
+    double updateFlops = 0.0;       ///< Floating point operations in update
+    utils::HardwareCounterValues forwardCounters;   ///< Hardware events in forward (if enabled)
+    utils::HardwareCounterValues backwardCounters;  ///< Hardware events in backward (if enabled)
+    utils::HardwareCounterValues updateCounters;    ///< Hardware events in update (if enabled)
+
+    /**
+     * @brief Get achieved forward throughput
+     * @return GFLOP/s (0 if not timed)
+     */
+    double forwardGflops() const { return gflops(forwardFlops, forward); }
+
+    /**
+     * @brief Get achieved backward throughput
+     * @return GFLOP/s (0 if not timed)
+     */
+    double backwardGflops() const { return gflops(backwardFlops, backward); }
+
+    /**
+     * @brief Get achieved update throughput
+     * @return GFLOP/s (0 if not timed)
+     */
+    double updateGflops() const { return gflops(updateFlops, update); }
+
+    /**
+     * @brief Get achieved throughput over all phases
+     * @return GFLOP/s (0 if not timed)
+     */
+    double totalGflops() const {
+        const std::uint64_t nanos = forward.totalNanos + backward.totalNanos + update.totalNanos;
+        return nanos > 0 ? (forwardFlops + backwardFlops + updateFlops) / static_cast<double>(nanos) : 0.0;
+    }
+
+private:
+    static double gflops(double flops, const TimingHistogram& histogram) {
+        // FLOP per nanosecond equals GFLOP per second
+        return histogram.totalNanos > 0 ? flops / static_cast<double>(histogram.totalNanos) : 0.0;
+    }
+};
+
+/**
+ * @brief Accumulated training performance statistics
+ */
+struct PerfStats {
+    std::array<TimingHistogram, static_cast<std::size_t>(TrainingPhase::Count)> phases; ///< Per-phase timings
+    std::vector<LayerPerfStats> layers;     ///< Per-layer timings (index 0 is the input layer)
+    TimingHistogram steps;                  ///< Whole training steps (one sample or batch each)
+    std::uint64_t samples = 0;              ///< Training samples processed
+    std::uint64_t stepNanos = 0;            ///< Wall time of all training steps
+    bool hardwareCounters = false;          ///< Layer hardware counters were collected
+    utils::AllocationCounts allocations;    ///< Heap allocations of the training thread during steps
+
+    /**
+     * @brief Get histogram of a phase
+     * @param phase Training phase
+     * @return Phase histogram
+     */
+    const TimingHistogram& phase(TrainingPhase phase) const {
+        return phases[static_cast<std::size_t>(phase)];
+    }
+
+    TimingHistogram& phase(TrainingPhase phase) {
+        return phases[static_cast<std::size_t>(phase)];
+    }
+
+    /**
+     * @brief Get training throughput
+     * @return Samples per second of step time (excludes data fetch and evaluation)
+     */
+    double samplesPerSecond() const {
+        return stepNanos > 0 ? static_cast<double>(samples) * 1e9 / static_cast<double>(stepNanos) : 0.0;
+    }
+
+    /**
+     * @brief Get heap allocations per training step
+     * @return Mean allocations (zero unless the allocation hooks are linked)
+     */
+    double allocationsPerStep() const {
+        return steps.count > 0 ? static_cast<double>(allocations.allocations) / static_cast<double>(steps.count) : 0.0;
+    }
+
+    /**
+     * @brief Discard all samples, keeping the layer count
+     */
+    void clear();
+
+    /**
+     * @brief Format a human-readable report
+     * @return Multi-line table of phases and layers
+     */
+    std::string toString() const;
+};
+
+/// Clock used for training telemetry
+using PerfClock = std::chrono::steady_clock;
+
+/**
+ * @brief Get nanoseconds elapsed since a time point
+ * @param start Start time
+ * @return Elapsed nanoseconds
+ */
+inline std::uint64_t nanosSince(PerfClock::time_point start) {
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(PerfClock::now() - start).count());
+}
+
+} // namespace core
+} // namespace nnv
@@ -0,0 +1,172 @@
+/**
+ * @file TrainingMetrics.hpp
+ * @brief Per-step gradient and update telemetry and per-batch metrics streams
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#pragma once
+
+#include <vector>
+#include <atomic>
+#include <cstdint>
+#include <cmath>
+#include <functional>
+#include <limits>
+
+#include "utils/SpscRingBuffer.hpp"
+
+namespace nnv {
+namespace core {
+
+/**
+ * @brief Reductions gathered by Layer::updateWeights during one update
+ *
+ * Sums are kept squared so layers can be combined into a global norm.
+ */
+struct LayerUpdateMetrics {
+    double gradientNormSq = 0.0;        ///< Sum of squared weight and bias gradients
+    double weightNormSq = 0.0;          ///< Sum of squared parameters before the update
+    double updateNormSq = 0.0;          ///< Sum of squared applied updates
+    std::uint64_t nonFiniteCount = 0;   ///< NaN/Inf gradients seen
+    std::uint64_t parameterCount = 0;   ///< Parameters visited
+
+    /**
+     * @brief Get gradient L2 norm
+     * @return ||g||
+     */
+    double gradientNorm() const { return std::sqrt(gradientNormSq); }
+
+    /**
+     * @brief Get update-to-weight ratio
+     * @return ||dw|| / ||w|| (0 if the weights are all zero)
+     */
+    double updateRatio() const {
+        return weightNormSq > 0.0 ? std::sqrt(updateNormSq / weightNormSq) : 0.0;
+    }
+};
+
+/**
+ * @brief Telemetry record for one optimizer step
+ */
+struct StepMetrics {
+    std::uint64_t step = 0;                     ///< Optimizer step counter
+    double loss = 0.0;                          ///< Loss of the step
+    std::vector<LayerUpdateMetrics> layers;     ///< Per-layer metrics (index 0 is the input layer)
+
+    /**
+     * @brief Get global gradient L2 norm over all layers
+     * @return Global gradient norm
+     */
+    double gradientNorm() const {
+        double sum = 0.0;
+        for (const auto& layer : layers) {
+            sum += layer.gradientNormSq;
+        }
+        return std::sqrt(sum);
+    }
+
+    /**
+     * @brief Get total number of non-finite gradients
+     * @return NaN/Inf count
+     */
+    std::uint64_t nonFiniteCount() const {
+        std::uint64_t count = 0;
+        for (const auto& layer : layers) {
+            count += layer.nonFiniteCount;
+        }
+        return count;
+    }
+};
+
+// Invoked on the training thread after every step while metrics are enabled
+using StepMetricsCallback = std::function<void(const StepMetrics& metrics)>;
+
+/**
+ * @brief Metrics record for one training batch
+ */
+struct BatchMetrics {
+    std::uint64_t step = 0;             ///< Optimizer steps taken after this batch
+    std::uint64_t batchSize = 0;        ///< Samples in the batch
+    double loss = 0.0;                  ///< Mean loss over the batch
+    double accuracy = 0.0;              ///< Fraction of samples classified correctly
+    double samplesPerSecond = 0.0;      ///< Training throughput of the batch
+    double learningRate = 0.0;          ///< Learning rate used
+    double gradientNorm = std::numeric_limits<double>::quiet_NaN(); ///< Last step's gradient norm (NaN unless step metrics are enabled)
+};
+
+/**
+ * @brief One subscriber's queue of batch metrics
+ *
+ * The training thread pushes and a single consumer drains at its own pace.
+ * When the consumer falls behind, new records are dropped and counted
+ * rather than slowing down training.
+ */
+class BatchMetricsStream {
+public:
+    /**
+     * @brief Constructor
+     * @param capacity Records buffered before new ones are dropped
+     */
+    explicit BatchMetricsStream(std::size_t capacity) : ring_(capacity) {}
+
+    // Disable copy and move
+    NNV_DISABLE_COPY_AND_MOVE(BatchMetricsStream)
+
+    /**
+     * @brief Take the oldest record (consumer thread)
+     * @param out Destination record
+     * @return False if no record is queued
+     */
+    bool poll(BatchMetrics& out) { return ring_.tryPop(out); }
+
+    /**
+     * @brief Append all queued records (consumer thread)
+     * @param out Destination; records are appended
+     * @return Number of records appended
+     */
+    std::size_t drain(std::vector<BatchMetrics>& out) {
+        std::size_t count = 0;
+        BatchMetrics record;
+        while (ring_.tryPop(record)) {
+            out.push_back(record);
+            ++count;
+        }
+        return count;
+    }
+
+    /**
+     * @brief Queue a record (training thread)
+     * @param record Batch metrics
+     */
+    void push(const BatchMetrics& record) {
+        if (!ring_.tryPush(record)) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Get number of records dropped because the queue was full
+     * @return Dropped record count
+     */
+    std::uint64_t getDroppedCount() const { return dropped_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Get approximate number of queued records (any thread)
+     * @return Record count
+     */
+    std::size_t size() const { return ring_.size(); }
+
+    /**
+     * @brief Get buffer capacity
+     * @return Maximum number of queued records
+     */
+    std::size_t capacity() const { return ring_.capacity(); }
+
+private:
+    utils::SpscRingBuffer<BatchMetrics> ring_;
+    std::atomic<std::uint64_t> dropped_{0};
+};
+
+} // namespace core
+} // namespace nnv
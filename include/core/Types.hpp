@@ -39,6 +39,27 @@ using Vector = std::vector<Scalar>;
 using RowVector = std::vector<Scalar>;
 #endif
 
+/**
+ * @brief Non-owning view of a contiguous row-major matrix
+ * @tparam T Element type (const-qualified for read-only views)
+ */
+template<typename T>
+struct MatrixView {
+    T* data = nullptr;
+    std::size_t rows = 0;
+    std::size_t cols = 0;
+    
+    MatrixView() = default;
+    MatrixView(T* ptr, std::size_t r, std::size_t c) : data(ptr), rows(r), cols(c) {}
+    
+    T* row(std::size_t r) const { return data + r * cols; }
+    T& operator()(std::size_t r, std::size_t c) const { return data[r * cols + c]; }
+    std::size_t size() const { return rows * cols; }
+};
+
+template<typename T>
+using ConstMatrixView = MatrixView<const T>;
+
 // Network architecture types
 using LayerSize = std::size_t;
 using LayerIndex = std::size_t;
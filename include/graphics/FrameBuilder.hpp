@@ -0,0 +1,227 @@
+/**
+ * @file FrameBuilder.hpp
+ * @brief Headless per-frame geometry generation for network visualization
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+#include <SFML/Graphics.hpp>
+
+#include "core/Types.hpp"
+#include "graphics/ColorScheme.hpp"
+#include "graphics/RenderConfig.hpp"
+#include "utils/AllocationTracker.hpp"
+#include "utils/Common.hpp"
+
+namespace nnv {
+namespace graphics {
+
+/**
+ * @brief Stages of building one frame
+ */
+enum class FrameStage {
+    Layout,         ///< Neuron positions in screen space
+    Culling,        ///< Neuron and connection visibility against the viewport
+    LevelOfDetail,  ///< Neuron tessellation and connection budget selection
+    Colors,         ///< Activation and weight colors
+    Geometry,       ///< Vertex generation
+    Count
+};
+
+/**
+ * @brief Get display name of a frame stage
+ * @param stage Frame stage
+ * @return Stage name
+ */
+const char* getFrameStageName(FrameStage stage);
+
+/**
+ * @brief Neuron tessellation level chosen from the on-screen radius
+ */
+enum class NeuronDetail {
+    Full,           ///< 16-segment disc
+    Reduced,        ///< Hexagon
+    Minimal         ///< Quad
+};
+
+/**
+ * @brief Counts and timings of the last built frame
+ */
+struct FrameStats {
+    std::size_t neuronsTotal = 0;           ///< Neurons in the network
+    std::size_t neuronsVisible = 0;         ///< Neurons inside the viewport
+    std::size_t connectionsTotal = 0;       ///< Connections in the network
+    std::size_t connectionsVisible = 0;     ///< Connections crossing the viewport
+    std::size_t connectionsDrawn = 0;       ///< Connections kept by level of detail
+    NeuronDetail neuronDetail = NeuronDetail::Full; ///< Tessellation used
+    std::array<std::uint64_t, static_cast<std::size_t>(FrameStage::Count)> stageNanos{}; ///< Time per stage
+    utils::AllocationCounts allocations;    ///< Heap allocations while building (buffers grow on first frames)
+
+    /**
+     * @brief Get time spent in a stage
+     * @param stage Frame stage
+     * @return Nanoseconds
+     */
+    std::uint64_t nanos(FrameStage stage) const { return stageNanos[static_cast<std::size_t>(stage)]; }
+
+    /**
+     * @brief Get time spent building the frame
+     * @return Nanoseconds over all stages
+     */
+    std::uint64_t totalNanos() const;
+};
+
+/**
+ * @brief Vertex data of one frame, ready for upload
+ */
+struct FrameGeometry {
+    std::vector<sf::Vertex> neuronTriangles;    ///< sf::Triangles
+    std::vector<sf::Vertex> connectionLines;    ///< sf::Lines
+    FrameStats stats;                           ///< Counts and timings
+
+    /**
+     * @brief Get number of vertices
+     * @return Neuron plus connection vertices
+     */
+    std::size_t vertexCount() const { return neuronTriangles.size() + connectionLines.size(); }
+
+    /**
+     * @brief Copy counts into render statistics
+     * @param renderStats Statistics to update
+     */
+    void fillRenderStats(RenderStats& renderStats) const;
+};
+
+/**
+ * @brief Builds frame geometry for a network without a window or GPU
+ *
+ * Runs layout, culling, level of detail, coloring and vertex generation on
+ * the CPU into reusable buffers, so the renderer only uploads the result and
+ * the whole pipeline can be benchmarked headless. Connection visibility is a
+ * bitmask per layer, and the connection budget (maxVisibleConnections) is met
+ * by a weight-magnitude histogram rather than sorting, so memory stays
+ * proportional to the drawn geometry.
+ */
+class FrameBuilder {
+public:
+    /**
+     * @brief Constructor
+     * @param config Render configuration
+     */
+    explicit FrameBuilder(const RenderConfig& config);
+
+    /**
+     * @brief Destructor
+     */
+    ~FrameBuilder() = default;
+
+    // Disable copy and move
+    NNV_DISABLE_COPY_AND_MOVE(FrameBuilder)
+
+    /**
+     * @brief Build geometry for the current network state
+     * @param network Network to draw
+     * @param viewport Target viewport (screen size in bounds, world center and zoom)
+     * @return Frame geometry (valid until the next build)
+     */
+    const FrameGeometry& build(const core::DefaultNetwork& network, const Viewport& viewport);
+
+    /**
+     * @brief Get geometry of the last build
+     * @return Frame geometry
+     */
+    const FrameGeometry& getGeometry() const { return geometry_; }
+
+    /**
+     * @brief Set render configuration
+     * @param config New render configuration
+     */
+    void setRenderConfig(const RenderConfig& config) {
+        config_ = config;
+        colorTablesValid_ = false;
+    }
+
+    /**
+     * @brief Get render configuration
+     * @return Current render configuration
+     */
+    const RenderConfig& getRenderConfig() const { return config_; }
+
+private:
+    /**
+     * @brief A connection selected for drawing
+     */
+    struct DrawnConnection {
+        std::uint32_t layer;        ///< Target layer index
+        std::uint32_t to;           ///< Neuron in the target layer
+        std::uint32_t from;         ///< Neuron in the previous layer
+        float weight;               ///< Connection weight
+    };
+
+    static constexpr std::size_t kWeightBuckets = 64;
+    static constexpr std::size_t kColorTableSize = 256;
+
+    RenderConfig config_;                   ///< Render configuration
+    ColorSchemeManager colorManager_;       ///< Palette source for the color tables
+    FrameGeometry geometry_;                ///< Output of the last build
+
+    // Per-frame working state, kept to reuse allocations
+    std::vector<std::vector<sf::Vector2f>> positions_;      ///< Screen positions per layer
+    std::vector<sf::FloatRect> layerBounds_;                ///< Screen bounds of neuron centers per layer
+    std::vector<std::vector<std::uint8_t>> neuronVisible_;  ///< Neuron visibility per layer
+    std::vector<std::vector<std::uint64_t>> connectionVisible_; ///< Row-major bitmask per layer
+    std::vector<std::vector<sf::Color>> neuronColors_;      ///< Colors of visible neurons
+    std::vector<DrawnConnection> drawnConnections_;         ///< Connections within the budget
+    std::vector<sf::Color> connectionColors_;               ///< Colors of drawn connections
+    std::array<sf::Color, kColorTableSize> activationColors_; ///< Activation in [0, 1] to color
+    std::array<sf::Color, kColorTableSize> weightColors_;   ///< Normalized weight in [-1, 1] to color
+    float maxAbsWeight_ = 0.0f;                             ///< Largest visible |weight|
+    float screenRadius_ = 0.0f;                             ///< Neuron radius in pixels
+    bool colorTablesValid_ = false;                         ///< Tables match config_.colorScheme
+
+    /**
+     * @brief Compute screen positions of all neurons
+     * @param network Network to draw
+     * @param viewport Target viewport
+     */
+    void computeLayout(const core::DefaultNetwork& network, const Viewport& viewport);
+
+    /**
+     * @brief Mark neurons and connections that touch the screen
+     * @param network Network to draw
+     * @param viewport Target viewport
+     */
+    void cull(const core::DefaultNetwork& network, const Viewport& viewport);
+
+    /**
+     * @brief Choose neuron tessellation and the connections to draw
+     * @param network Network to draw
+     */
+    void selectLevelOfDetail(const core::DefaultNetwork& network);
+
+    /**
+     * @brief Color visible neurons and drawn connections
+     * @param network Network to draw
+     */
+    void computeColors(const core::DefaultNetwork& network);
+
+    /**
+     * @brief Emit neuron triangles and connection lines
+     */
+    void generateGeometry();
+
+    /**
+     * @brief Get histogram bucket of a weight magnitude
+     * @param weight Connection weight
+     * @return Bucket in [0, kWeightBuckets)
+     */
+    std::size_t weightBucket(float weight) const;
+};
+
+} // namespace graphics
+} // namespace nnv
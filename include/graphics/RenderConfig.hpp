@@ -15,6 +15,10 @@
 #include "utils/Common.hpp"
 
 namespace nnv {
+namespace utils {
+    class MetricsWriter;
+}
+
 namespace graphics {
 
 /**
@@ -201,6 +205,14 @@ struct RenderStats {
     float fps = 0.0f;                        ///< Frames per second
     int drawCalls = 0;                       ///< Number of draw calls
     std::size_t memoryUsage = 0;             ///< Memory usage in bytes
+    std::uint64_t frameAllocations = 0;      ///< Heap allocations of the main thread in the last frame
+    std::uint64_t frameAllocatedBytes = 0;   ///< Bytes allocated in the last frame
+    
+    /**
+     * @brief Write Prometheus metrics for these statistics
+     * @param out Metrics writer
+     */
+    void writeMetrics(utils::MetricsWriter& out) const;
     
     /**
      * @brief Reset statistics
@@ -18,6 +18,7 @@
 namespace nnv {
 namespace core {
     template<typename T> class NeuralNetwork;
+    template<typename T> class IncrementalEvaluator;
 }
 }
 
@@ -58,7 +59,7 @@ public:
     /**
      * @brief Destructor
      */
-    ~NetworkPanel() override = default;
+    ~NetworkPanel() override;
     
     /**
      * @brief Render the panel
@@ -111,11 +112,44 @@ public:
      * @return New neural network
      */
     std::shared_ptr<core::DefaultNetwork> createNetwork();
+    
+    /**
+     * @brief Set probe input used for interactive what-if edits
+     * @param inputs Input vector fed through the network
+     * @return True if successful
+     */
+    bool setProbeInput(const std::vector<core::Scalar>& inputs);
+    
+    /**
+     * @brief Edit a single weight and incrementally update the probe outputs
+     * @param layer Layer index
+     * @param neuron Neuron index
+     * @param input Input connection index
+     * @param weight New weight value
+     * @return True if successful
+     */
+    bool editWeight(std::size_t layer, std::size_t neuron, std::size_t input, core::Scalar weight);
+    
+    /**
+     * @brief Edit a single bias and incrementally update the probe outputs
+     * @param layer Layer index
+     * @param neuron Neuron index
+     * @param bias New bias value
+     * @return True if successful
+     */
+    bool editBias(std::size_t layer, std::size_t neuron, core::Scalar bias);
+    
+    /**
+     * @brief Get network outputs for the probe input
+     * @return Output vector (empty if no probe input is set)
+     */
+    std::vector<core::Scalar> getProbeOutputs() const;
 
 private:
     std::shared_ptr<core::DefaultNetwork> network_;     ///< Current neural network
     NetworkEditMode editMode_;                          ///< Current edit mode
     bool modified_;                                     ///< Modification flag
+    std::unique_ptr<core::IncrementalEvaluator<core::Scalar>> evaluator_; ///< What-if evaluator
     
     // Editor state
     std::vector<LayerEditor> layerEditors_;             ///< Layer editors
@@ -0,0 +1,146 @@
+/**
+ * @file AlignedAllocator.hpp
+ * @brief Cache-line aligned, huge-page aware allocator with per-category tracking
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <vector>
+
+#include "utils/Common.hpp"
+
+namespace nnv {
+namespace utils {
+
+/**
+ * @brief What a tracked buffer holds
+ */
+enum class MemoryCategory {
+    Weights,
+    OptimizerState,
+    Activations,
+    Workspace,
+    Other,
+    Count
+};
+
+constexpr std::size_t kBufferAlignment = 64;                ///< Cache line / AVX-512 width
+constexpr std::size_t kHugePageSize = 2 * 1024 * 1024;      ///< Transparent huge page size
+
+/**
+ * @brief Raw aligned allocation and per-category byte counters
+ *
+ * Buffers of at least kHugePageSize are aligned to the huge page size and,
+ * on Linux, marked with madvise(MADV_HUGEPAGE) so the kernel can back them
+ * with transparent huge pages. Smaller buffers are aligned to kBufferAlignment.
+ */
+class MemoryTracker {
+public:
+    /**
+     * @brief Allocate an aligned buffer
+     * @param bytes Number of bytes
+     * @param category Tracking category
+     * @return Pointer to the buffer
+     * @throws std::bad_alloc on failure
+     */
+    static void* allocate(std::size_t bytes, MemoryCategory category);
+
+    /**
+     * @brief Free a buffer returned by allocate()
+     * @param ptr Buffer pointer
+     * @param bytes Size passed to allocate()
+     * @param category Category passed to allocate()
+     */
+    static void deallocate(void* ptr, std::size_t bytes, MemoryCategory category) noexcept;
+
+    /**
+     * @brief Get bytes currently allocated in a category
+     * @param category Memory category
+     * @return Live bytes
+     */
+    static std::size_t getAllocatedBytes(MemoryCategory category);
+
+    /**
+     * @brief Get highest number of bytes allocated at once in a category
+     * @param category Memory category
+     * @return Peak bytes
+     */
+    static std::size_t getPeakBytes(MemoryCategory category);
+
+    /**
+     * @brief Get bytes currently allocated in all categories
+     * @return Live bytes
+     */
+    static std::size_t getTotalAllocatedBytes();
+
+    /**
+     * @brief Enable or disable huge-page alignment and advice for large buffers
+     * @param enabled New state (enabled by default)
+     */
+    static void setHugePagesEnabled(bool enabled);
+
+    /**
+     * @brief Check if huge pages are requested for large buffers
+     * @return True if enabled
+     */
+    static bool areHugePagesEnabled();
+
+    /**
+     * @brief Get category name for reports
+     * @param category Memory category
+     * @return Name string
+     */
+    static const char* getCategoryName(MemoryCategory category);
+};
+
+/**
+ * @brief Standard allocator returning 64-byte aligned, tracked memory
+ * @tparam T Element type
+ * @tparam Category Tracking category
+ */
+template<typename T, MemoryCategory Category = MemoryCategory::Other>
+class AlignedAllocator {
+public:
+    using value_type = T;
+
+    template<typename U>
+    struct rebind {
+        using other = AlignedAllocator<U, Category>;
+    };
+
+    AlignedAllocator() noexcept = default;
+
+    template<typename U>
+    AlignedAllocator(const AlignedAllocator<U, Category>&) noexcept {}
+
+    T* allocate(std::size_t n) {
+        if (n > std::numeric_limits<std::size_t>::max() / sizeof(T)) {
+            throw std::bad_alloc();
+        }
+        return static_cast<T*>(MemoryTracker::allocate(n * sizeof(T), Category));
+    }
+
+    void deallocate(T* ptr, std::size_t n) noexcept {
+        MemoryTracker::deallocate(ptr, n * sizeof(T), Category);
+    }
+
+    template<typename U>
+    bool operator==(const AlignedAllocator<U, Category>&) const noexcept { return true; }
+
+    template<typename U>
+    bool operator!=(const AlignedAllocator<U, Category>&) const noexcept { return false; }
+};
+
+/**
+ * @brief Vector backed by AlignedAllocator
+ */
+template<typename T, MemoryCategory Category = MemoryCategory::Other>
+using AlignedVector = std::vector<T, AlignedAllocator<T, Category>>;
+
+} // namespace utils
+} // namespace nnv
@@ -0,0 +1,205 @@
+/**
+ * @file AllocationTracker.hpp
+ * @brief Heap allocation counters per thread and per subsystem
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "utils/Common.hpp"
+
+namespace nnv {
+namespace utils {
+
+/**
+ * @brief Subsystem an allocation is charged to
+ */
+enum class AllocationTag : std::uint8_t {
+    Untagged,       ///< No AllocationScope active
+    Training,       ///< Training steps and runs
+    Rendering,      ///< Frame building and drawing
+    Animation,      ///< Animation updates
+    UI,             ///< UI panels
+    DataLoading,    ///< Dataset loading
+    Logging,        ///< Log formatting and writing
+    Metrics,        ///< Metrics collection and export
+    Count
+};
+
+/**
+ * @brief Get display name of an allocation tag
+ * @param tag Allocation tag
+ * @return Tag name
+ */
+const char* getAllocationTagName(AllocationTag tag);
+
+/**
+ * @brief Allocation and deallocation counts
+ */
+struct AllocationCounts {
+    std::uint64_t allocations = 0;      ///< Calls to operator new
+    std::uint64_t deallocations = 0;    ///< Calls to operator delete
+    std::uint64_t bytes = 0;            ///< Bytes requested from operator new
+
+    AllocationCounts& operator+=(const AllocationCounts& other) {
+        allocations += other.allocations;
+        deallocations += other.deallocations;
+        bytes += other.bytes;
+        return *this;
+    }
+
+    /**
+     * @brief Get the counts accumulated since an earlier reading
+     * @param earlier Earlier reading of the same counters
+     * @return Difference
+     */
+    AllocationCounts operator-(const AllocationCounts& earlier) const {
+        AllocationCounts result;
+        result.allocations = allocations - earlier.allocations;
+        result.deallocations = deallocations - earlier.deallocations;
+        result.bytes = bytes - earlier.bytes;
+        return result;
+    }
+};
+
+/**
+ * @brief Counts heap allocations made through global operator new/delete
+ *
+ * Counting needs the replacement operators in AllocationHooks.cpp, which are
+ * linked only into targets that opt in (the tests always, the application
+ * with NNV_ENABLE_ALLOCATION_TRACKING). Without them every count stays zero
+ * and isAvailable() returns false.
+ *
+ * Each thread updates its own counters with plain relaxed stores; totals per
+ * subsystem sum the slots of all threads that ever allocated, so they also
+ * include threads that have exited. Allocations are charged to the tag of the
+ * innermost AllocationScope on the allocating thread, deallocations to the
+ * tag active where the memory is freed.
+ */
+class AllocationTracker {
+public:
+    /**
+     * @brief Check if the allocation hooks are linked in
+     * @return True if allocations are counted
+     */
+    static bool isAvailable();
+
+    /**
+     * @brief Get cumulative counts of the calling thread
+     * @return Counts over all tags
+     */
+    static AllocationCounts threadCounts();
+
+    /**
+     * @brief Get cumulative counts of all threads for one subsystem
+     * @param tag Allocation tag
+     * @return Counts charged to the tag
+     */
+    static AllocationCounts totalCounts(AllocationTag tag);
+
+    /**
+     * @brief Get cumulative counts of all threads and tags
+     * @return Process-wide counts
+     */
+    static AllocationCounts totalCounts();
+
+    /**
+     * @brief Get the tag allocations of the calling thread are charged to
+     * @return Current tag
+     */
+    static AllocationTag currentTag();
+
+    /**
+     * @brief Set the tag of the calling thread
+     * @param tag New tag
+     * @return Previous tag
+     * @note Prefer AllocationScope, which restores the previous tag
+     */
+    static AllocationTag setCurrentTag(AllocationTag tag);
+
+    /**
+     * @brief Count one allocation (called by the hooks)
+     * @param bytes Requested size
+     */
+    static void recordAllocation(std::size_t bytes) noexcept;
+
+    /**
+     * @brief Count one deallocation (called by the hooks)
+     */
+    static void recordDeallocation() noexcept;
+
+    /**
+     * @brief Mark the hooks as linked (called once by the hooks)
+     */
+    static void markAvailable() noexcept;
+};
+
+/**
+ * @brief Charges allocations of the enclosing scope to a subsystem
+ */
+class AllocationScope {
+public:
+    explicit AllocationScope(AllocationTag tag)
+        : previous_(AllocationTracker::setCurrentTag(tag)) {}
+
+    ~AllocationScope() {
+        AllocationTracker::setCurrentTag(previous_);
+    }
+
+    // Disable copy and move
+    NNV_DISABLE_COPY_AND_MOVE(AllocationScope)
+
+private:
+    AllocationTag previous_;
+};
+
+/**
+ * @brief Counts the allocations of the calling thread since construction
+ *
+ * Used to measure one training step or frame, and by tests to assert
+ * allocation budgets:
+ * @code
+ * utils::AllocationProbe probe;
+ * network.trainBatch(inputs, targets);
+ * EXPECT_EQ(probe.counts().allocations, 0u);
+ * @endcode
+ */
+class AllocationProbe {
+public:
+    AllocationProbe() : start_(AllocationTracker::threadCounts()) {}
+
+    /**
+     * @brief Get the counts since construction or the last reset()
+     * @return Allocation counts
+     */
+    AllocationCounts counts() const {
+        return AllocationTracker::threadCounts() - start_;
+    }
+
+    /**
+     * @brief Restart counting from now
+     */
+    void reset() {
+        start_ = AllocationTracker::threadCounts();
+    }
+
+private:
+    AllocationCounts start_;
+};
+
+} // namespace utils
+} // namespace nnv
+
+#define NNV_ALLOCATION_CONCAT_IMPL(a, b) a##b
+#define NNV_ALLOCATION_CONCAT(a, b) NNV_ALLOCATION_CONCAT_IMPL(a, b)
+
+/**
+ * @brief Charge allocations until the end of the scope to a subsystem
+ * @param tag AllocationTag enumerator name, e.g. Training
+ */
+#define NNV_ALLOCATION_SCOPE(tag) \
+    ::nnv::utils::AllocationScope NNV_ALLOCATION_CONCAT(nnvAllocationScope, __LINE__)(::nnv::utils::AllocationTag::tag)
@@ -0,0 +1,221 @@
+/**
+ * @file BinaryDataset.hpp
+ * @brief Native memory-mapped binary dataset format (.nnvd)
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "utils/Common.hpp"
+#include "utils/DataLoader.hpp"
+
+namespace nnv {
+namespace utils {
+
+/**
+ * @brief Element type of the arrays in a .nnvd file
+ */
+enum class DatasetElementType : std::uint8_t {
+    UInt8 = 1,      ///< Unsigned byte, decoded as value * scale
+    Float16 = 2,    ///< IEEE 754 half precision
+    Float32 = 3     ///< IEEE 754 single precision
+};
+
+/**
+ * @brief Get display name of a dataset element type
+ * @param type Element type
+ * @return "u8", "f16", "f32" or "unknown"
+ */
+const char* getDatasetElementTypeName(DatasetElementType type);
+
+/**
+ * @brief Get size of a dataset element type
+ * @param type Element type
+ * @return Bytes per element (0 for unknown types)
+ */
+std::size_t getDatasetElementSize(DatasetElementType type);
+
+/**
+ * @brief How a mapped dataset will be read, passed to madvise
+ */
+enum class DatasetAccess {
+    Sequential,     ///< In file order: aggressive read-ahead, pages dropped behind
+    Random          ///< Shuffled order: no read-ahead
+};
+
+/**
+ * @brief On-disk header of a .nnvd file (little endian, 64 bytes)
+ *
+ * The input array (sampleCount x inputDim, row-major) starts at inputOffset,
+ * the target array (sampleCount x targetDim) at targetOffset; both offsets
+ * are multiples of kArrayAlignment so each array starts on its own page.
+ * Class names, if any, follow as newline-separated UTF-8 text in label
+ * index order.
+ */
+struct BinaryDatasetHeader {
+    static constexpr char kMagic[4] = {'N', 'N', 'V', 'D'};
+    static constexpr std::uint16_t kVersion = 1;
+    static constexpr std::uint64_t kArrayAlignment = 4096;
+
+    char magic[4];                      ///< "NNVD"
+    std::uint16_t version;              ///< Format version
+    DatasetElementType inputType;       ///< Input element type
+    DatasetElementType targetType;      ///< Target element type
+    std::uint64_t sampleCount;          ///< Number of samples
+    std::uint32_t inputDim;             ///< Features per sample
+    std::uint32_t targetDim;            ///< Target values per sample
+    float inputScale;                   ///< Multiplier for UInt8 inputs
+    float targetScale;                  ///< Multiplier for UInt8 targets
+    std::uint64_t inputOffset;          ///< File offset of the input array
+    std::uint64_t targetOffset;         ///< File offset of the target array
+    std::uint64_t labelsOffset;         ///< File offset of the class names
+    std::uint64_t labelsSize;           ///< Bytes of class names (0 if none)
+};
+
+static_assert(sizeof(BinaryDatasetHeader) == 64, "BinaryDatasetHeader layout must match the file format");
+
+/**
+ * @brief Options for writing a .nnvd file
+ */
+struct BinaryDatasetOptions {
+    DatasetElementType inputType = DatasetElementType::Float32;  ///< Input element type
+    DatasetElementType targetType = DatasetElementType::Float32; ///< Target element type
+    float inputScale = 1.0f / 255.0f;   ///< Value of one UInt8 input step
+    float targetScale = 1.0f;           ///< Value of one UInt8 target step
+};
+
+/**
+ * @brief Write a dataset as a .nnvd file
+ * @param dataset Dataset (all inputs and all targets must have equal sizes)
+ * @param filename Output path
+ * @param options Element types and scales
+ * @return True if successful
+ *
+ * UInt8 values are rounded to the nearest step and clamped to [0, 255];
+ * Float16 values are rounded to nearest even.
+ */
+template<typename T>
+bool writeBinaryDataset(const Dataset<T>& dataset, const std::string& filename,
+                        const BinaryDatasetOptions& options = {});
+
+/**
+ * @brief Read-only memory mapping of a .nnvd file
+ *
+ * Opening validates the header and maps the file; no sample data is read,
+ * so opening is O(1) and the page cache is shared by every process that
+ * maps the same file. Samples are decoded into caller-provided buffers on
+ * access. On platforms without mmap the file is read into memory instead.
+ */
+class MappedDataset {
+public:
+    MappedDataset() = default;
+
+    /**
+     * @brief Destructor (unmaps the file)
+     */
+    ~MappedDataset();
+
+    // Disable copy and move
+    NNV_DISABLE_COPY_AND_MOVE(MappedDataset)
+
+    /**
+     * @brief Map a .nnvd file
+     * @param filename File path
+     * @param access Expected access pattern; pass Random when batches will
+     *        be read in shuffled order, since the caller alone knows
+     * @return False if the file is missing, truncated, has misaligned arrays
+     *         or is not a .nnvd file
+     */
+    bool open(const std::string& filename, DatasetAccess access = DatasetAccess::Sequential);
+
+    /**
+     * @brief Unmap the file
+     */
+    void close();
+
+    /**
+     * @brief Check if a file is mapped
+     * @return True if open
+     */
+    bool isOpen() const { return data_ != nullptr; }
+
+    /**
+     * @brief Change the access hint, e.g. before a shuffled epoch
+     * @param access Expected access pattern
+     */
+    void setAccessPattern(DatasetAccess access);
+
+    std::size_t size() const { return static_cast<std::size_t>(header_.sampleCount); }
+    std::size_t getInputDim() const { return header_.inputDim; }
+    std::size_t getTargetDim() const { return header_.targetDim; }
+    DatasetElementType getInputType() const { return header_.inputType; }
+    DatasetElementType getTargetType() const { return header_.targetType; }
+
+    /**
+     * @brief Get class names stored in the file
+     * @return Names in label index order (empty if none)
+     */
+    const std::vector<std::string>& getClassNames() const { return classNames_; }
+
+    /**
+     * @brief Get the raw input array
+     * @return Pointer to sampleCount x inputDim elements of getInputType()
+     */
+    const void* getRawInputs() const { return data_ ? data_ + header_.inputOffset : nullptr; }
+
+    /**
+     * @brief Get the raw target array
+     * @return Pointer to sampleCount x targetDim elements of getTargetType()
+     */
+    const void* getRawTargets() const { return data_ ? data_ + header_.targetOffset : nullptr; }
+
+    /**
+     * @brief Decode one sample's inputs
+     * @param index Sample index (< size())
+     * @param out Destination with getInputDim() elements
+     */
+    template<typename T>
+    void readInput(std::size_t index, T* out) const;
+
+    /**
+     * @brief Decode one sample's targets
+     * @param index Sample index (< size())
+     * @param out Destination with getTargetDim() elements
+     */
+    template<typename T>
+    void readTarget(std::size_t index, T* out) const;
+
+    /**
+     * @brief Decode a batch into reusable vectors
+     * @param indices Sample indices
+     * @param count Number of indices
+     * @param inputs Resized to count x inputDim (no allocation once sized)
+     * @param targets Resized to count x targetDim
+     */
+    template<typename T>
+    void readBatch(const std::size_t* indices, std::size_t count,
+                   std::vector<std::vector<T>>& inputs, std::vector<std::vector<T>>& targets) const;
+
+    /**
+     * @brief Decode the whole file into a Dataset
+     * @return Dataset with labelMap filled from the class names
+     */
+    template<typename T>
+    Dataset<T> toDataset() const;
+
+private:
+    const unsigned char* data_ = nullptr;
+    std::size_t fileSize_ = 0;
+    std::vector<unsigned char> fallback_;   ///< File contents where mmap is unavailable
+    BinaryDatasetHeader header_{};
+    std::vector<std::string> classNames_;
+};
+
+} // namespace utils
+} // namespace nnv
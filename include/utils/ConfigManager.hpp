@@ -143,6 +143,8 @@ public:
     bool getWindowVSync() const { return get<bool>("window.vsync", true); }
     int getTargetFPS() const { return get<int>("rendering.target_fps", 60); }
     std::string getTheme() const { return get<std::string>("ui.theme", "dark"); }
+    int getMetricsPort() const { return get<int>("metrics.port", 0); }
+    std::string getMetricsBindAddress() const { return get<std::string>("metrics.bind_address", "127.0.0.1"); }
     
 private:
     nlohmann::json config_;
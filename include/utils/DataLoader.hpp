@@ -135,6 +135,18 @@ public:
                       char delimiter = ',',
                       int targetColumn = -1);
     
+    /**
+     * @brief Load a .nnvd binary dataset
+     * @param filename .nnvd file path
+     * @return Loaded dataset
+     * @note Copies every sample in file order, so the mapping is always
+     *       opened with DatasetAccess::Sequential; PreprocessingConfig::shuffle
+     *       reorders the in-memory copy afterwards. Use MappedDataset with
+     *       DatasetAccess::Random to read shuffled batches straight from the
+     *       mapping
+     */
+    Dataset<T> loadBinary(const std::string& filename);
+    
     /**
      * @brief Load MNIST data
      * @param imagesFile MNIST images file path
@@ -210,7 +222,7 @@ public:
      * @brief Save dataset to file
      * @param dataset Dataset to save
      * @param filename Output file path
-     * @param format Output format
+     * @param format Output format (CSV or Binary; Binary writes f32 .nnvd)
      * @return True if successful
      */
     bool saveToFile(const Dataset<T>& dataset,
@@ -0,0 +1,219 @@
+/**
+ * @file EpochReclamation.hpp
+ * @brief Epoch-based reclamation and RCU-style versioned pointers
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "utils/Common.hpp"
+
+namespace nnv {
+namespace utils {
+
+/**
+ * @brief Tracks which epochs readers are pinned to
+ *
+ * Readers claim one of a fixed set of slots and record the global epoch they
+ * entered at. The writer advances the epoch when it retires an object and may
+ * free it once no slot is pinned at or before the epoch it was retired in.
+ */
+class EpochDomain {
+public:
+    static constexpr std::size_t kMaxReaders = 64; ///< Concurrently pinned readers
+
+    /**
+     * @brief Pins the current epoch for the lifetime of the guard
+     */
+    class Guard {
+    public:
+        Guard() = default;
+        explicit Guard(std::atomic<std::uint64_t>* slot) : slot_(slot) {}
+        ~Guard() { release(); }
+
+        Guard(Guard&& other) noexcept : slot_(std::exchange(other.slot_, nullptr)) {}
+        Guard& operator=(Guard&& other) noexcept {
+            if (this != &other) {
+                release();
+                slot_ = std::exchange(other.slot_, nullptr);
+            }
+            return *this;
+        }
+
+        // Disable copy
+        NNV_DISABLE_COPY(Guard)
+
+        /**
+         * @brief Unpin early
+         */
+        void release() {
+            if (slot_) {
+                slot_->store(kIdle);
+                slot_ = nullptr;
+            }
+        }
+
+    private:
+        std::atomic<std::uint64_t>* slot_ = nullptr;
+    };
+
+    EpochDomain() = default;
+    ~EpochDomain() = default;
+
+    // Disable copy and move
+    NNV_DISABLE_COPY_AND_MOVE(EpochDomain)
+
+    /**
+     * @brief Enter a read-side critical section (any thread)
+     * @return Guard that unpins on destruction
+     *
+     * Yields while all kMaxReaders slots are in use.
+     */
+    Guard pin();
+
+    /**
+     * @brief Advance the global epoch (writer)
+     * @return Epoch that objects unlinked before this call belong to
+     */
+    std::uint64_t advance() { return epoch_.fetch_add(1); }
+
+    /**
+     * @brief Check if objects retired in an epoch can be freed (writer)
+     * @param retiredEpoch Value returned by advance()
+     * @return True if no reader is pinned at or before that epoch
+     */
+    bool isQuiescent(std::uint64_t retiredEpoch) const;
+
+    /**
+     * @brief Get current global epoch
+     * @return Epoch counter (starts at 1)
+     */
+    std::uint64_t getEpoch() const { return epoch_.load(); }
+
+private:
+    static constexpr std::uint64_t kIdle = 0;
+
+    struct alignas(64) Slot {
+        std::atomic<std::uint64_t> epoch{kIdle};
+    };
+
+    std::atomic<std::uint64_t> epoch_{1};
+    std::array<Slot, kMaxReaders> slots_;
+};
+
+/**
+ * @brief Pointer to an immutable value replaced by one writer, read lock-free
+ *
+ * The writer publishes a new version with an atomic pointer swap; the old
+ * version is retired and deleted only after every reader that could have
+ * seen it has released its guard. Readers never block the writer and the
+ * writer never waits for readers.
+ *
+ * @tparam T Published value type
+ */
+template<typename T>
+class RcuPointer {
+public:
+    /**
+     * @brief Read access to one published version
+     */
+    class ReadGuard {
+    public:
+        ReadGuard() = default;
+        ReadGuard(EpochDomain::Guard guard, const T* value, std::uint64_t version)
+            : guard_(std::move(guard)), value_(value), version_(version) {}
+
+        const T* get() const { return value_; }
+        const T& operator*() const { return *value_; }
+        const T* operator->() const { return value_; }
+        explicit operator bool() const { return value_ != nullptr; }
+
+        /**
+         * @brief Get version number of the pinned value
+         * @return Publish counter at the time it was published
+         */
+        std::uint64_t version() const { return version_; }
+
+    private:
+        EpochDomain::Guard guard_;
+        const T* value_ = nullptr;
+        std::uint64_t version_ = 0;
+    };
+
+    RcuPointer() = default;
+
+    /**
+     * @brief Destructor; no readers may still hold guards
+     */
+    ~RcuPointer() { delete current_.load(); }
+
+    // Disable copy and move
+    NNV_DISABLE_COPY_AND_MOVE(RcuPointer)
+
+    /**
+     * @brief Pin and return the current version (any thread)
+     * @return Guard; empty if nothing was published yet
+     */
+    ReadGuard read() const {
+        auto guard = domain_.pin();
+        const Node* node = current_.load();
+        return node ? ReadGuard(std::move(guard), node->value.get(), node->version) : ReadGuard();
+    }
+
+    /**
+     * @brief Replace the current version (single writer)
+     * @param value New value (nullptr clears)
+     */
+    void publish(std::unique_ptr<T> value) {
+        Node* node = value ? new Node{std::move(value), ++version_} : nullptr;
+        Node* old = current_.exchange(node);
+
+        if (old) {
+            retired_.emplace_back(domain_.advance(), std::unique_ptr<Node>(old));
+        }
+        reclaim();
+    }
+
+    /**
+     * @brief Delete retired versions no reader can still see (writer)
+     * @return Number of versions still awaiting reclamation
+     */
+    std::size_t reclaim() {
+        std::size_t kept = 0;
+        for (auto& entry : retired_) {
+            if (!domain_.isQuiescent(entry.first)) {
+                retired_[kept++] = std::move(entry);
+            }
+        }
+        retired_.resize(kept);
+        return kept;
+    }
+
+    /**
+     * @brief Get number of publishes
+     * @return Version of the most recent publish
+     */
+    std::uint64_t version() const { return version_; }
+
+private:
+    struct Node {
+        std::unique_ptr<T> value;
+        std::uint64_t version;
+    };
+
+    mutable EpochDomain domain_;
+    std::atomic<Node*> current_{nullptr};
+    std::uint64_t version_ = 0;                                         ///< Writer-only
+    std::vector<std::pair<std::uint64_t, std::unique_ptr<Node>>> retired_; ///< Writer-only
+};
+
+} // namespace utils
+} // namespace nnv
@@ -0,0 +1,341 @@
+/**
+ * @file EventLog.hpp
+ * @brief Compact binary structured event log for training runs
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#include "utils/Common.hpp"
+
+namespace nnv {
+namespace utils {
+
+/**
+ * @brief Kinds of records in an event log
+ */
+enum class EventType : std::uint16_t {
+    RunStart = 1,       ///< Run configuration (JSON text)
+    RunEnd = 2,         ///< RunEndEvent
+    Step = 3,           ///< StepEvent
+    Epoch = 4,          ///< EpochEvent
+    Checkpoint = 5,     ///< CheckpointEvent, text is the file path
+    Timing = 6,         ///< TimingEvent, text is the timer name
+    Message = 7         ///< Free-form text
+};
+
+/**
+ * @brief Get display name of an event type
+ * @param type Event type
+ * @return Lower-case name ("step", "epoch", ...), "unknown" for other values
+ */
+const char* getEventTypeName(EventType type);
+
+/**
+ * @brief One optimizer step
+ */
+struct StepEvent {
+    std::uint64_t step = 0;             ///< Optimizer steps taken after this batch
+    std::uint64_t samples = 0;          ///< Samples in the batch
+    std::uint64_t nanos = 0;            ///< Wall time of the batch
+    double loss = 0.0;                  ///< Mean loss over the batch
+    double learningRate = 0.0;          ///< Learning rate used
+    double gradientNorm = 0.0;          ///< Global gradient norm (NaN if not gathered)
+};
+
+/**
+ * @brief One completed epoch
+ */
+struct EpochEvent {
+    std::uint64_t epoch = 0;            ///< Zero-based epoch index
+    std::uint64_t step = 0;             ///< Optimizer steps taken after this epoch
+    double trainLoss = 0.0;             ///< Mean batch loss
+    double trainAccuracy = 0.0;         ///< Accuracy on the training set
+    double valLoss = 0.0;               ///< Validation loss (NaN without validation data)
+    double valAccuracy = 0.0;           ///< Validation accuracy (NaN without validation data)
+    double seconds = 0.0;               ///< Wall time of the epoch including evaluation
+};
+
+/**
+ * @brief A model written to disk
+ */
+struct CheckpointEvent {
+    std::uint64_t step = 0;             ///< Optimizer steps taken when saved
+};
+
+/**
+ * @brief A named duration
+ */
+struct TimingEvent {
+    std::uint64_t nanos = 0;            ///< Total duration
+    std::uint64_t count = 0;            ///< Occurrences folded into nanos
+};
+
+/**
+ * @brief End of a training run
+ */
+struct RunEndEvent {
+    std::uint64_t epochs = 0;           ///< Completed epochs
+    std::uint64_t steps = 0;            ///< Optimizer steps taken
+    std::uint64_t stopped = 0;          ///< 1 if stopped before the requested epochs
+};
+
+/**
+ * @brief Append-only writer of length-prefixed binary event records
+ *
+ * Each record is a 24-byte header (size, type, payload and text lengths,
+ * timestamp) followed by a fixed payload struct and optional text, padded
+ * to 8 bytes. On POSIX systems the file is memory mapped and grown by
+ * doubling, so appending is a copy into the page cache: no formatting, no
+ * system call, and records survive a process crash. The size word is stored
+ * last and unused space is zero, so readers stop cleanly at a torn record.
+ * Elsewhere records are buffered and written in blocks.
+ *
+ * Calls are serialized by an internal mutex; the training thread is
+ * normally the only writer, so it is uncontended.
+ */
+class EventLog {
+public:
+    static constexpr char kMagic[8] = {'N', 'N', 'V', 'E', 'V', 'L', 'O', 'G'};
+    static constexpr std::uint32_t kVersion = 1;
+
+    /**
+     * @brief File header
+     */
+    struct FileHeader {
+        char magic[8];                  ///< kMagic
+        std::uint32_t version;          ///< kVersion
+        std::uint32_t headerSize;       ///< sizeof(FileHeader)
+        std::int64_t startNanos;        ///< System time of open(), ns since the Unix epoch
+        std::uint64_t reserved;
+    };
+
+    /**
+     * @brief Header in front of every record
+     */
+    struct RecordHeader {
+        std::uint32_t size;             ///< Whole record in bytes (multiple of 8, 0 = end)
+        std::uint16_t type;             ///< EventType
+        std::uint16_t payloadSize;      ///< Bytes of the payload struct
+        std::uint32_t textSize;         ///< Bytes of text after the payload
+        std::uint32_t reserved;
+        std::int64_t timestampNanos;    ///< System time, ns since the Unix epoch
+    };
+
+    EventLog() = default;
+
+    /**
+     * @brief Destructor (closes the file)
+     */
+    ~EventLog();
+
+    // Disable copy and move
+    NNV_DISABLE_COPY_AND_MOVE(EventLog)
+
+    /**
+     * @brief Create or truncate a log file
+     * @param path File path
+     * @param initialCapacity Bytes mapped up front (grows by doubling)
+     * @return True if successful
+     */
+    bool open(const std::string& path, std::size_t initialCapacity = std::size_t(1) << 20);
+
+    /**
+     * @brief Write outstanding data and trim the file to its records
+     */
+    void close();
+
+    /**
+     * @brief Check if a file is open
+     * @return True if open
+     */
+    bool isOpen() const;
+
+    /**
+     * @brief Hand written records to the operating system for writing back
+     */
+    void flush();
+
+    /**
+     * @brief Get path of the open file
+     * @return File path (empty if closed)
+     */
+    const std::string& getPath() const { return path_; }
+
+    /**
+     * @brief Get number of records written since open()
+     * @return Record count
+     */
+    std::uint64_t getRecordCount() const;
+
+    /**
+     * @brief Get bytes used in the file, including the header
+     * @return File size after close()
+     */
+    std::uint64_t getSize() const;
+
+    /**
+     * @brief Record the start of a run
+     * @param configJson Run configuration as JSON text
+     */
+    void logRunStart(const std::string& configJson);
+
+    /**
+     * @brief Record the end of a run
+     * @param event Completed epochs and steps
+     */
+    void logRunEnd(const RunEndEvent& event);
+
+    /**
+     * @brief Record one optimizer step
+     * @param event Step metrics
+     */
+    void logStep(const StepEvent& event);
+
+    /**
+     * @brief Record one completed epoch
+     * @param event Epoch metrics
+     */
+    void logEpoch(const EpochEvent& event);
+
+    /**
+     * @brief Record a model written to disk
+     * @param step Optimizer steps taken
+     * @param path File path
+     */
+    void logCheckpoint(std::uint64_t step, const std::string& path);
+
+    /**
+     * @brief Record a named duration
+     * @param name Timer name
+     * @param nanos Total duration
+     * @param count Occurrences folded into nanos
+     */
+    void logTiming(const std::string& name, std::uint64_t nanos, std::uint64_t count = 1);
+
+    /**
+     * @brief Record free-form text
+     * @param text Message
+     */
+    void logMessage(const std::string& text);
+
+private:
+    mutable std::mutex mutex_;
+    std::string path_;
+    std::uint64_t recordCount_ = 0;
+    std::size_t used_ = 0;              ///< Bytes written, including the file header
+
+#ifdef NNV_PLATFORM_WINDOWS
+    std::FILE* file_ = nullptr;
+    std::vector<char> buffer_;          ///< Records not yet written to file_
+#else
+    int fd_ = -1;
+    char* mapping_ = nullptr;
+    std::size_t capacity_ = 0;          ///< Bytes mapped (and file size while open)
+
+    /**
+     * @brief Grow the file and mapping to hold more bytes
+     * @param required Total bytes needed
+     * @return False if the file could not be grown
+     */
+    bool grow(std::size_t required);
+#endif
+
+    /**
+     * @brief Append one record
+     * @param type Event type
+     * @param payload Payload struct bytes
+     * @param payloadSize Payload size
+     * @param text Text bytes (may be null when textSize is 0)
+     * @param textSize Text size
+     */
+    void append(EventType type, const void* payload, std::size_t payloadSize,
+                const char* text, std::size_t textSize);
+};
+
+/**
+ * @brief One decoded record
+ *
+ * Owns copies of its payload and text, so it stays valid after the reader
+ * is destroyed; reusing one record across next() calls reuses its capacity.
+ */
+struct EventRecord {
+    EventType type = EventType::Message;
+    std::int64_t timestampNanos = 0;
+    std::vector<char> payload;
+    std::string text;
+
+    /**
+     * @brief Copy the payload into its struct
+     * @tparam Payload Payload struct of this event type
+     * @param out Destination; fields missing from an older, shorter payload keep their values
+     * @return False if the record has no payload
+     */
+    template<typename Payload>
+    bool get(Payload& out) const {
+        if (payload.empty()) {
+            return false;
+        }
+        std::memcpy(&out, payload.data(), std::min(payload.size(), sizeof(Payload)));
+        return true;
+    }
+};
+
+/**
+ * @brief Sequential reader of an event log file
+ */
+class EventLogReader {
+public:
+    /**
+     * @brief Load a log file
+     * @param path File path
+     * @return False if the file is missing or not an event log
+     */
+    bool open(const std::string& path);
+
+    /**
+     * @brief Decode the next record
+     * @param out Destination
+     * @return False at the end of the log (or at a torn record)
+     */
+    bool next(EventRecord& out);
+
+    /**
+     * @brief Get time the log was opened for writing
+     * @return Nanoseconds since the Unix epoch
+     */
+    std::int64_t getStartNanos() const { return startNanos_; }
+
+    /**
+     * @brief Check whether reading stopped at an incomplete record
+     * @return True if the log ends with a partially written record
+     */
+    bool isTruncated() const { return truncated_; }
+
+private:
+    std::vector<char> data_;
+    std::size_t offset_ = 0;
+    std::int64_t startNanos_ = 0;
+    bool truncated_ = false;
+};
+
+/**
+ * @brief Convert a record into a flat JSON object
+ * @param record Decoded record
+ * @param startNanos Log start time; "time" is reported in seconds since it
+ * @return Object with "type", "time" and the payload fields
+ */
+nlohmann::json eventToJson(const EventRecord& record, std::int64_t startNanos);
+
+} // namespace utils
+} // namespace nnv
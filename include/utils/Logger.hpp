@@ -8,10 +8,17 @@
 #pragma once
 
 #include <string>
+#include <algorithm>
+#include <atomic>
+#include <limits>
 #include <memory>
 #include <fstream>
 #include <mutex>
 #include <sstream>
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <vector>
 
 #ifdef HAS_SPDLOG
 #include <spdlog/spdlog.h>
@@ -23,6 +30,17 @@
 #include <fmt/format.h>
 #endif
 
+/**
+ * @brief Lowest level compiled into the NNV_LOG_* macros
+ *
+ * 0 = Debug, 1 = Info, 2 = Warning, 3 = Error, 4 = Critical, 5 = none.
+ * Calls below it are removed entirely; set through the CMake cache variable
+ * of the same name.
+ */
+#ifndef NNV_LOG_COMPILE_LEVEL
+#define NNV_LOG_COMPILE_LEVEL 0
+#endif
+
 namespace nnv {
 namespace utils {
 
@@ -37,8 +55,35 @@ enum class LogLevel {
     Critical = 4
 };
 
+/**
+ * @brief What a logging thread does when the asynchronous queue is full
+ */
+enum class LogOverflowPolicy {
+    Drop,   ///< Discard the record and count it (callers never wait)
+    Block   ///< Wait until the writer thread makes room (no record is lost)
+};
+
+/**
+ * @brief Options for asynchronous logging
+ */
+struct AsyncLogOptions {
+    std::size_t queueCapacity = 8192;                           ///< Records buffered (rounded up to a power of two)
+    LogOverflowPolicy overflowPolicy = LogOverflowPolicy::Drop; ///< Behaviour when the queue is full
+    std::chrono::milliseconds flushInterval{200};               ///< Longest time a written line stays unflushed
+    bool flushOnCrash = true;                                   ///< Drain the queue from fatal signal handlers
+};
+
+class AsyncLogBackend;
+
 /**
  * @brief Main logging class
+ *
+ * Logging is synchronous by default: every call formats and writes its line
+ * under a global lock. After enableAsync() callers only capture a timestamp
+ * and push the record into a bounded lock-free queue; a writer thread formats
+ * records in batches, writes them to the sinks and flushes at most every
+ * flushInterval (immediately for errors). The queue is drained on
+ * disableAsync(), shutdown(), process exit and, optionally, fatal signals.
  */
 class Logger {
 public:
@@ -67,6 +112,49 @@ public:
      */
     static void log(LogLevel level, const std::string& message);
     
+    /**
+     * @brief Check a level against the runtime minimum (one relaxed atomic load)
+     * @param level Log level
+     * @return True if a message at this level would be written
+     */
+    static bool isEnabled(LogLevel level) {
+        return static_cast<int>(level) >= runtimeLevel_.load(std::memory_order_relaxed);
+    }
+    
+    /**
+     * @brief Switch to asynchronous logging (no-op if already enabled)
+     * @param options Queue size, overflow policy and flush behaviour
+     */
+    static void enableAsync(const AsyncLogOptions& options = AsyncLogOptions());
+    
+    /**
+     * @brief Write all queued records, stop the writer thread and log synchronously again
+     */
+    static void disableAsync();
+    
+    /**
+     * @brief Check whether asynchronous logging is enabled
+     * @return True if records go through the writer thread
+     */
+    static bool isAsync();
+    
+    /**
+     * @brief Write and flush everything logged before this call
+     */
+    static void flush();
+    
+    /**
+     * @brief Get number of records discarded by the Drop overflow policy
+     * @return Dropped records since asynchronous logging was last enabled
+     */
+    static std::uint64_t getDroppedCount();
+    
+    /**
+     * @brief Get number of records waiting for the writer thread
+     * @return Queued records (0 when logging synchronously)
+     */
+    static std::size_t getQueueDepth();
+    
     /**
      * @brief Log a debug message
      * @param message Message to log
@@ -102,14 +190,29 @@ public:
      */
     template<typename... Args>
     static void log(LogLevel level, const std::string& format, Args&&... args) {
-#ifdef HAS_FMT
-        log(level, fmt::format(format, std::forward<Args>(args)...));
-#else
-        // Simple fallback formatting
-        std::ostringstream oss;
-        oss << format;
-        log(level, oss.str());
-#endif
+        if (!isEnabled(level)) {
+            return;
+        }
+        log(level, formatMessage(format, std::forward<Args>(args)...));
+    }
+    
+    /**
+     * @brief Log a formatted message on behalf of similar messages that were skipped
+     * @param level Log level
+     * @param suppressed Similar messages skipped since the last one written
+     * @param format Message format
+     * @param args Format arguments
+     */
+    template<typename... Args>
+    static void logSuppressed(LogLevel level, std::uint64_t suppressed, const std::string& format, Args&&... args) {
+        if (!isEnabled(level)) {
+            return;
+        }
+        std::string message = formatMessage(format, std::forward<Args>(args)...);
+        if (suppressed > 0) {
+            message += " (suppressed " + std::to_string(suppressed) + " similar messages)";
+        }
+        log(level, message);
     }
     
     template<typename... Args>
@@ -138,8 +241,37 @@ public:
     }
 
 private:
+    friend class AsyncLogBackend;
+    
+    /**
+     * @brief A log call captured on the caller's thread
+     */
+    struct Record {
+        LogLevel level = LogLevel::Info;
+        std::chrono::system_clock::time_point time;
+        std::string message;
+    };
+    
     static std::unique_ptr<Logger> instance_;
     static std::mutex mutex_;
+    static std::atomic<int> runtimeLevel_;     ///< Minimum level as int; above Critical while uninitialized
+    
+    template<typename... Args>
+    static std::string formatMessage(const std::string& format, Args&&... args) {
+        if constexpr (sizeof...(Args) == 0) {
+            return format;
+        } else {
+#ifdef HAS_FMT
+            return fmt::format(format, std::forward<Args>(args)...);
+#else
+            // Simple fallback formatting
+            (static_cast<void>(args), ...);
+            std::ostringstream oss;
+            oss << format;
+            return oss.str();
+#endif
+        }
+    }
     
     Logger() = default;
     ~Logger() = default;
@@ -149,24 +281,216 @@ private:
     void setLevelImpl(LogLevel level);
     void logImpl(LogLevel level, const std::string& message);
     
+    /**
+     * @brief Write one record to the sinks without flushing
+     * @param record Record to write
+     */
+    void writeImpl(const Record& record);
+    
+    /**
+     * @brief Flush all sinks
+     */
+    void flushImpl();
+    
+    /**
+     * @brief Write records from the asynchronous queue
+     * @param records Records in queue order
+     * @param flush Flush the sinks afterwards
+     * @param lock Take the logger mutex (false only when crashing)
+     */
+    static void writeBatch(const std::vector<Record>& records, bool flush, bool lock);
+    
     std::string levelToString(LogLevel level) const;
-    std::string getCurrentTimestamp() const;
+    std::string formatTimestamp(std::chrono::system_clock::time_point time);
+    
+    LogLevel currentLevel_ = LogLevel::Info;
+    std::time_t cachedSecond_ = -1;     ///< Second of cachedDateTime_
+    std::string cachedDateTime_;        ///< Formatted date and time of cachedSecond_
     
 #ifdef HAS_SPDLOG
     std::shared_ptr<spdlog::logger> spdlogger_;
 #else
     std::unique_ptr<std::ofstream> fileStream_;
-    LogLevel currentLevel_ = LogLevel::Info;
     bool consoleOutput_ = true;
 #endif
 };
 
+/**
+ * @brief Token bucket of one rate-limited logging call site
+ *
+ * Implemented as a generic cell rate algorithm: a single atomic "theoretical
+ * arrival time" stands for both the token count and the refill time, so any
+ * thread decides with one compare-and-swap and never takes a lock. Rejected
+ * calls are counted and reported with the next message that gets through.
+ */
+class LogRateLimiter {
+public:
+    /**
+     * @brief Constructor
+     * @param perSecond Sustained messages per second (> 0)
+     * @param burst Messages allowed back to back
+     */
+    LogRateLimiter(double perSecond, std::uint32_t burst) {
+        const double interval = 1e9 / std::max(perSecond, 1e-6);
+        const double tolerance = interval * static_cast<double>(std::max<std::uint32_t>(burst, 1));
+        const double limit = static_cast<double>(std::numeric_limits<std::int64_t>::max() / 4);
+        intervalNanos_ = static_cast<std::int64_t>(std::min(interval, limit));
+        toleranceNanos_ = static_cast<std::int64_t>(std::min(tolerance, limit));
+    }
+
+    /**
+     * @brief Take a token if one is available
+     * @param suppressed Set to the calls rejected since the last accepted one
+     * @return True if the message should be written
+     */
+    bool tryAcquire(std::uint64_t& suppressed) {
+        const std::int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+        return tryAcquireAt(now, suppressed);
+    }
+
+    /**
+     * @brief Take a token at an explicit time (tests drive the clock)
+     * @param now Current time in nanoseconds on a monotonic clock
+     * @param suppressed Set to the calls rejected since the last accepted one
+     * @return True if the message should be written
+     */
+    bool tryAcquireAt(std::int64_t now, std::uint64_t& suppressed) {
+        std::int64_t arrival = arrival_.load(std::memory_order_relaxed);
+
+        for (;;) {
+            const std::int64_t next = std::max(arrival, now) + intervalNanos_;
+            if (next - now > toleranceNanos_) {
+                suppressed_.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            if (arrival_.compare_exchange_weak(arrival, next, std::memory_order_relaxed)) {
+                break;
+            }
+        }
+
+        suppressed = suppressed_.exchange(0, std::memory_order_relaxed);
+        return true;
+    }
+
+private:
+    std::int64_t intervalNanos_ = 0;            ///< Time one token takes to refill
+    std::int64_t toleranceNanos_ = 0;           ///< Burst expressed as time
+    std::atomic<std::int64_t> arrival_{0};      ///< Theoretical arrival time of the next message
+    std::atomic<std::uint64_t> suppressed_{0};  ///< Rejected since the last accepted message
+};
+
+/**
+ * @brief Occurrence counter of one sampled logging call site
+ */
+class LogEveryN {
+public:
+    /**
+     * @brief Count an occurrence
+     * @param n Sampling period (1 writes every occurrence)
+     * @param suppressed Set to the occurrences skipped before this one
+     * @return True for the 1st, (n+1)th, (2n+1)th... occurrence
+     */
+    bool shouldLog(std::uint64_t n, std::uint64_t& suppressed) {
+        const std::uint64_t count = count_.fetch_add(1, std::memory_order_relaxed);
+        if (n <= 1) {
+            suppressed = 0;
+            return true;
+        }
+        if (count % n != 0) {
+            return false;
+        }
+        suppressed = count == 0 ? 0 : n - 1;
+        return true;
+    }
+
+private:
+    std::atomic<std::uint64_t> count_{0};
+};
+
 } // namespace utils
 } // namespace nnv
 
-// Convenience macros for logging
-#define NNV_LOG_DEBUG(msg, ...) nnv::utils::Logger::debug(msg, ##__VA_ARGS__)
-#define NNV_LOG_INFO(msg, ...) nnv::utils::Logger::info(msg, ##__VA_ARGS__)
-#define NNV_LOG_WARNING(msg, ...) nnv::utils::Logger::warning(msg, ##__VA_ARGS__)
-#define NNV_LOG_ERROR(msg, ...) nnv::utils::Logger::error(msg, ##__VA_ARGS__)
-#define NNV_LOG_CRITICAL(msg, ...) nnv::utils::Logger::critical(msg, ##__VA_ARGS__)
+// Convenience macros for logging. The level is checked before the arguments
+// are evaluated or formatted; levels below NNV_LOG_COMPILE_LEVEL compile to nothing.
+#define NNV_LOG_ENABLED(level) \
+    (static_cast<int>(level) >= NNV_LOG_COMPILE_LEVEL && nnv::utils::Logger::isEnabled(level))
+
+#define NNV_LOG_AT(level, msg, ...) \
+    do { \
+        if (NNV_LOG_ENABLED(level)) { \
+            nnv::utils::Logger::log(level, msg, ##__VA_ARGS__); \
+        } \
+    } while (0)
+
+// Still type-checks the call so arguments used only for logging stay referenced
+#define NNV_LOG_DISCARD(msg, ...) \
+    do { \
+        if (false) { \
+            nnv::utils::Logger::log(nnv::utils::LogLevel::Debug, msg, ##__VA_ARGS__); \
+        } \
+    } while (0)
+
+#if NNV_LOG_COMPILE_LEVEL <= 0
+#define NNV_LOG_DEBUG(msg, ...) NNV_LOG_AT(nnv::utils::LogLevel::Debug, msg, ##__VA_ARGS__)
+#else
+#define NNV_LOG_DEBUG(msg, ...) NNV_LOG_DISCARD(msg, ##__VA_ARGS__)
+#endif
+
+#if NNV_LOG_COMPILE_LEVEL <= 1
+#define NNV_LOG_INFO(msg, ...) NNV_LOG_AT(nnv::utils::LogLevel::Info, msg, ##__VA_ARGS__)
+#else
+#define NNV_LOG_INFO(msg, ...) NNV_LOG_DISCARD(msg, ##__VA_ARGS__)
+#endif
+
+#if NNV_LOG_COMPILE_LEVEL <= 2
+#define NNV_LOG_WARNING(msg, ...) NNV_LOG_AT(nnv::utils::LogLevel::Warning, msg, ##__VA_ARGS__)
+#else
+#define NNV_LOG_WARNING(msg, ...) NNV_LOG_DISCARD(msg, ##__VA_ARGS__)
+#endif
+
+#if NNV_LOG_COMPILE_LEVEL <= 3
+#define NNV_LOG_ERROR(msg, ...) NNV_LOG_AT(nnv::utils::LogLevel::Error, msg, ##__VA_ARGS__)
+#else
+#define NNV_LOG_ERROR(msg, ...) NNV_LOG_DISCARD(msg, ##__VA_ARGS__)
+#endif
+
+#if NNV_LOG_COMPILE_LEVEL <= 4
+#define NNV_LOG_CRITICAL(msg, ...) NNV_LOG_AT(nnv::utils::LogLevel::Critical, msg, ##__VA_ARGS__)
+#else
+#define NNV_LOG_CRITICAL(msg, ...) NNV_LOG_DISCARD(msg, ##__VA_ARGS__)
+#endif
+
+// Sampled and rate-limited logging for hot paths. State is per call site (and
+// per template instantiation); the next message written from a site reports
+// how many were skipped before it.
+#define NNV_LOG_EVERY_N(level, n, msg, ...) \
+    do { \
+        if (NNV_LOG_ENABLED(level)) { \
+            static nnv::utils::LogEveryN nnvLogSite; \
+            std::uint64_t nnvSuppressed = 0; \
+            if (nnvLogSite.shouldLog(n, nnvSuppressed)) { \
+                nnv::utils::Logger::logSuppressed(level, nnvSuppressed, msg, ##__VA_ARGS__); \
+            } \
+        } \
+    } while (0)
+
+#define NNV_LOG_RATE_LIMITED(level, perSecond, burst, msg, ...) \
+    do { \
+        if (NNV_LOG_ENABLED(level)) { \
+            static nnv::utils::LogRateLimiter nnvLogSite(perSecond, burst); \
+            std::uint64_t nnvSuppressed = 0; \
+            if (nnvLogSite.tryAcquire(nnvSuppressed)) { \
+                nnv::utils::Logger::logSuppressed(level, nnvSuppressed, msg, ##__VA_ARGS__); \
+            } \
+        } \
+    } while (0)
+
+#define NNV_LOG_WARNING_EVERY_N(n, msg, ...) \
+    NNV_LOG_EVERY_N(nnv::utils::LogLevel::Warning, n, msg, ##__VA_ARGS__)
+#define NNV_LOG_WARNING_RATE_LIMITED(perSecond, burst, msg, ...) \
+    NNV_LOG_RATE_LIMITED(nnv::utils::LogLevel::Warning, perSecond, burst, msg, ##__VA_ARGS__)
+#define NNV_LOG_ERROR_EVERY_N(n, msg, ...) \
+    NNV_LOG_EVERY_N(nnv::utils::LogLevel::Error, n, msg, ##__VA_ARGS__)
+#define NNV_LOG_ERROR_RATE_LIMITED(perSecond, burst, msg, ...) \
+    NNV_LOG_RATE_LIMITED(nnv::utils::LogLevel::Error, perSecond, burst, msg, ##__VA_ARGS__)
@@ -0,0 +1,49 @@
+/**
+ * @file MachinePeaks.hpp
+ * @brief Measured single-thread compute and memory bandwidth peaks
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace nnv {
+namespace utils {
+
+/**
+ * @brief Roofs of the roofline model
+ */
+struct MachinePeaks {
+    double gflops = 0.0;    ///< Peak single-precision GFLOP/s of one thread
+    double gbps = 0.0;      ///< Sustained memory bandwidth of one thread in GB/s
+    std::string computeRoof;  ///< Source of gflops, e.g. "avx2 fma probe" or "--peak-gflops"
+
+    /**
+     * @brief Get the intensity where the memory and compute roofs meet
+     * @return FLOP per byte (0 if not measured)
+     */
+    double ridgeIntensity() const { return gbps > 0.0 ? gflops / gbps : 0.0; }
+};
+
+/**
+ * @brief Measure machine peaks with short built-in probes
+ * @param arrayBytes Size of each bandwidth array; use several times the last-level cache
+ * @param repetitions Runs per probe (the best run is kept, as STREAM does)
+ * @return Measured peaks
+ *
+ * Bandwidth is the STREAM triad a[i] = b[i] + s * c[i] over three arrays,
+ * counting 12 bytes per float element. Compute peak runs independent
+ * multiply-add chains with explicit intrinsics for the widest ISA the CPU
+ * reports (AVX-512 FMA, AVX2 FMA, then SSE2 on x86), independent of the
+ * build's -m flags, so it is the hardware roof rather than what the
+ * compiler made of the layers; other targets fall back to a portable loop
+ * built with the layer flags. MachinePeaks::computeRoof names the probe.
+ * Both probes use the calling thread only, like training.
+ */
+MachinePeaks measureMachinePeaks(std::size_t arrayBytes = std::size_t{64} << 20, int repetitions = 5);
+
+} // namespace utils
+} // namespace nnv
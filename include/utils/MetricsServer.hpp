@@ -0,0 +1,232 @@
+/**
+ * @file MetricsServer.hpp
+ * @brief Prometheus text-format metrics and an embedded HTTP endpoint
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "utils/Common.hpp"
+
+namespace nnv {
+namespace utils {
+
+/// Label name/value pairs of one sample
+using MetricLabels = std::vector<std::pair<std::string, std::string>>;
+
+/**
+ * @brief Builds a Prometheus text exposition (format version 0.0.4)
+ *
+ * Samples are grouped by metric family in order of first use, so several
+ * collectors may write the same family (e.g. one per model) and the output
+ * still has one HELP/TYPE header per family with all its samples together.
+ */
+class MetricsWriter {
+public:
+    /**
+     * @brief Write a monotonically increasing value
+     * @param name Metric name (should end in _total)
+     * @param help Description
+     * @param value Current value
+     * @param labels Sample labels
+     */
+    void counter(const std::string& name, const std::string& help, double value,
+                 const MetricLabels& labels = {});
+
+    /**
+     * @brief Write a value that can go up and down
+     * @param name Metric name
+     * @param help Description
+     * @param value Current value
+     * @param labels Sample labels
+     */
+    void gauge(const std::string& name, const std::string& help, double value,
+               const MetricLabels& labels = {});
+
+    /**
+     * @brief Write a cumulative histogram
+     * @param name Metric name (without _bucket/_sum/_count)
+     * @param help Description
+     * @param upperBounds Bucket upper bounds in increasing order (+Inf is added)
+     * @param counts Observations per bucket (not cumulative), same size as upperBounds
+     * @param sum Sum of all observations
+     * @param count Number of observations, including those above the last bound
+     * @param labels Sample labels
+     */
+    void histogram(const std::string& name, const std::string& help,
+                   const std::vector<double>& upperBounds, const std::vector<std::uint64_t>& counts,
+                   double sum, std::uint64_t count, const MetricLabels& labels = {});
+
+    /**
+     * @brief Write quantiles of a distribution
+     * @param name Metric name (without _sum/_count)
+     * @param help Description
+     * @param quantiles Pairs of quantile in [0, 1] and value
+     * @param sum Sum of all observations
+     * @param count Number of observations
+     * @param labels Sample labels
+     */
+    void summary(const std::string& name, const std::string& help,
+                 const std::vector<std::pair<double, double>>& quantiles,
+                 double sum, std::uint64_t count, const MetricLabels& labels = {});
+
+    /**
+     * @brief Get the exposition text
+     * @return All families written so far
+     */
+    std::string str() const;
+
+private:
+    struct Family {
+        std::string name;
+        std::string help;
+        const char* type;
+        std::string samples;
+    };
+
+    std::vector<Family> families_;
+
+    /**
+     * @brief Find or add a family
+     * @return Family to append samples to
+     */
+    Family& family(const std::string& name, const std::string& help, const char* type);
+
+    /**
+     * @brief Append one sample line
+     */
+    static void appendSample(std::string& out, const std::string& name, const MetricLabels& labels,
+                             const char* extraLabel, const std::string& extraValue, double value);
+};
+
+/**
+ * @brief Set of callbacks that write metrics when scraped
+ *
+ * Collectors read state that is already published for other threads
+ * (atomics, snapshot buffers), so nothing is gathered between scrapes.
+ */
+class MetricsRegistry {
+public:
+    using Collector = std::function<void(MetricsWriter&)>;
+
+    /**
+     * @brief Add a collector (any thread)
+     * @param collector Callback run on every scrape, on the server thread
+     * @return Id for remove()
+     */
+    std::size_t add(Collector collector);
+
+    /**
+     * @brief Remove a collector (any thread); waits for a scrape in progress
+     * @param id Value returned by add()
+     */
+    void remove(std::size_t id);
+
+    /**
+     * @brief Run all collectors
+     * @return Exposition text
+     */
+    std::string collect() const;
+
+private:
+    mutable std::mutex mutex_;
+    std::vector<std::pair<std::size_t, Collector>> collectors_;
+    std::size_t nextId_ = 1;
+};
+
+/**
+ * @brief Add logger queue and memory tracker metrics
+ * @param registry Registry to add the collector to
+ * @return Collector id
+ */
+std::size_t addProcessMetrics(MetricsRegistry& registry);
+
+/**
+ * @brief Minimal HTTP server answering GET /metrics from a background thread
+ *
+ * Binds to the loopback interface by default, handles one connection at a
+ * time and closes it after the response, which is all a Prometheus scraper
+ * or `curl http://127.0.0.1:<port>/metrics` needs. Not available on Windows.
+ */
+class MetricsServer {
+public:
+    MetricsServer() = default;
+
+    /**
+     * @brief Destructor (stops the server)
+     */
+    ~MetricsServer();
+
+    // Disable copy and move
+    NNV_DISABLE_COPY_AND_MOVE(MetricsServer)
+
+    /**
+     * @brief Start listening
+     * @param port TCP port (0 picks a free port, see getPort())
+     * @param bindAddress IPv4 address to bind
+     * @return True if listening
+     */
+    bool start(std::uint16_t port, const std::string& bindAddress = "127.0.0.1");
+
+    /**
+     * @brief Stop listening and join the server thread
+     */
+    void stop();
+
+    /**
+     * @brief Check if the server is listening
+     * @return True if running
+     */
+    bool isRunning() const { return running_.load(); }
+
+    /**
+     * @brief Get the bound port
+     * @return Port number (0 if not running)
+     */
+    std::uint16_t getPort() const { return port_; }
+
+    /**
+     * @brief Get number of metrics requests served
+     * @return Scrape count
+     */
+    std::uint64_t getScrapeCount() const { return scrapes_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Get the collectors served by this server
+     * @return Registry
+     */
+    MetricsRegistry& getRegistry() { return registry_; }
+
+private:
+    MetricsRegistry registry_;
+    std::thread thread_;
+    std::atomic<bool> running_{false};
+    std::atomic<std::uint64_t> scrapes_{0};
+    std::uint16_t port_ = 0;
+    int listenFd_ = -1;
+    int wakeFds_[2] = {-1, -1};         ///< Self-pipe that interrupts poll() on stop()
+
+    /**
+     * @brief Accept loop (server thread)
+     */
+    void serve();
+
+    /**
+     * @brief Read one request and write the response
+     * @param fd Connected socket
+     */
+    void handleConnection(int fd);
+};
+
+} // namespace utils
+} // namespace nnv
@@ -0,0 +1,158 @@
+/**
+ * @file MpscRingBuffer.hpp
+ * @brief Fixed-capacity lock-free multi-producer/single-consumer queue
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+#include "utils/Common.hpp"
+
+namespace nnv {
+namespace utils {
+
+/**
+ * @brief Bounded ring buffer for any number of producers and one consumer
+ *
+ * Each slot carries a sequence number telling whether it is free for the
+ * producer claiming that position or holds an element for the consumer.
+ * Producers claim positions with one compare-and-swap on the tail and never
+ * wait on each other's copies; the consumer owns the head alone. A push into
+ * a full ring fails instead of waiting and leaves its argument untouched, so
+ * the caller can retry or drop it.
+ *
+ * @tparam T Element type (default-constructible, move-assignable)
+ */
+template<typename T>
+class MpscRingBuffer {
+public:
+    /**
+     * @brief Constructor
+     * @param capacity Minimum number of elements (rounded up to a power of two)
+     */
+    explicit MpscRingBuffer(std::size_t capacity) {
+        std::size_t size = 2;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        slots_ = std::make_unique<Slot[]>(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            slots_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        capacity_ = size;
+        mask_ = size - 1;
+    }
+
+    ~MpscRingBuffer() = default;
+
+    // Disable copy and move
+    NNV_DISABLE_COPY_AND_MOVE(MpscRingBuffer)
+
+    /**
+     * @brief Append an element (any thread)
+     * @param value Element to move in; unchanged if the push fails
+     * @return False if the ring is full
+     */
+    bool tryPush(T&& value) {
+        std::uint64_t tail = tail_.load(std::memory_order_relaxed);
+        Slot* slot = nullptr;
+
+        for (;;) {
+            slot = &slots_[tail & mask_];
+            const std::uint64_t sequence = slot->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::int64_t>(sequence - tail);
+
+            if (diff == 0) {
+                if (tail_.compare_exchange_weak(tail, tail + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                // Slot still holds the element from one lap ago
+                return false;
+            } else {
+                tail = tail_.load(std::memory_order_relaxed);
+            }
+        }
+
+        slot->value = std::move(value);
+        slot->sequence.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Append a copy of an element (any thread)
+     * @param value Element to copy in
+     * @return False if the ring is full
+     */
+    bool tryPush(const T& value) {
+        T copy(value);
+        return tryPush(std::move(copy));
+    }
+
+    /**
+     * @brief Remove the oldest element (consumer thread)
+     * @param out Destination
+     * @return False if the ring is empty or the oldest push is still being written
+     */
+    bool tryPop(T& out) {
+        const std::uint64_t head = head_.load(std::memory_order_relaxed);
+        Slot& slot = slots_[head & mask_];
+        if (slot.sequence.load(std::memory_order_acquire) != head + 1) {
+            return false;
+        }
+
+        out = std::move(slot.value);
+        slot.sequence.store(head + capacity_, std::memory_order_release);
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Get approximate number of queued elements (any thread)
+     * @return Element count, including pushes still being written
+     */
+    std::size_t size() const {
+        const std::uint64_t head = head_.load(std::memory_order_acquire);
+        const std::uint64_t tail = tail_.load(std::memory_order_acquire);
+        return tail > head ? static_cast<std::size_t>(tail - head) : 0;
+    }
+
+    /**
+     * @brief Get number of positions claimed by producers so far (any thread)
+     * @return Successful pushes, including ones still being written
+     */
+    std::uint64_t totalPushed() const { return tail_.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Get number of elements removed so far (any thread)
+     * @return Successful pops
+     */
+    std::uint64_t totalPopped() const { return head_.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Get capacity
+     * @return Maximum number of queued elements
+     */
+    std::size_t capacity() const { return capacity_; }
+
+private:
+    struct Slot {
+        std::atomic<std::uint64_t> sequence{0};
+        T value{};
+    };
+
+    std::unique_ptr<Slot[]> slots_;
+    std::size_t capacity_ = 0;
+    std::uint64_t mask_ = 0;
+    alignas(64) std::atomic<std::uint64_t> tail_{0};
+    alignas(64) std::atomic<std::uint64_t> head_{0};
+};
+
+} // namespace utils
+} // namespace nnv
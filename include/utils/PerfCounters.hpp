@@ -0,0 +1,167 @@
+/**
+ * @file PerfCounters.hpp
+ * @brief Hardware performance counters of the calling thread (Linux perf_event_open)
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+#include "utils/Common.hpp"
+
+namespace nnv {
+namespace utils {
+
+/**
+ * @brief Hardware events counted by PerfCounterGroup
+ */
+enum class HardwareCounter {
+    Cycles,             ///< CPU cycles
+    Instructions,       ///< Retired instructions
+    CacheReferences,    ///< Last-level cache references
+    CacheMisses,        ///< Last-level cache misses
+    Branches,           ///< Retired branch instructions
+    BranchMisses,       ///< Mispredicted branches
+    Count
+};
+
+/**
+ * @brief Get display name of a hardware counter
+ * @param counter Hardware counter
+ * @return Counter name
+ */
+const char* getHardwareCounterName(HardwareCounter counter);
+
+/**
+ * @brief Counts of the hardware events, with a mask of the ones measured
+ */
+struct HardwareCounterValues {
+    static constexpr std::size_t kCount = static_cast<std::size_t>(HardwareCounter::Count);
+
+    std::array<std::uint64_t, kCount> counts{};     ///< Event counts
+    std::uint32_t validMask = 0;                    ///< Bit i set if counts[i] was measured
+
+    std::uint64_t operator[](HardwareCounter counter) const {
+        return counts[static_cast<std::size_t>(counter)];
+    }
+
+    /**
+     * @brief Check if a counter was measured
+     * @param counter Hardware counter
+     * @return True if valid
+     */
+    bool isValid(HardwareCounter counter) const {
+        return (validMask >> static_cast<std::size_t>(counter)) & 1u;
+    }
+
+    /**
+     * @brief Add the events counted between two readings
+     * @param start Earlier reading
+     * @param end Later reading of the same group
+     */
+    void addDelta(const HardwareCounterValues& start, const HardwareCounterValues& end);
+
+    /**
+     * @brief Get instructions per cycle
+     * @return IPC (NaN if not measured)
+     */
+    double ipc() const { return ratio(HardwareCounter::Instructions, HardwareCounter::Cycles); }
+
+    /**
+     * @brief Get last-level cache miss rate
+     * @return Misses per reference (NaN if not measured)
+     */
+    double cacheMissRate() const { return ratio(HardwareCounter::CacheMisses, HardwareCounter::CacheReferences); }
+
+    /**
+     * @brief Get branch misprediction rate
+     * @return Misses per branch (NaN if not measured)
+     */
+    double branchMissRate() const { return ratio(HardwareCounter::BranchMisses, HardwareCounter::Branches); }
+
+    /**
+     * @brief Get last-level cache misses per thousand instructions
+     * @return MPKI (NaN if not measured)
+     */
+    double cacheMissesPerKiloInstruction() const {
+        return ratio(HardwareCounter::CacheMisses, HardwareCounter::Instructions) * 1000.0;
+    }
+
+private:
+    double ratio(HardwareCounter numerator, HardwareCounter denominator) const;
+};
+
+/**
+ * @brief Group of hardware counters for the thread that opened it
+ *
+ * All events are scheduled together so ratios compare the same instructions.
+ * Only user-space events are counted, which perf_event_paranoid <= 2 allows
+ * without privileges. Events the CPU or hypervisor does not provide are left
+ * out; if the leader (cycles) cannot be opened, e.g. in a container without
+ * PMU access, open() fails and getError() says why. When the kernel
+ * multiplexes the group, counts are scaled by time enabled / time running.
+ *
+ * Each read() is one system call (about a microsecond), so per-layer
+ * readings suit diagnostic runs, not production training.
+ */
+class PerfCounterGroup {
+public:
+    /**
+     * @brief Constructor (counters start closed)
+     */
+    PerfCounterGroup();
+
+    /**
+     * @brief Destructor (closes the counters)
+     */
+    ~PerfCounterGroup();
+
+    // Disable copy and move
+    NNV_DISABLE_COPY_AND_MOVE(PerfCounterGroup)
+
+    /**
+     * @brief Open and start the counters for the calling thread
+     * @return False if hardware counters are not available
+     */
+    bool open();
+
+    /**
+     * @brief Stop and close the counters
+     */
+    void close();
+
+    /**
+     * @brief Check if the counters are open
+     * @return True if open
+     */
+    bool isOpen() const { return leader_ >= 0; }
+
+    /**
+     * @brief Read cumulative counts since open()
+     * @param out Counts of the measured events
+     * @return False if the group is closed or the read failed
+     */
+    bool read(HardwareCounterValues& out) const;
+
+    /**
+     * @brief Get the reason the last open() failed
+     * @return Error description (empty after a successful open)
+     */
+    const std::string& getError() const { return error_; }
+
+private:
+    static constexpr std::size_t kCount = HardwareCounterValues::kCount;
+
+    int leader_ = -1;
+    std::array<int, kCount> fds_;
+    std::array<HardwareCounter, kCount> order_;     ///< Counter of each value in a group read
+    std::size_t openCount_ = 0;
+    std::string error_;
+};
+
+} // namespace utils
+} // namespace nnv
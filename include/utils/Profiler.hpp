@@ -0,0 +1,152 @@
+/**
+ * @file Profiler.hpp
+ * @brief Scoped instrumentation profiler with Chrome trace export
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "utils/Common.hpp"
+
+namespace nnv {
+namespace utils {
+
+/**
+ * @brief One completed profiling scope
+ */
+struct ProfileEvent {
+    const char* name = nullptr;         ///< Scope name (string literal)
+    const char* category = nullptr;     ///< Category (string literal)
+    std::uint64_t startNanos = 0;       ///< Start, nanoseconds since profiler start
+    std::uint64_t durationNanos = 0;    ///< Duration in nanoseconds
+};
+
+/**
+ * @brief Collects scope events into per-thread buffers
+ *
+ * Every thread appends to its own chunked buffer without locks or atomic
+ * read-modify-write operations; the exporter reads published event counts.
+ * Names and categories must be string literals (or otherwise outlive the
+ * profiler) because only the pointers are stored.
+ */
+class Profiler {
+public:
+    static constexpr std::size_t kMaxEventsPerThread = 1u << 20; ///< Uncleared events per thread; further ones are dropped
+
+    /**
+     * @brief Enable or disable recording at runtime (enabled by default)
+     * @param enabled Whether scopes record events
+     */
+    static void setEnabled(bool enabled);
+
+    /**
+     * @brief Check if recording is enabled
+     * @return True if enabled
+     */
+    static bool isEnabled();
+
+    /**
+     * @brief Get current timestamp
+     * @return Nanoseconds since the profiler started
+     */
+    static std::uint64_t now();
+
+    /**
+     * @brief Record a completed scope on the calling thread
+     * @param name Scope name
+     * @param category Scope category
+     * @param startNanos Start timestamp from now()
+     * @param endNanos End timestamp from now()
+     */
+    static void record(const char* name, const char* category,
+                       std::uint64_t startNanos, std::uint64_t endNanos);
+
+    /**
+     * @brief Name the calling thread in exported traces
+     * @param name Thread name
+     */
+    static void setThreadName(const std::string& name);
+
+    /**
+     * @brief Write all recorded events as Chrome trace_event JSON
+     * @param filename Output path (open in chrome://tracing or Perfetto)
+     * @return True if successful
+     */
+    static bool writeChromeTrace(const std::string& filename);
+
+    /**
+     * @brief Write a Chrome trace when the process exits
+     * @param filename Output path
+     */
+    static void writeChromeTraceAtExit(const std::string& filename);
+
+    /**
+     * @brief Get number of recorded events across all threads
+     * @return Event count
+     */
+    static std::size_t getEventCount();
+
+    /**
+     * @brief Get number of events dropped because a thread buffer was full
+     * @return Dropped event count
+     */
+    static std::size_t getDroppedCount();
+
+    /**
+     * @brief Discard recorded events (buffers keep their memory)
+     *
+     * Frees every thread's slots for reuse, so a long-running process that
+     * clears periodically keeps recording within the same memory.
+     */
+    static void clear();
+};
+
+/**
+ * @brief Records the enclosing scope as one profile event
+ */
+class ProfileScope {
+public:
+    ProfileScope(const char* name, const char* category = "nnv")
+        : name_(name), category_(category), active_(Profiler::isEnabled())
+        , start_(active_ ? Profiler::now() : 0) {}
+
+    ~ProfileScope() {
+        if (active_) {
+            Profiler::record(name_, category_, start_, Profiler::now());
+        }
+    }
+
+    // Disable copy and move
+    NNV_DISABLE_COPY_AND_MOVE(ProfileScope)
+
+private:
+    const char* name_;
+    const char* category_;
+    bool active_;
+    std::uint64_t start_;
+};
+
+} // namespace utils
+} // namespace nnv
+
+#define NNV_PROFILE_CONCAT_IMPL(a, b) a##b
+#define NNV_PROFILE_CONCAT(a, b) NNV_PROFILE_CONCAT_IMPL(a, b)
+
+// Instrumentation compiles to nothing unless NNV_ENABLE_PROFILING is defined
+#if defined(NNV_ENABLE_PROFILING)
+    #define NNV_PROFILE_SCOPE(name) \
+        ::nnv::utils::ProfileScope NNV_PROFILE_CONCAT(nnvProfileScope, __LINE__)(name)
+    #define NNV_PROFILE_SCOPE_CAT(name, category) \
+        ::nnv::utils::ProfileScope NNV_PROFILE_CONCAT(nnvProfileScope, __LINE__)(name, category)
+    #define NNV_PROFILE_FUNCTION() NNV_PROFILE_SCOPE(__func__)
+    #define NNV_PROFILE_THREAD(name) ::nnv::utils::Profiler::setThreadName(name)
+#else
+    #define NNV_PROFILE_SCOPE(name) ((void)0)
+    #define NNV_PROFILE_SCOPE_CAT(name, category) ((void)0)
+    #define NNV_PROFILE_FUNCTION() ((void)0)
+    #define NNV_PROFILE_THREAD(name) ((void)0)
+#endif
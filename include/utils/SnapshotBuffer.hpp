@@ -0,0 +1,113 @@
+/**
+ * @file SnapshotBuffer.hpp
+ * @brief Lock-free single-writer snapshot publication
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "utils/Common.hpp"
+
+namespace nnv {
+namespace utils {
+
+/**
+ * @brief Double-buffered value published by one writer and polled by many readers
+ *
+ * The writer fills the back buffer and flips the front index. It never waits:
+ * if a slow reader is still copying the back buffer the publish is skipped and
+ * the caller simply tries again later. Readers pin the front buffer with a
+ * reader count and retry if the writer flipped it in between, so they never
+ * take a lock either.
+ *
+ * @tparam T Snapshot type (copy-assignable)
+ */
+template<typename T>
+class SnapshotBuffer {
+public:
+    SnapshotBuffer() = default;
+    ~SnapshotBuffer() = default;
+
+    // Disable copy and move
+    NNV_DISABLE_COPY_AND_MOVE(SnapshotBuffer)
+
+    /**
+     * @brief Publish a new value (single writer)
+     * @param fill Callable invoked as fill(T&) to write the back buffer in place
+     * @return False if the back buffer was still being read and nothing was published
+     */
+    template<typename Fill>
+    bool tryPublishWith(Fill&& fill) {
+        const int back = 1 - front_.load();
+        if (slots_[back].readers.load() != 0) {
+            return false;
+        }
+
+        fill(slots_[back].value);
+        front_.store(back);
+        version_.fetch_add(1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Publish a copy of a value (single writer)
+     * @param value Value to publish
+     * @return False if the publish was skipped
+     */
+    bool tryPublish(const T& value) {
+        return tryPublishWith([&value](T& slot) { slot = value; });
+    }
+
+    /**
+     * @brief Copy the latest published value
+     * @param out Destination (its capacity is reused)
+     */
+    void read(T& out) const {
+        for (;;) {
+            const int index = front_.load();
+            slots_[index].readers.fetch_add(1);
+
+            if (front_.load() == index) {
+                out = slots_[index].value;
+                slots_[index].readers.fetch_sub(1);
+                return;
+            }
+
+            // Writer flipped between the load and the pin; try again
+            slots_[index].readers.fetch_sub(1);
+        }
+    }
+
+    /**
+     * @brief Copy the latest published value
+     * @return Snapshot copy
+     */
+    T read() const {
+        T out{};
+        read(out);
+        return out;
+    }
+
+    /**
+     * @brief Get number of successful publishes
+     * @return Publish counter (0 if nothing was published yet)
+     */
+    std::uint64_t version() const { return version_.load(std::memory_order_acquire); }
+
+private:
+    struct Slot {
+        T value{};
+        mutable std::atomic<int> readers{0};
+    };
+
+    Slot slots_[2];
+    std::atomic<int> front_{0};
+    std::atomic<std::uint64_t> version_{0};
+};
+
+} // namespace utils
+} // namespace nnv
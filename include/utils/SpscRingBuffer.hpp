@@ -0,0 +1,121 @@
+/**
+ * @file SpscRingBuffer.hpp
+ * @brief Fixed-capacity lock-free single-producer/single-consumer queue
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "utils/Common.hpp"
+
+namespace nnv {
+namespace utils {
+
+/**
+ * @brief Bounded ring buffer for one producer thread and one consumer thread
+ *
+ * Head and tail live on separate cache lines and each side caches the other's
+ * index, so an uncontended push or pop touches no shared line. A push into a
+ * full ring fails instead of waiting: producers never block on consumers.
+ *
+ * @tparam T Element type (default-constructible, copy-assignable)
+ */
+template<typename T>
+class SpscRingBuffer {
+public:
+    /**
+     * @brief Constructor
+     * @param capacity Minimum number of elements (rounded up to a power of two)
+     */
+    explicit SpscRingBuffer(std::size_t capacity) {
+        std::size_t size = 2;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        slots_.resize(size);
+        mask_ = size - 1;
+    }
+
+    ~SpscRingBuffer() = default;
+
+    // Disable copy and move
+    NNV_DISABLE_COPY_AND_MOVE(SpscRingBuffer)
+
+    /**
+     * @brief Append an element (producer thread)
+     * @param value Element to copy in
+     * @return False if the ring is full and the element was dropped
+     */
+    bool tryPush(const T& value) {
+        const std::uint64_t tail = producer_.tail.load(std::memory_order_relaxed);
+        if (tail - producer_.cachedHead > mask_) {
+            producer_.cachedHead = consumer_.head.load(std::memory_order_acquire);
+            if (tail - producer_.cachedHead > mask_) {
+                return false;
+            }
+        }
+
+        slots_[tail & mask_] = value;
+        producer_.tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Remove the oldest element (consumer thread)
+     * @param out Destination
+     * @return False if the ring is empty
+     */
+    bool tryPop(T& out) {
+        const std::uint64_t head = consumer_.head.load(std::memory_order_relaxed);
+        if (head == consumer_.cachedTail) {
+            consumer_.cachedTail = producer_.tail.load(std::memory_order_acquire);
+            if (head == consumer_.cachedTail) {
+                return false;
+            }
+        }
+
+        out = slots_[head & mask_];
+        consumer_.head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Get approximate number of queued elements (any thread)
+     * @return Element count
+     */
+    std::size_t size() const {
+        const std::uint64_t head = consumer_.head.load(std::memory_order_acquire);
+        const std::uint64_t tail = producer_.tail.load(std::memory_order_acquire);
+        return static_cast<std::size_t>(tail - head);
+    }
+
+    /**
+     * @brief Get capacity
+     * @return Maximum number of queued elements
+     */
+    std::size_t capacity() const { return slots_.size(); }
+
+private:
+    struct alignas(64) ProducerState {
+        std::atomic<std::uint64_t> tail{0};
+        std::uint64_t cachedHead = 0;
+    };
+
+    struct alignas(64) ConsumerState {
+        std::atomic<std::uint64_t> head{0};
+        std::uint64_t cachedTail = 0;
+    };
+
+    std::vector<T> slots_;
+    std::uint64_t mask_ = 0;
+    ProducerState producer_;
+    ConsumerState consumer_;
+};
+
+} // namespace utils
+} // namespace nnv
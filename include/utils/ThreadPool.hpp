@@ -0,0 +1,155 @@
+/**
+ * @file ThreadPool.hpp
+ * @brief Fixed-size worker pool and cooperative cancellation tokens
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "utils/Common.hpp"
+
+namespace nnv {
+namespace utils {
+
+/**
+ * @brief Cooperative cancellation flag shared between a caller and a task
+ *
+ * Copies share state. Long-running tasks poll isCancelled() at safe points;
+ * code that blocks (e.g. a paused trainer) registers a callback to be woken.
+ */
+class CancellationToken {
+public:
+    /**
+     * @brief Keeps a cancellation callback registered while alive
+     */
+    class Registration {
+    public:
+        Registration() = default;
+        ~Registration() { reset(); }
+
+        Registration(Registration&& other) noexcept
+            : state_(std::move(other.state_)), id_(other.id_) {}
+        Registration& operator=(Registration&& other) noexcept {
+            if (this != &other) {
+                reset();
+                state_ = std::move(other.state_);
+                id_ = other.id_;
+            }
+            return *this;
+        }
+
+        // Disable copy
+        NNV_DISABLE_COPY(Registration)
+
+        /**
+         * @brief Unregister the callback
+         */
+        void reset();
+
+    private:
+        friend class CancellationToken;
+
+        struct State;
+        std::shared_ptr<State> state_;
+        std::size_t id_ = 0;
+    };
+
+    /**
+     * @brief Create a token that is not cancelled
+     */
+    CancellationToken();
+
+    /**
+     * @brief Request cancellation and run registered callbacks (any thread)
+     */
+    void cancel();
+
+    /**
+     * @brief Check if cancellation was requested
+     * @return True if cancelled
+     */
+    bool isCancelled() const;
+
+    /**
+     * @brief Register a callback run on cancel()
+     * @param callback Callback; invoked immediately if already cancelled. It must
+     *                 be short and must not call back into this token.
+     * @return Registration that unregisters the callback when destroyed
+     */
+    Registration onCancel(std::function<void()> callback) const;
+
+private:
+    std::shared_ptr<Registration::State> state_;
+};
+
+/**
+ * @brief Fixed-size pool of worker threads running queued tasks in FIFO order
+ */
+class ThreadPool {
+public:
+    /**
+     * @brief Constructor
+     * @param threadCount Number of workers (0 uses the hardware concurrency)
+     */
+    explicit ThreadPool(std::size_t threadCount = 0);
+
+    /**
+     * @brief Destructor; finishes queued tasks and joins the workers
+     */
+    ~ThreadPool();
+
+    // Disable copy and move
+    NNV_DISABLE_COPY_AND_MOVE(ThreadPool)
+
+    /**
+     * @brief Queue a task
+     * @param task Callable taking no arguments
+     * @return Future for the task's result (exceptions are rethrown by get())
+     */
+    template<typename F>
+    auto submit(F&& task) -> std::future<std::invoke_result_t<std::decay_t<F>>> {
+        using Result = std::invoke_result_t<std::decay_t<F>>;
+
+        auto packaged = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(task));
+        auto future = packaged->get_future();
+        enqueue([packaged]() { (*packaged)(); });
+        return future;
+    }
+
+    /**
+     * @brief Get number of worker threads
+     * @return Worker count
+     */
+    std::size_t getThreadCount() const { return workers_.size(); }
+
+    /**
+     * @brief Get the library-wide pool used for background work
+     * @return Shared pool, created on first use
+     */
+    static ThreadPool& getShared();
+
+private:
+    void enqueue(std::function<void()> task);
+    void workerLoop();
+
+    std::vector<std::thread> workers_;
+    std::deque<std::function<void()>> tasks_;
+    std::mutex mutex_;
+    std::condition_variable available_;
+    bool stopping_;
+};
+
+} // namespace utils
+} // namespace nnv
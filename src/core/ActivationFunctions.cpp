@@ -30,7 +30,12 @@ template float swish<float>(float);
 template float swishDerivative<float>(float);
 template float gelu<float>(float);
 template float geluDerivative<float>(float);
+template void softmax<float>(const float*, float*, std::size_t);
 template std::vector<float> softmax<float>(const std::vector<float>&);
+template void softmaxJvp<float>(const float*, const float*, float*, std::size_t, std::size_t);
+template void softmaxVjp<float>(const float*, const float*, float*, std::size_t, std::size_t);
+template std::vector<float> softmaxJvp<float>(const std::vector<float>&, const std::vector<float>&);
+template std::vector<float> softmaxVjp<float>(const std::vector<float>&, const std::vector<float>&);
 template float softmaxDerivative<float>(const std::vector<float>&, std::size_t, std::size_t);
 
 // Double instantiations
@@ -50,7 +55,12 @@ template double swish<double>(double);
 template double swishDerivative<double>(double);
 template double gelu<double>(double);
 template double geluDerivative<double>(double);
+template void softmax<double>(const double*, double*, std::size_t);
 template std::vector<double> softmax<double>(const std::vector<double>&);
+template void softmaxJvp<double>(const double*, const double*, double*, std::size_t, std::size_t);
+template void softmaxVjp<double>(const double*, const double*, double*, std::size_t, std::size_t);
+template std::vector<double> softmaxJvp<double>(const std::vector<double>&, const std::vector<double>&);
+template std::vector<double> softmaxVjp<double>(const std::vector<double>&, const std::vector<double>&);
 template double softmaxDerivative<double>(const std::vector<double>&, std::size_t, std::size_t);
 
 } // namespace activation
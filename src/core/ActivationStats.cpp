@@ -0,0 +1,67 @@
+/**
+ * @file ActivationStats.cpp
+ * @brief Implementation of sampled activation statistics
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#include "core/ActivationStats.hpp"
+#include <algorithm>
+
+namespace nnv {
+namespace core {
+
+ActivationStatsCollector::ActivationStatsCollector(std::size_t sampleInterval)
+    : sampleInterval_(sampleInterval > 0 ? sampleInterval : 1)
+    , batchCounter_(0)
+    , sampling_(false)
+    , pendingPublish_(false)
+{
+}
+
+bool ActivationStatsCollector::beginBatch(std::size_t layerCount) {
+    sampling_ = (batchCounter_++ % sampleInterval_) == 0;
+
+    if (sampling_ && accumulators_.layers.size() != layerCount) {
+        accumulators_.layers.resize(layerCount);
+    }
+
+    return sampling_;
+}
+
+NeuronActivationStats* ActivationStatsCollector::layerAccumulators(LayerIndex layer, LayerSize size) {
+    NNV_ASSERT(layer < accumulators_.layers.size());
+
+    auto& stats = accumulators_.layers[layer];
+    if (stats.size() != size) {
+        stats.assign(size, NeuronActivationStats{});
+    }
+
+    return stats.data();
+}
+
+void ActivationStatsCollector::endBatch() {
+    if (sampling_) {
+        ++accumulators_.sampledBatches;
+        pendingPublish_ = true;
+        sampling_ = false;
+    }
+
+    // A skipped publish (reader still copying) is retried after the next batch
+    if (pendingPublish_) {
+        pendingPublish_ = !published_.tryPublish(accumulators_);
+    }
+}
+
+void ActivationStatsCollector::reset() {
+    accumulators_.sampledBatches = 0;
+    for (auto& layer : accumulators_.layers) {
+        std::fill(layer.begin(), layer.end(), NeuronActivationStats{});
+    }
+
+    batchCounter_ = 0;
+    pendingPublish_ = !published_.tryPublish(accumulators_);
+}
+
+} // namespace core
+} // namespace nnv
@@ -8,13 +8,18 @@
 #include "core/Application.hpp"
 #include "core/NeuralNetwork.hpp"
 #include "utils/Logger.hpp"
+#include "utils/MetricsServer.hpp"
+#include "utils/Profiler.hpp"
 #include <SFML/Graphics.hpp>
+#include <cstdlib>
 
 namespace nnv {
 namespace core {
 
 Application::Application(const utils::ConfigManager& config)
     : config_(config)
+    , networkMetricsId_(0)
+    , lastRenderMs_(0.0f)
     , running_(false)
     , initialized_(false)
     , deltaTime_(0.0f)
@@ -39,6 +44,13 @@ bool Application::initialize() {
     
     NNV_LOG_INFO("Initializing Neural Network Visualizer application...");
     
+#ifdef NNV_ENABLE_PROFILING
+    // Dump a Chrome trace of the whole session on exit when requested
+    if (const char* tracePath = std::getenv("NNV_TRACE_FILE")) {
+        utils::Profiler::writeChromeTraceAtExit(tracePath);
+    }
+#endif
+    
     // Initialize window
     if (!initializeWindow()) {
         NNV_LOG_ERROR("Failed to initialize window");
@@ -51,6 +63,8 @@ bool Application::initialize() {
         return false;
     }
     
+    initializeMetrics();
+    
     // Load network if specified in config
     std::string networkFile = config_.get<std::string>("startup.network_file", "");
     if (!networkFile.empty()) {
@@ -74,8 +88,12 @@ int Application::run() {
     deltaClock_.restart();
     
     NNV_LOG_INFO("Starting main application loop");
+    NNV_PROFILE_THREAD("main");
     
     while (running_ && window_->isOpen()) {
+        NNV_PROFILE_SCOPE_CAT("frame", "frame");
+        const utils::AllocationProbe frameAllocations;
+        
         // Calculate delta time
         deltaTime_ = deltaClock_.restart().asSeconds();
         
@@ -90,6 +108,7 @@ int Application::run() {
         
         // Limit frame rate
         limitFrameRate();
+        lastFrameAllocations_ = frameAllocations.counts();
         
         // Update performance stats
         updatePerformanceStats();
@@ -113,6 +132,13 @@ void Application::shutdown() {
         neuralNetwork_->stopTraining();
     }
     
+    // Stop serving metrics before the state it reads goes away
+    if (metricsServer_) {
+        metricsServer_->stop();
+        metricsServer_.reset();
+        networkMetricsId_ = 0;
+    }
+    
     // Cleanup subsystems
     performanceMonitor_.reset();
     inputHandler_.reset();
@@ -132,6 +158,7 @@ void Application::shutdown() {
 bool Application::createNeuralNetwork(const NetworkConfig& config) {
     try {
         neuralNetwork_ = std::make_shared<DefaultNetwork>(config);
+        updateNetworkMetrics();
         NNV_LOG_INFO("Created neural network: {}", config.name);
         return true;
     } catch (const std::exception& e) {
@@ -145,6 +172,7 @@ bool Application::loadNeuralNetwork(const std::string& filename) {
         auto network = std::make_shared<DefaultNetwork>();
         if (network->loadFromFile(filename)) {
             neuralNetwork_ = network;
+            updateNetworkMetrics();
             NNV_LOG_INFO("Loaded neural network from: {}", filename);
             return true;
         }
@@ -173,6 +201,7 @@ bool Application::saveNeuralNetwork(const std::string& filename) const {
 
 void Application::setNeuralNetwork(std::shared_ptr<DefaultNetwork> network) {
     neuralNetwork_ = network;
+    updateNetworkMetrics();
     if (network) {
         NNV_LOG_INFO("Set neural network: {}", network->getName());
     } else {
@@ -231,7 +260,58 @@ bool Application::initializeSubsystems() {
     return true;
 }
 
+void Application::initializeMetrics() {
+    const int port = config_.getMetricsPort();
+    if (port <= 0) {
+        return;
+    }
+    if (port > 65535) {
+        NNV_LOG_WARNING("Invalid metrics port {}, metrics endpoint disabled", port);
+        return;
+    }
+    
+    auto server = std::make_unique<utils::MetricsServer>();
+    utils::addProcessMetrics(server->getRegistry());
+    server->getRegistry().add([this](utils::MetricsWriter& out) {
+        publishedRenderStats_.read().writeMetrics(out);
+    });
+    
+    if (!server->start(static_cast<std::uint16_t>(port), config_.getMetricsBindAddress())) {
+        NNV_LOG_WARNING("Metrics endpoint disabled");
+        return;
+    }
+    metricsServer_ = std::move(server);
+}
+
+void Application::updateNetworkMetrics() {
+    if (!metricsServer_) {
+        return;
+    }
+    
+    auto& registry = metricsServer_->getRegistry();
+    if (networkMetricsId_ != 0) {
+        registry.remove(networkMetricsId_);
+        networkMetricsId_ = 0;
+    }
+    if (!neuralNetwork_) {
+        return;
+    }
+    
+    // Step latency quantiles and samples/s come from the training timers
+    if (!neuralNetwork_->isTraining()) {
+        neuralNetwork_->enablePerfStats();
+    }
+    
+    std::weak_ptr<DefaultNetwork> network = neuralNetwork_;
+    networkMetricsId_ = registry.add([network](utils::MetricsWriter& out) {
+        if (auto current = network.lock()) {
+            current->writeMetrics(out);
+        }
+    });
+}
+
 void Application::processEvents() {
+    NNV_PROFILE_SCOPE_CAT("processEvents", "frame");
     sf::Event event;
     while (window_->pollEvent(event)) {
         switch (event.type) {
@@ -261,6 +341,7 @@ void Application::processEvents() {
 }
 
 void Application::update(float deltaTime) {
+    NNV_PROFILE_SCOPE_CAT("update", "frame");
     // Update subsystems
     // if (performanceMonitor_) {
     //     performanceMonitor_->update(deltaTime);
@@ -276,6 +357,9 @@ void Application::update(float deltaTime) {
 }
 
 void Application::render() {
+    NNV_PROFILE_SCOPE_CAT("render", "render");
+    NNV_ALLOCATION_SCOPE(Rendering);
+    sf::Clock renderClock;
     window_->clear(sf::Color::Black);
     
     // Render subsystems
@@ -291,6 +375,7 @@ void Application::render() {
     // This will be replaced with actual rendering
     
     window_->display();
+    lastRenderMs_ = renderClock.getElapsedTime().asSeconds() * 1000.0f;
 }
 
 void Application::handleResize(unsigned int width, unsigned int height) {
@@ -318,7 +403,16 @@ void Application::updatePerformanceStats() {
     frameCount++;
     if (fpsClock.getElapsedTime().asSeconds() >= 1.0f) {
         float fps = static_cast<float>(frameCount) / fpsClock.getElapsedTime().asSeconds();
-        // NNV_LOG_DEBUG("FPS: {:.1f}", fps);
+        NNV_LOG_DEBUG("FPS: {:.1f}", fps);
+        
+        if (metricsServer_) {
+            graphics::RenderStats stats;
+            stats.fps = fps;
+            stats.renderTime = lastRenderMs_;
+            stats.frameAllocations = lastFrameAllocations_.allocations;
+            stats.frameAllocatedBytes = lastFrameAllocations_.bytes;
+            publishedRenderStats_.tryPublish(stats);
+        }
         
         frameCount = 0;
         fpsClock.restart();
@@ -326,6 +420,8 @@ void Application::updatePerformanceStats() {
 }
 
 void Application::limitFrameRate() {
+    NNV_PROFILE_SCOPE_CAT("limitFrameRate", "frame");
+    
     static sf::Clock frameClock;
     float frameTime = frameClock.getElapsedTime().asSeconds();
     
@@ -0,0 +1,135 @@
+/**
+ * @file CostModel.cpp
+ * @brief Implementation of the roofline analysis
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#include "core/CostModel.hpp"
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+namespace nnv {
+namespace core {
+
+const PhaseCost& LayerCost::phase(TrainingPhase phase) const {
+    static const PhaseCost kNone;
+    switch (phase) {
+        case TrainingPhase::Forward:  return forward;
+        case TrainingPhase::Backward: return backward;
+        case TrainingPhase::Update:   return update;
+        default:                      return kNone;
+    }
+}
+
+PhaseCost CostModel::total() const {
+    PhaseCost sum;
+    for (const auto& layer : layers) {
+        sum += layer.total();
+    }
+    return sum;
+}
+
+std::size_t CostModel::parameterBytes() const {
+    std::size_t bytes = 0;
+    for (const auto& layer : layers) {
+        bytes += layer.parameterBytes;
+    }
+    return bytes;
+}
+
+std::size_t CostModel::activationBytes() const {
+    std::size_t bytes = 0;
+    for (const auto& layer : layers) {
+        bytes += layer.activationBytes;
+    }
+    return bytes;
+}
+
+const char* getRooflineBoundName(RooflineBound bound) {
+    switch (bound) {
+        case RooflineBound::Compute: return "compute";
+        case RooflineBound::Memory:  return "memory";
+        case RooflineBound::Cache:   return "cache";
+        default:                     return "unknown";
+    }
+}
+
+std::vector<RooflinePoint> computeRoofline(const CostModel& model, const PerfStats& stats,
+                                           const utils::MachinePeaks& peaks) {
+    std::vector<RooflinePoint> points;
+    if (model.batchSize == 0) {
+        return points;
+    }
+
+    const std::size_t layerCount = std::min(model.layers.size(), stats.layers.size());
+    for (std::size_t l = 1; l < layerCount; ++l) {
+        const auto& cost = model.layers[l];
+        const auto& timing = stats.layers[l];
+
+        for (TrainingPhase phase : {TrainingPhase::Forward, TrainingPhase::Backward, TrainingPhase::Update}) {
+            const TimingHistogram& histogram = phase == TrainingPhase::Forward ? timing.forward
+                                             : phase == TrainingPhase::Backward ? timing.backward
+                                                                                : timing.update;
+            const PhaseCost& phaseCost = cost.phase(phase);
+            if (histogram.totalNanos == 0 || phaseCost.flops <= 0.0) {
+                continue;
+            }
+
+            // The histogram counts one entry per sample
+            const double samples = static_cast<double>(histogram.count);
+            const double scale = samples / static_cast<double>(model.batchSize);
+
+            RooflinePoint point;
+            point.layer = l;
+            point.phase = phase;
+            point.seconds = static_cast<double>(histogram.totalNanos) * 1e-9;
+            point.intensity = phaseCost.intensity();
+            point.gflops = phaseCost.flops * scale / point.seconds * 1e-9;
+            point.gbps = phaseCost.bytes * scale / point.seconds * 1e-9;
+
+            if (peaks.gbps > 0.0 && point.gbps > peaks.gbps) {
+                point.bound = RooflineBound::Cache;
+                point.attainableGflops = peaks.gflops;
+            } else {
+                const double memoryRoof = peaks.gbps > 0.0 ? point.intensity * peaks.gbps : peaks.gflops;
+                point.bound = memoryRoof < peaks.gflops ? RooflineBound::Memory : RooflineBound::Compute;
+                point.attainableGflops = std::min(peaks.gflops, memoryRoof);
+            }
+            point.efficiency = point.attainableGflops > 0.0 ? point.gflops / point.attainableGflops : 0.0;
+
+            points.push_back(point);
+        }
+    }
+
+    return points;
+}
+
+std::string formatRoofline(const std::vector<RooflinePoint>& points, const utils::MachinePeaks& peaks) {
+    std::ostringstream oss;
+    oss << std::fixed << std::setprecision(2);
+    oss << "peak: " << peaks.gflops << " GFLOP/s";
+    if (!peaks.computeRoof.empty()) {
+        oss << " (" << peaks.computeRoof << ")";
+    }
+    oss << ", " << peaks.gbps << " GB/s, ridge " << peaks.ridgeIntensity() << " FLOP/B\n";
+
+    oss << "layer  phase      time ms  FLOP/B    GF/s    GB/s  roof GF/s  roof %  bound\n";
+    for (const auto& point : points) {
+        oss << std::setw(5) << point.layer << "  "
+            << std::left << std::setw(9) << getTrainingPhaseName(point.phase) << std::right
+            << std::setw(9) << point.seconds * 1e3
+            << std::setw(8) << point.intensity
+            << std::setw(8) << point.gflops
+            << std::setw(8) << point.gbps
+            << std::setw(11) << point.attainableGflops
+            << std::setw(8) << point.efficiency * 100.0
+            << "  " << getRooflineBoundName(point.bound) << "\n";
+    }
+
+    return oss.str();
+}
+
+} // namespace core
+} // namespace nnv
@@ -0,0 +1,242 @@
+/**
+ * @file IncrementalEvaluator.cpp
+ * @brief Implementation of the IncrementalEvaluator class
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#include "core/IncrementalEvaluator.hpp"
+#include "core/NeuralNetwork.hpp"
+#include "core/ActivationFunctions.hpp"
+#include "utils/Logger.hpp"
+
+namespace nnv {
+namespace core {
+
+template<typename T>
+IncrementalEvaluator<T>::IncrementalEvaluator(NeuralNetwork<T>& network)
+    : network_(network)
+    , valid_(false)
+    , editsSinceRefresh_(0)
+    , refreshInterval_(1024)
+{
+}
+
+template<typename T>
+bool IncrementalEvaluator<T>::evaluate(const std::vector<T>& inputs) {
+    valid_ = false;
+
+    auto outputs = network_.predict(inputs);
+    if (outputs.empty()) {
+        NNV_LOG_WARNING("Incremental evaluation failed: forward pass produced no outputs");
+        return false;
+    }
+
+    inputs_ = inputs;
+
+    const std::size_t layerCount = network_.getLayerCount();
+    weightedInputs_.resize(layerCount);
+    activations_.resize(layerCount);
+    parameterVersions_.resize(layerCount);
+
+    for (std::size_t l = 0; l < layerCount; ++l) {
+        const auto& layer = network_.getLayer(l);
+        weightedInputs_[l].assign(layer.getWeightedInputs().begin(), layer.getWeightedInputs().end());
+        activations_[l].assign(layer.getActivations().begin(), layer.getActivations().end());
+        parameterVersions_[l] = layer.getParameterVersion();
+    }
+
+    valid_ = true;
+    editsSinceRefresh_ = 0;
+    return true;
+}
+
+template<typename T>
+bool IncrementalEvaluator<T>::refresh() {
+    if (inputs_.empty()) {
+        return false;
+    }
+
+    // Copy: evaluate() overwrites inputs_
+    auto inputs = inputs_;
+    return evaluate(inputs);
+}
+
+template<typename T>
+bool IncrementalEvaluator<T>::setWeight(LayerIndex layer, NeuronIndex neuron, std::size_t input, T weight) {
+    if (!valid_ || !checkShape() || !refreshIfStale()) {
+        NNV_LOG_WARNING("Incremental weight edit requires a valid evaluation of the current network");
+        valid_ = false;
+        return false;
+    }
+
+    if (layer == 0 || layer >= activations_.size() ||
+        neuron >= activations_[layer].size() ||
+        input >= activations_[layer - 1].size()) {
+        NNV_LOG_WARNING("Invalid weight index ({}, {}, {}) for incremental edit", layer, neuron, input);
+        return false;
+    }
+
+    auto target = network_.getLayer(layer).getNeuron(neuron);
+    T oldWeight = target.getInputWeight(input);
+    target.setInputWeight(input, weight);
+
+    parameterVersions_[layer] = network_.getLayer(layer).getParameterVersion();
+
+    // Rank-1 change: only this neuron's weighted input moves
+    weightedInputs_[layer][neuron] += (weight - oldWeight) * activations_[layer - 1][input];
+
+    nextNeurons_.assign(1, neuron);
+    updateActivations(layer, nextNeurons_);
+    propagate(layer);
+
+    finishEdit();
+    return true;
+}
+
+template<typename T>
+bool IncrementalEvaluator<T>::setBias(LayerIndex layer, NeuronIndex neuron, T bias) {
+    if (!valid_ || !checkShape() || !refreshIfStale()) {
+        NNV_LOG_WARNING("Incremental bias edit requires a valid evaluation of the current network");
+        valid_ = false;
+        return false;
+    }
+
+    if (layer == 0 || layer >= activations_.size() || neuron >= activations_[layer].size()) {
+        NNV_LOG_WARNING("Invalid bias index ({}, {}) for incremental edit", layer, neuron);
+        return false;
+    }
+
+    // The bias is applied on top of the cached weighted input
+    network_.getLayer(layer).getNeuron(neuron).setBias(bias);
+    parameterVersions_[layer] = network_.getLayer(layer).getParameterVersion();
+
+    nextNeurons_.assign(1, neuron);
+    updateActivations(layer, nextNeurons_);
+    propagate(layer);
+
+    finishEdit();
+    return true;
+}
+
+template<typename T>
+bool IncrementalEvaluator<T>::checkShape() const {
+    if (network_.getLayerCount() != activations_.size() || activations_.empty()) {
+        return false;
+    }
+
+    for (std::size_t l = 0; l < activations_.size(); ++l) {
+        const auto& layer = network_.getLayer(l);
+        if (layer.getSize() != activations_[l].size()) {
+            return false;
+        }
+
+        if (l > 0 && layer.getInputSize() != activations_[l - 1].size()) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template<typename T>
+bool IncrementalEvaluator<T>::refreshIfStale() {
+    for (std::size_t l = 0; l < parameterVersions_.size(); ++l) {
+        if (network_.getLayer(l).getParameterVersion() != parameterVersions_[l]) {
+            // Trained or edited elsewhere: the cached pre-activations no longer match the weights
+            NNV_LOG_DEBUG("Layer {} parameters changed since the last evaluation; refreshing", l);
+            return refresh();
+        }
+    }
+    return true;
+}
+
+template<typename T>
+void IncrementalEvaluator<T>::updateActivations(LayerIndex layer, const std::vector<NeuronIndex>& neurons) {
+    auto& target = network_.getLayer(layer);
+    auto& weighted = weightedInputs_[layer];
+    auto& current = activations_[layer];
+
+    changedNeurons_.clear();
+    changedValues_.clear();
+
+    if (target.getActivationType() == ActivationType::Softmax) {
+        // Softmax couples every output of the layer
+        std::vector<T> preActivations(weighted.size());
+        for (std::size_t k = 0; k < weighted.size(); ++k) {
+            preActivations[k] = weighted[k] + target.getNeuron(k).getBias();
+        }
+
+        auto outputs = activation::softmax(preActivations);
+
+        for (std::size_t k = 0; k < outputs.size(); ++k) {
+            auto neuron = target.getNeuron(k);
+            neuron.setWeightedInput(weighted[k]);
+
+            if (outputs[k] != current[k]) {
+                changedNeurons_.push_back(k);
+                changedValues_.push_back(outputs[k] - current[k]);
+                current[k] = outputs[k];
+                neuron.setActivation(outputs[k]);
+            }
+        }
+        return;
+    }
+
+    auto activationFunc = ActivationFactory::getFunction<T>(target.getActivationType());
+
+    for (NeuronIndex k : neurons) {
+        auto neuron = target.getNeuron(k);
+        neuron.setWeightedInput(weighted[k]);
+
+        T value = activationFunc(weighted[k] + neuron.getBias());
+        if (value != current[k]) {
+            changedNeurons_.push_back(k);
+            changedValues_.push_back(value - current[k]);
+            current[k] = value;
+            neuron.setActivation(value);
+        }
+    }
+}
+
+template<typename T>
+void IncrementalEvaluator<T>::propagate(LayerIndex fromLayer) {
+    for (std::size_t l = fromLayer + 1; l < activations_.size() && !changedNeurons_.empty(); ++l) {
+        const auto& next = network_.getLayer(l);
+        auto& weighted = weightedInputs_[l];
+
+        nextNeurons_.clear();
+
+        // Sparse update: only the weight columns of changed inputs are read
+        for (std::size_t k = 0; k < weighted.size(); ++k) {
+            const T* weights = next.getWeightRow(k);
+
+            T delta = T{0};
+            for (std::size_t c = 0; c < changedNeurons_.size(); ++c) {
+                delta += weights[changedNeurons_[c]] * changedValues_[c];
+            }
+
+            if (delta != T{0}) {
+                weighted[k] += delta;
+                nextNeurons_.push_back(k);
+            }
+        }
+
+        updateActivations(l, nextNeurons_);
+    }
+}
+
+template<typename T>
+void IncrementalEvaluator<T>::finishEdit() {
+    ++editsSinceRefresh_;
+    if (refreshInterval_ > 0 && editsSinceRefresh_ >= refreshInterval_) {
+        refresh();
+    }
+}
+
+// Explicit template instantiations
+template class IncrementalEvaluator<float>;
+template class IncrementalEvaluator<double>;
+
+} // namespace core
+} // namespace nnv
@@ -6,6 +6,8 @@
  */
 
 #include "core/Layer.hpp"
+#include "core/ActivationStats.hpp"
+#include "core/TrainingMetrics.hpp"
 #include "utils/Logger.hpp"
 #include <cmath>
 #include <random>
@@ -16,27 +18,31 @@ namespace core {
 
 template<typename T>
 Layer<T>::Layer(LayerSize size, ActivationType activation, const std::string& name)
-    : neurons_(size)
+    : size_(0)
+    , fanIn_(0)
+    , params_(std::make_shared<ParameterBlock>())
+    , parameterVersion_(0)
     , name_(name)
     , activationType_(activation)
     , dropoutRate_(T{0})
     , trainable_(true)
-    , dropoutMask_(size, true)
 {
-    initializeNeuronIds();
+    resizeNeurons(size);
     updateActivationFunctions();
 }
 
 template<typename T>
 Layer<T>::Layer(const LayerConfig& config)
-    : neurons_(config.size)
+    : size_(0)
+    , fanIn_(0)
+    , params_(std::make_shared<ParameterBlock>())
+    , parameterVersion_(0)
     , name_(config.name)
     , activationType_(config.activation)
     , dropoutRate_(config.dropout_rate)
     , trainable_(config.trainable)
-    , dropoutMask_(config.size, true)
 {
-    initializeNeuronIds();
+    resizeNeurons(config.size);
     updateActivationFunctions();
 }
 
@@ -47,49 +53,71 @@ void Layer<T>::setActivationType(ActivationType type) {
 }
 
 template<typename T>
-std::vector<T> Layer<T>::getActivations() const {
-    std::vector<T> activations;
-    activations.reserve(neurons_.size());
-    
-    for (const auto& neuron : neurons_) {
-        activations.push_back(neuron.getActivation());
-    }
-    
-    return activations;
+void Layer<T>::setActivations(const std::vector<T>& activations) {
+    NNV_ASSERT(activations.size() == size_);
+    std::copy(activations.begin(), activations.begin() + std::min(activations.size(), size_),
+              activations_.begin());
 }
 
 template<typename T>
-void Layer<T>::setActivations(const std::vector<T>& activations) {
-    NNV_ASSERT(activations.size() == neurons_.size());
-    
-    for (std::size_t i = 0; i < neurons_.size(); ++i) {
-        neurons_[i].setActivation(activations[i]);
+void Layer<T>::setBiases(const std::vector<T>& biases) {
+    NNV_ASSERT(biases.size() == size_);
+    std::copy(biases.begin(), biases.begin() + std::min(biases.size(), size_), mutableParams().biases.begin());
+}
+
+template<typename T>
+const std::string& Layer<T>::getNeuronName(NeuronIndex index) const {
+    static const std::string empty;
+    auto it = neuronNames_.find(index);
+    return it != neuronNames_.end() ? it->second : empty;
+}
+
+template<typename T>
+void Layer<T>::setNeuronName(NeuronIndex index, const std::string& name) {
+    if (name.empty()) {
+        neuronNames_.erase(index);
+    } else {
+        neuronNames_[index] = name;
     }
 }
 
 template<typename T>
-std::vector<T> Layer<T>::getBiases() const {
-    std::vector<T> biases;
-    biases.reserve(neurons_.size());
-    
-    for (const auto& neuron : neurons_) {
-        biases.push_back(neuron.getBias());
+void Layer<T>::setNeuronTrainable(NeuronIndex index, bool trainable) {
+    if (trainable) {
+        frozenNeurons_.erase(index);
+    } else {
+        frozenNeurons_.insert(index);
     }
-    
-    return biases;
 }
 
 template<typename T>
-void Layer<T>::setBiases(const std::vector<T>& biases) {
-    NNV_ASSERT(biases.size() == neurons_.size());
+LayerMemoryUsage Layer<T>::memoryUsage() const {
+    LayerMemoryUsage usage;
     
-    for (std::size_t i = 0; i < neurons_.size(); ++i) {
-        neurons_[i].setBias(biases[i]);
+    // Parameters shared with clones are counted by every layer referencing them
+    usage.weights = (params_->weights.capacity() + params_->biases.capacity()) * sizeof(T);
+    usage.activations = (weightedInputs_.capacity() + activations_.capacity() +
+                         gradients_.capacity() + deltas_.capacity()) * sizeof(T) +
+                        (dropoutMask_.capacity() + 7) / 8;
+    usage.scratch = scratch_.capacity() * sizeof(T);
+    
+    // Approximate node cost of the sparse tables
+    usage.metadata = sizeof(Layer) + name_.capacity();
+    for (const auto& entry : neuronNames_) {
+        usage.metadata += sizeof(entry) + 2 * sizeof(void*) + entry.second.capacity();
     }
+    usage.metadata += frozenNeurons_.size() * (sizeof(NeuronIndex) + 2 * sizeof(void*));
+    
+    return usage;
 }
 
 template<typename T>
 void Layer<T>::initializeWeights(LayerSize prevLayerSize, InitializationType initType) {
+    fanIn_ = prevLayerSize;
+    auto& params = freshParams();
+    params.weights.assign(size_ * fanIn_, T{0});
+    params.biases.assign(size_, T{0});
+    
     switch (initType) {
         case InitializationType::Xavier:
             initializeXavier(prevLayerSize);
@@ -101,58 +129,84 @@ void Layer<T>::initializeWeights(LayerSize prevLayerSize, InitializationType ini
             initializeRandom(prevLayerSize);
             break;
         case InitializationType::Zero:
-            for (auto& neuron : neurons_) {
-                neuron.setInputWeights(std::vector<T>(prevLayerSize, T{0}));
-                neuron.setBias(T{0});
-            }
             break;
         case InitializationType::One:
-            for (auto& neuron : neurons_) {
-                neuron.setInputWeights(std::vector<T>(prevLayerSize, T{1}));
-                neuron.setBias(T{1});
-            }
+            std::fill(params.weights.begin(), params.weights.end(), T{1});
+            std::fill(params.biases.begin(), params.biases.end(), T{1});
             break;
     }
 }
 
 template<typename T>
-void Layer<T>::forward(const std::vector<T>& inputs) {
-    NNV_ASSERT(!neurons_.empty());
+void Layer<T>::forward(const T* inputs, std::size_t count) {
+    NNV_ASSERT(size_ > 0);
+    NNV_ASSERT(count == fanIn_);
+    NNV_UNUSED(count);
+    
+    const T* x = inputs;
     
-    for (auto& neuron : neurons_) {
-        const auto& weights = neuron.getInputWeights();
-        NNV_ASSERT(weights.size() == inputs.size());
+    for (std::size_t k = 0; k < size_; ++k) {
+        const T* row = getWeightRow(k);
         
         // Compute weighted sum
         T weightedSum = T{0};
-        for (std::size_t i = 0; i < inputs.size(); ++i) {
-            weightedSum += inputs[i] * weights[i];
+        for (std::size_t i = 0; i < fanIn_; ++i) {
+            weightedSum += x[i] * row[i];
         }
         
-        neuron.setWeightedInput(weightedSum);
+        weightedInputs_[k] = weightedSum;
     }
 }
 
 template<typename T>
-void Layer<T>::applyActivation() {
+void Layer<T>::applyActivation(NeuronActivationStats* stats) {
     if (activationType_ == ActivationType::Softmax) {
         // Special handling for softmax
-        std::vector<T> weightedInputs;
-        weightedInputs.reserve(neurons_.size());
-        
-        for (const auto& neuron : neurons_) {
-            weightedInputs.push_back(neuron.getWeightedInput() + neuron.getBias());
+        const T* biases = params_->biases.data();
+        for (std::size_t i = 0; i < size_; ++i) {
+            activations_[i] = weightedInputs_[i] + biases[i];
         }
         
-        auto softmaxOutputs = activation::softmax(weightedInputs);
+        activation::softmax(activations_.data(), activations_.data(), size_);
         
-        for (std::size_t i = 0; i < neurons_.size(); ++i) {
-            neurons_[i].setActivation(softmaxOutputs[i]);
+        if (stats) {
+            for (std::size_t i = 0; i < size_; ++i) {
+                stats[i].add(static_cast<double>(activations_[i]));
+            }
         }
     } else {
-        // Apply activation function to each neuron
-        for (auto& neuron : neurons_) {
-            neuron.applyActivation(activationFunc_);
+        // Apply activation function to each neuron; sampled statistics are
+        // accumulated in the same loop so sampling needs no extra pass
+        const T* biases = params_->biases.data();
+        for (std::size_t i = 0; i < size_; ++i) {
+            activations_[i] = activationFunc_(weightedInputs_[i] + biases[i]);
+            if (stats) {
+                stats[i].add(static_cast<double>(activations_[i]));
+            }
+        }
+    }
+}
+
+template<typename T>
+void Layer<T>::infer(const T* inputs, std::size_t count, T* outputs) const {
+    NNV_ASSERT(count == fanIn_);
+    NNV_UNUSED(count);
+    
+    const T* biases = params_->biases.data();
+    for (std::size_t k = 0; k < size_; ++k) {
+        const T* row = getWeightRow(k);
+        T weightedSum = T{0};
+        for (std::size_t i = 0; i < fanIn_; ++i) {
+            weightedSum += inputs[i] * row[i];
+        }
+        outputs[k] = weightedSum + biases[k];
+    }
+    
+    if (activationType_ == ActivationType::Softmax) {
+        activation::softmax(outputs, outputs, size_);
+    } else {
+        for (std::size_t k = 0; k < size_; ++k) {
+            outputs[k] = activationFunc_(outputs[k]);
         }
     }
 }
@@ -176,10 +230,10 @@ void Layer<T>::applyDropout(bool training) {
         dropoutMask_[i] = dist(gen) < keepProb;
         
         if (!dropoutMask_[i]) {
-            neurons_[i].setActivation(T{0});
+            activations_[i] = T{0};
         } else {
             // Scale by keep probability to maintain expected value
-            neurons_[i].setActivation(neurons_[i].getActivation() / keepProb);
+            activations_[i] /= keepProb;
         }
     }
 }
@@ -189,64 +243,131 @@ void Layer<T>::computeGradients(const std::vector<T>& nextLayerDeltas,
                                 const std::vector<std::vector<T>>& nextLayerWeights) {
     NNV_ASSERT(nextLayerDeltas.size() == nextLayerWeights.size());
     
-    for (std::size_t i = 0; i < neurons_.size(); ++i) {
-        T delta = T{0};
-        
-        // Sum weighted deltas from next layer
-        for (std::size_t j = 0; j < nextLayerDeltas.size(); ++j) {
-            NNV_ASSERT(i < nextLayerWeights[j].size());
-            delta += nextLayerDeltas[j] * nextLayerWeights[j][i];
+    // Sum weighted deltas from next layer
+    scratch_.assign(size_, T{0});
+    for (std::size_t j = 0; j < nextLayerDeltas.size(); ++j) {
+        NNV_ASSERT(nextLayerWeights[j].size() == size_);
+        const T delta = nextLayerDeltas[j];
+        const T* row = nextLayerWeights[j].data();
+        for (std::size_t i = 0; i < size_; ++i) {
+            scratch_[i] += delta * row[i];
         }
-        
-        // Multiply by activation derivative
-        T activationDeriv = neurons_[i].computeActivationDerivative(activationDerivFunc_);
-        delta *= activationDeriv;
-        
-        neurons_[i].setDelta(delta);
     }
+    
+    finishGradients();
 }
 
 template<typename T>
-void Layer<T>::updateWeights(T learningRate, const std::vector<T>& prevLayerActivations) {
+void Layer<T>::computeGradients(const Layer& nextLayer) {
+    NNV_ASSERT(nextLayer.fanIn_ == size_);
+    
+    // Sum weighted deltas from next layer, one contiguous weight row at a time
+    scratch_.assign(size_, T{0});
+    for (std::size_t j = 0; j < nextLayer.size_; ++j) {
+        const T delta = nextLayer.deltas_[j];
+        const T* row = nextLayer.getWeightRow(j);
+        for (std::size_t i = 0; i < size_; ++i) {
+            scratch_[i] += delta * row[i];
+        }
+    }
+    
+    finishGradients();
+}
+
+template<typename T>
+void Layer<T>::finishGradients() {
+    if (activationType_ == ActivationType::Softmax) {
+        // Softmax couples all outputs: backpropagate through its Jacobian
+        activation::softmaxVjp(activations_.data(), scratch_.data(), deltas_.data(), 1, size_);
+        return;
+    }
+    
+    // Multiply by activation derivative
+    const T* biases = params_->biases.data();
+    for (std::size_t i = 0; i < size_; ++i) {
+        deltas_[i] = scratch_[i] * activationDerivFunc_(weightedInputs_[i] + biases[i]);
+    }
+}
+
+template<typename T>
+void Layer<T>::updateWeights(T learningRate, const T* prevLayerActivations, std::size_t count,
+                             LayerUpdateMetrics* metrics) {
     if (!trainable_) {
         return;
     }
     
-    for (auto& neuron : neurons_) {
-        auto weights = neuron.getInputWeights();
-        NNV_ASSERT(weights.size() == prevLayerActivations.size());
-        
-        T delta = neuron.getDelta();
+    NNV_ASSERT(count == fanIn_);
+    NNV_UNUSED(count);
+    const T* x = prevLayerActivations;
+    
+    // Side reductions over the values the update already has in registers
+    double gradSq = 0.0;
+    double weightSq = 0.0;
+    double updateSq = 0.0;
+    std::uint64_t nonFinite = 0;
+    
+    auto& params = mutableParams();
+    
+    for (std::size_t k = 0; k < size_; ++k) {
+        T* weights = params.weights.data() + k * fanIn_;
+        T delta = deltas_[k];
+        T bias = params.biases[k];
         
-        // Update weights
-        for (std::size_t i = 0; i < weights.size(); ++i) {
-            weights[i] -= learningRate * delta * prevLayerActivations[i];
+        if (metrics) {
+            for (std::size_t i = 0; i < fanIn_; ++i) {
+                T grad = delta * x[i];
+                T update = learningRate * grad;
+                
+                gradSq += static_cast<double>(grad) * grad;
+                weightSq += static_cast<double>(weights[i]) * weights[i];
+                updateSq += static_cast<double>(update) * update;
+                nonFinite += !std::isfinite(grad);
+                
+                weights[i] -= update;
+            }
+            
+            T biasUpdate = learningRate * delta;
+            gradSq += static_cast<double>(delta) * delta;
+            weightSq += static_cast<double>(bias) * bias;
+            updateSq += static_cast<double>(biasUpdate) * biasUpdate;
+            nonFinite += !std::isfinite(delta);
+        } else {
+            // Update weights
+            for (std::size_t i = 0; i < fanIn_; ++i) {
+                weights[i] -= learningRate * delta * x[i];
+            }
         }
         
         // Update bias
-        T bias = neuron.getBias();
-        bias -= learningRate * delta;
-        
-        neuron.setInputWeights(weights);
-        neuron.setBias(bias);
+        params.biases[k] = bias - learningRate * delta;
+    }
+    
+    if (metrics) {
+        metrics->gradientNormSq = gradSq;
+        metrics->weightNormSq = weightSq;
+        metrics->updateNormSq = updateSq;
+        metrics->nonFiniteCount = nonFinite;
+        metrics->parameterCount = size_ * (fanIn_ + 1);
     }
 }
 
 template<typename T>
 void Layer<T>::reset() {
-    for (auto& neuron : neurons_) {
-        neuron.reset();
-    }
+    std::fill(activations_.begin(), activations_.end(), T{0});
+    std::fill(weightedInputs_.begin(), weightedInputs_.end(), T{0});
+    std::fill(gradients_.begin(), gradients_.end(), T{0});
+    std::fill(deltas_.begin(), deltas_.end(), T{0});
     std::fill(dropoutMask_.begin(), dropoutMask_.end(), true);
 }
 
 template<typename T>
 std::vector<std::vector<T>> Layer<T>::getWeightMatrix() const {
     std::vector<std::vector<T>> weights;
-    weights.reserve(neurons_.size());
+    weights.reserve(size_);
     
-    for (const auto& neuron : neurons_) {
-        weights.push_back(neuron.getInputWeights());
+    for (std::size_t k = 0; k < size_; ++k) {
+        const T* row = getWeightRow(k);
+        weights.emplace_back(row, row + fanIn_);
     }
     
     return weights;
@@ -254,10 +375,20 @@ std::vector<std::vector<T>> Layer<T>::getWeightMatrix() const {
 
 template<typename T>
 void Layer<T>::setWeightMatrix(const std::vector<std::vector<T>>& weights) {
-    NNV_ASSERT(weights.size() == neurons_.size());
+    NNV_ASSERT(weights.size() == size_);
+    
+    fanIn_ = weights.empty() ? 0 : weights[0].size();
     
-    for (std::size_t i = 0; i < neurons_.size(); ++i) {
-        neurons_[i].setInputWeights(weights[i]);
+    // Biases are kept; a shared block is copied, the old weights are not
+    auto biases = params_->biases;
+    auto& params = freshParams();
+    params.biases = std::move(biases);
+    params.weights.assign(size_ * fanIn_, T{0});
+    
+    for (std::size_t k = 0; k < std::min(weights.size(), size_); ++k) {
+        NNV_ASSERT(weights[k].size() == fanIn_);
+        std::copy(weights[k].begin(), weights[k].begin() + std::min(weights[k].size(), fanIn_),
+                  params.weights.data() + k * fanIn_);
     }
 }
 
@@ -266,14 +397,27 @@ nlohmann::json Layer<T>::toJson() const {
     nlohmann::json json;
     
     json["name"] = name_;
-    json["size"] = neurons_.size();
+    json["size"] = size_;
     json["activation_type"] = static_cast<int>(activationType_);
     json["dropout_rate"] = dropoutRate_;
     json["trainable"] = trainable_;
     
+    // Same per-neuron layout as Neuron::toJson
     json["neurons"] = nlohmann::json::array();
-    for (const auto& neuron : neurons_) {
-        json["neurons"].push_back(neuron.toJson());
+    for (std::size_t k = 0; k < size_; ++k) {
+        const T* row = getWeightRow(k);
+        
+        nlohmann::json neuron;
+        neuron["id"] = k;
+        neuron["activation"] = activations_[k];
+        neuron["bias"] = params_->biases[k];
+        neuron["weighted_input"] = weightedInputs_[k];
+        neuron["gradient"] = gradients_[k];
+        neuron["delta"] = deltas_[k];
+        neuron["trainable"] = isNeuronTrainable(k);
+        neuron["name"] = getNeuronName(k);
+        neuron["input_weights"] = std::vector<T>(row, row + fanIn_);
+        json["neurons"].push_back(std::move(neuron));
     }
     
     return json;
@@ -299,19 +443,85 @@ void Layer<T>::fromJson(const nlohmann::json& json) {
     }
     
     if (json.contains("neurons") && json["neurons"].is_array()) {
-        neurons_.clear();
-        neurons_.reserve(json["neurons"].size());
+        const auto& neurons = json["neurons"];
+        
+        resizeNeurons(neurons.size());
+        neuronNames_.clear();
+        frozenNeurons_.clear();
         
-        for (const auto& neuronJson : json["neurons"]) {
-            Neuron<T> neuron;
-            neuron.fromJson(neuronJson);
-            neurons_.push_back(std::move(neuron));
+        fanIn_ = 0;
+        if (!neurons.empty() && neurons[0].contains("input_weights")) {
+            fanIn_ = neurons[0]["input_weights"].size();
         }
+        auto& params = freshParams();
+        params.weights.assign(size_ * fanIn_, T{0});
+        params.biases.assign(size_, T{0});
         
-        dropoutMask_.resize(neurons_.size(), true);
+        for (std::size_t k = 0; k < size_; ++k) {
+            const auto& neuron = neurons[k];
+            
+            if (neuron.contains("activation")) activations_[k] = neuron["activation"].get<T>();
+            if (neuron.contains("bias")) params.biases[k] = neuron["bias"].get<T>();
+            if (neuron.contains("weighted_input")) weightedInputs_[k] = neuron["weighted_input"].get<T>();
+            if (neuron.contains("gradient")) gradients_[k] = neuron["gradient"].get<T>();
+            if (neuron.contains("delta")) deltas_[k] = neuron["delta"].get<T>();
+            if (neuron.contains("trainable")) setNeuronTrainable(k, neuron["trainable"].get<bool>());
+            if (neuron.contains("name")) setNeuronName(k, neuron["name"].get<std::string>());
+            
+            if (neuron.contains("input_weights")) {
+                auto weights = neuron["input_weights"].get<std::vector<T>>();
+                if (weights.size() != fanIn_) {
+                    NNV_LOG_WARNING_EVERY_N(100, "Neuron {} of layer '{}' has {} weights, expected {}",
+                                            k, name_, weights.size(), fanIn_);
+                }
+                std::copy(weights.begin(), weights.begin() + std::min(weights.size(), fanIn_),
+                          params.weights.data() + k * fanIn_);
+            }
+        }
     }
 }
 
+template<typename T>
+std::unique_ptr<Layer<T>> Layer<T>::clone() const {
+    auto copy = std::make_unique<Layer<T>>(0, activationType_, name_);
+    
+    copy->size_ = size_;
+    copy->fanIn_ = fanIn_;
+    copy->params_ = params_;
+    copy->parameterVersion_ = parameterVersion_;
+    copy->weightedInputs_ = weightedInputs_;
+    copy->activations_ = activations_;
+    copy->gradients_ = gradients_;
+    copy->deltas_ = deltas_;
+    copy->neuronNames_ = neuronNames_;
+    copy->frozenNeurons_ = frozenNeurons_;
+    copy->dropoutRate_ = dropoutRate_;
+    copy->trainable_ = trainable_;
+    copy->dropoutMask_ = dropoutMask_;
+    
+    return copy;
+}
+
+template<typename T>
+typename Layer<T>::ParameterBlock& Layer<T>::mutableParams() {
+    ++parameterVersion_;
+    
+    // Copy on write: detach from clones before the first modification
+    if (params_.use_count() > 1) {
+        params_ = std::make_shared<ParameterBlock>(*params_);
+    }
+    return *params_;
+}
+
+template<typename T>
+typename Layer<T>::ParameterBlock& Layer<T>::freshParams() {
+    ++parameterVersion_;
+    if (params_.use_count() > 1) {
+        params_ = std::make_shared<ParameterBlock>();
+    }
+    return *params_;
+}
+
 template<typename T>
 void Layer<T>::updateActivationFunctions() {
     activationFunc_ = ActivationFactory::getFunction<T>(activationType_);
@@ -319,10 +529,16 @@ void Layer<T>::updateActivationFunctions() {
 }
 
 template<typename T>
-void Layer<T>::initializeNeuronIds() {
-    for (std::size_t i = 0; i < neurons_.size(); ++i) {
-        neurons_[i].setId(i);
-    }
+void Layer<T>::resizeNeurons(LayerSize size) {
+    size_ = size;
+    auto& params = freshParams();
+    params.weights.assign(size_ * fanIn_, T{0});
+    params.biases.assign(size_, T{0});
+    weightedInputs_.assign(size_, T{0});
+    activations_.assign(size_, T{0});
+    gradients_.assign(size_, T{0});
+    deltas_.assign(size_, T{0});
+    dropoutMask_.assign(size_, true);
 }
 
 template<typename T>
@@ -330,17 +546,14 @@ void Layer<T>::initializeXavier(LayerSize prevLayerSize) {
     std::random_device rd;
     std::mt19937 gen(rd());
     
-    T limit = std::sqrt(T{6} / (prevLayerSize + neurons_.size()));
+    T limit = std::sqrt(T{6} / (prevLayerSize + size_));
     std::uniform_real_distribution<T> dist(-limit, limit);
     
-    for (auto& neuron : neurons_) {
-        std::vector<T> weights(prevLayerSize);
-        for (auto& weight : weights) {
-            weight = dist(gen);
-        }
-        neuron.setInputWeights(weights);
-        neuron.setBias(T{0}); // Initialize bias to zero
+    auto& params = mutableParams();
+    for (auto& weight : params.weights) {
+        weight = dist(gen);
     }
+    std::fill(params.biases.begin(), params.biases.end(), T{0}); // Initialize bias to zero
 }
 
 template<typename T>
@@ -351,29 +564,28 @@ void Layer<T>::initializeHe(LayerSize prevLayerSize) {
     T stddev = std::sqrt(T{2} / prevLayerSize);
     std::normal_distribution<T> dist(T{0}, stddev);
     
-    for (auto& neuron : neurons_) {
-        std::vector<T> weights(prevLayerSize);
-        for (auto& weight : weights) {
-            weight = dist(gen);
-        }
-        neuron.setInputWeights(weights);
-        neuron.setBias(T{0}); // Initialize bias to zero
+    auto& params = mutableParams();
+    for (auto& weight : params.weights) {
+        weight = dist(gen);
     }
+    std::fill(params.biases.begin(), params.biases.end(), T{0}); // Initialize bias to zero
 }
 
 template<typename T>
 void Layer<T>::initializeRandom(LayerSize prevLayerSize) {
+    NNV_UNUSED(prevLayerSize);
+    
     std::random_device rd;
     std::mt19937 gen(rd());
     std::uniform_real_distribution<T> dist(T{-1}, T{1});
     
-    for (auto& neuron : neurons_) {
-        std::vector<T> weights(prevLayerSize);
-        for (auto& weight : weights) {
-            weight = dist(gen);
+    auto& params = mutableParams();
+    for (std::size_t k = 0; k < size_; ++k) {
+        T* row = params.weights.data() + k * fanIn_;
+        for (std::size_t i = 0; i < fanIn_; ++i) {
+            row[i] = dist(gen);
         }
-        neuron.setInputWeights(weights);
-        neuron.setBias(dist(gen));
+        params.biases[k] = dist(gen);
     }
 }
 
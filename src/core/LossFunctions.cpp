@@ -24,6 +24,11 @@ template float huberLoss<float>(const std::vector<float>&, const std::vector<flo
 template std::vector<float> huberLossGradient<float>(const std::vector<float>&, const std::vector<float>&, float);
 template float focalLoss<float>(const std::vector<float>&, const std::vector<float>&, float, float);
 template std::vector<float> focalLossGradient<float>(const std::vector<float>&, const std::vector<float>&, float, float);
+template float meanSquaredErrorBatch<float>(ConstMatrixView<float>, ConstMatrixView<float>, MatrixView<float>);
+template float crossEntropyBatch<float>(ConstMatrixView<float>, ConstMatrixView<float>, MatrixView<float>);
+template float binaryCrossEntropyBatch<float>(ConstMatrixView<float>, ConstMatrixView<float>, MatrixView<float>);
+template float huberLossBatch<float>(ConstMatrixView<float>, ConstMatrixView<float>, MatrixView<float>, float);
+template float focalLossBatch<float>(ConstMatrixView<float>, ConstMatrixView<float>, MatrixView<float>, float, float);
 
 // Double instantiations
 template double meanSquaredError<double>(const std::vector<double>&, const std::vector<double>&);
@@ -36,6 +41,11 @@ template double huberLoss<double>(const std::vector<double>&, const std::vector<
 template std::vector<double> huberLossGradient<double>(const std::vector<double>&, const std::vector<double>&, double);
 template double focalLoss<double>(const std::vector<double>&, const std::vector<double>&, double, double);
 template std::vector<double> focalLossGradient<double>(const std::vector<double>&, const std::vector<double>&, double, double);
+template double meanSquaredErrorBatch<double>(ConstMatrixView<double>, ConstMatrixView<double>, MatrixView<double>);
+template double crossEntropyBatch<double>(ConstMatrixView<double>, ConstMatrixView<double>, MatrixView<double>);
+template double binaryCrossEntropyBatch<double>(ConstMatrixView<double>, ConstMatrixView<double>, MatrixView<double>);
+template double huberLossBatch<double>(ConstMatrixView<double>, ConstMatrixView<double>, MatrixView<double>, double);
+template double focalLossBatch<double>(ConstMatrixView<double>, ConstMatrixView<double>, MatrixView<double>, double, double);
 
 } // namespace loss
 
@@ -46,11 +56,15 @@ LossFactory::getFunction<float>(LossType);
 template std::function<std::vector<float>(const std::vector<float>&, const std::vector<float>&)> 
 LossFactory::getGradient<float>(LossType);
 
+template loss::FusedLossFunction<float> LossFactory::getFused<float>(LossType);
+
 template std::function<double(const std::vector<double>&, const std::vector<double>&)> 
 LossFactory::getFunction<double>(LossType);
 
 template std::function<std::vector<double>(const std::vector<double>&, const std::vector<double>&)> 
 LossFactory::getGradient<double>(LossType);
 
+template loss::FusedLossFunction<double> LossFactory::getFused<double>(LossType);
+
 } // namespace core
 } // namespace nnv
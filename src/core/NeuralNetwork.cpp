@@ -7,11 +7,17 @@
 
 #include "core/NeuralNetwork.hpp"
 #include "core/LossFunctions.hpp"
+#include "core/ActivationFunctions.hpp"
+#include "utils/AllocationTracker.hpp"
 #include "utils/Logger.hpp"
+#include "utils/MetricsServer.hpp"
+#include "utils/Profiler.hpp"
 #include <algorithm>
 #include <random>
 #include <fstream>
 #include <numeric>
+#include <chrono>
+#include <limits>
 
 namespace nnv {
 namespace core {
@@ -25,9 +31,24 @@ NeuralNetwork<T>::NeuralNetwork(const std::string& name)
     , isTraining_(false)
     , shouldStop_(false)
     , trainingProgress_(T{0})
+    , isPaused_(false)
+    , dropoutActive_(false)
+    , statsSampling_(false)
+    , stepMetricsEnabled_(false)
+    , stepCounter_(0)
+    , hasBatchMetricsStreams_(false)
+    , perfStatsEnabled_(false)
+    , timingStep_(false)
+    , hardwareCountersEnabled_(false)
+    , countingStep_(false)
+    , batchesTrained_(0)
+    , samplesTrained_(0)
+    , lastLoss_(0.0)
+    , publishInterval_(0)
 {
     updateLossFunction();
     updateOptimizer();
+    publishMemoryUsage();
 }
 
 template<typename T>
@@ -39,6 +60,20 @@ NeuralNetwork<T>::NeuralNetwork(const NetworkConfig& config)
     , isTraining_(false)
     , shouldStop_(false)
     , trainingProgress_(T{0})
+    , isPaused_(false)
+    , dropoutActive_(false)
+    , statsSampling_(false)
+    , stepMetricsEnabled_(false)
+    , stepCounter_(0)
+    , hasBatchMetricsStreams_(false)
+    , perfStatsEnabled_(false)
+    , timingStep_(false)
+    , hardwareCountersEnabled_(false)
+    , countingStep_(false)
+    , batchesTrained_(0)
+    , samplesTrained_(0)
+    , lastLoss_(0.0)
+    , publishInterval_(0)
 {
     // Add layers from configuration
     for (const auto& layerConfig : config.layers) {
@@ -57,10 +92,7 @@ NeuralNetwork<T>::NeuralNetwork(const NetworkConfig& config)
 template<typename T>
 NeuralNetwork<T>::~NeuralNetwork() {
     stopTraining();
-    // Wait for training to stop if it's running
-    while (isTraining_.load()) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
-    }
+    waitForTraining();
 }
 
 template<typename T>
@@ -73,6 +105,7 @@ void NeuralNetwork<T>::addLayer(std::unique_ptr<Layer<T>> layer) {
     }
     
     layers_.push_back(std::move(layer));
+    publishMemoryUsage();
     NNV_LOG_DEBUG("Added layer to network '{}'. Total layers: {}", name_, layers_.size());
 }
 
@@ -100,6 +133,7 @@ void NeuralNetwork<T>::removeLayer(LayerIndex index) {
             layers_[i]->initializeWeights(layers_[i-1]->getSize());
         }
     }
+    publishMemoryUsage();
     
     NNV_LOG_DEBUG("Removed layer {} from network '{}'. Total layers: {}", 
                  index, name_, layers_.size());
@@ -109,6 +143,7 @@ template<typename T>
 void NeuralNetwork<T>::clearLayers() {
     std::lock_guard<std::mutex> lock(networkMutex_);
     layers_.clear();
+    publishMemoryUsage();
     NNV_LOG_DEBUG("Cleared all layers from network '{}'", name_);
 }
 
@@ -119,6 +154,7 @@ void NeuralNetwork<T>::initializeWeights(InitializationType initType) {
     for (std::size_t i = 1; i < layers_.size(); ++i) {
         layers_[i]->initializeWeights(layers_[i-1]->getSize(), initType);
     }
+    publishMemoryUsage();
     
     NNV_LOG_DEBUG("Initialized weights for network '{}' using {} initialization", 
                  name_, static_cast<int>(initType));
@@ -126,79 +162,301 @@ void NeuralNetwork<T>::initializeWeights(InitializationType initType) {
 
 template<typename T>
 std::vector<T> NeuralNetwork<T>::forward(const std::vector<T>& inputs) {
+    if (!forwardPass(inputs)) {
+        return {};
+    }
+    
+    const auto& outputs = layers_.back()->getActivations();
+    return std::vector<T>(outputs.begin(), outputs.end());
+}
+
+template<typename T>
+bool NeuralNetwork<T>::forwardPass(const std::vector<T>& inputs) {
+    NNV_PROFILE_SCOPE_CAT("forward", "training");
+    
     if (layers_.empty()) {
         NNV_LOG_ERROR("Cannot perform forward pass on empty network");
-        return {};
+        return false;
     }
     
     if (inputs.size() != layers_[0]->getSize()) {
-        NNV_LOG_ERROR("Input size {} doesn't match first layer size {}", 
-                     inputs.size(), layers_[0]->getSize());
-        return {};
+        NNV_LOG_ERROR_RATE_LIMITED(1.0, 5, "Input size {} doesn't match first layer size {}",
+                                   inputs.size(), layers_[0]->getSize());
+        return false;
     }
     
     // Set input layer activations
     layers_[0]->setActivations(inputs);
     
     // Forward pass through hidden and output layers
+    const auto passStart = timingStep_ ? PerfClock::now() : PerfClock::time_point{};
+    if (countingStep_) {
+        counters_->read(counterMark_);
+    }
+    
     for (std::size_t i = 1; i < layers_.size(); ++i) {
-        auto prevActivations = layers_[i-1]->getActivations();
-        layers_[i]->forward(prevActivations);
-        layers_[i]->applyActivation();
-        layers_[i]->applyDropout(isTraining_.load());
+        const auto layerStart = timingStep_ ? PerfClock::now() : PerfClock::time_point{};
+        
+        const auto& prevActivations = layers_[i-1]->getActivations();
+        layers_[i]->forward(prevActivations.data(), prevActivations.size());
+        layers_[i]->applyActivation(statsSampling_ ?
+            activationStats_->layerAccumulators(i, layers_[i]->getSize()) : nullptr);
+        layers_[i]->applyDropout(dropoutActive_);
+        
+        if (timingStep_) {
+            auto& layerStats = perfStats_.layers[i];
+            layerStats.forward.record(nanosSince(layerStart));
+            layerStats.forwardFlops += 2.0 * static_cast<double>(layers_[i]->getInputSize() * layers_[i]->getSize());
+        }
+        if (countingStep_) {
+            accumulateCounters(perfStats_.layers[i].forwardCounters);
+        }
     }
     
-    return layers_.back()->getActivations();
+    if (timingStep_) {
+        perfStats_.phase(TrainingPhase::Forward).record(nanosSince(passStart));
+    }
+    
+    return true;
 }
 
 template<typename T>
 T NeuralNetwork<T>::backward(const std::vector<T>& targets, const std::vector<T>& outputs) {
+    return backwardPass(targets, outputs.data(), outputs.size());
+}
+
+template<typename T>
+T NeuralNetwork<T>::backwardPass(const std::vector<T>& targets, const T* outputs, std::size_t outputSize) {
+    NNV_PROFILE_SCOPE_CAT("backward", "training");
+    
     if (layers_.size() < 2) {
         NNV_LOG_ERROR("Cannot perform backward pass on network with less than 2 layers");
         return T{0};
     }
     
-    // Compute loss
-    T loss = lossFunction_(outputs, targets);
-    
-    // Compute output layer gradients
-    auto outputGradients = lossGradientFunction_(outputs, targets);
+    // Compute loss and output layer gradients in one pass
+    auto phaseStart = timingStep_ ? PerfClock::now() : PerfClock::time_point{};
     auto& outputLayer = *layers_.back();
     
-    for (std::size_t i = 0; i < outputLayer.getSize(); ++i) {
-        outputLayer.getNeuron(i).setDelta(outputGradients[i]);
+    if (targets.size() != outputSize || outputLayer.getSize() != outputSize) {
+        NNV_LOG_ERROR_RATE_LIMITED(1.0, 5, "Target size {} doesn't match output size {}",
+                                   targets.size(), outputSize);
+        return T{0};
+    }
+    
+    outputGradients_.resize(outputSize);
+    T loss = fusedLossFunction_(ConstMatrixView<T>(outputs, 1, outputSize),
+                                ConstMatrixView<T>(targets.data(), 1, outputSize),
+                                MatrixView<T>(outputGradients_.data(), 1, outputSize));
+    
+    if (outputLayer.getActivationType() == ActivationType::Softmax) {
+        activation::softmaxVjp(outputs, outputGradients_.data(), outputGradients_.data(),
+                               1, outputSize);
+    }
+    
+    for (std::size_t i = 0; i < outputSize; ++i) {
+        outputLayer.getNeuron(i).setDelta(outputGradients_[i]);
+    }
+    
+    if (timingStep_) {
+        perfStats_.phase(TrainingPhase::Loss).record(nanosSince(phaseStart));
+        phaseStart = PerfClock::now();
     }
     
     // Backward pass through hidden layers
+    if (countingStep_) {
+        counters_->read(counterMark_);
+    }
+    
     for (int i = static_cast<int>(layers_.size()) - 2; i >= 1; --i) {
-        auto& currentLayer = *layers_[i];
-        auto& nextLayer = *layers_[i + 1];
+        const auto layerStart = timingStep_ ? PerfClock::now() : PerfClock::time_point{};
         
-        // Get deltas and weights from next layer
-        std::vector<T> nextLayerDeltas;
-        std::vector<std::vector<T>> nextLayerWeights;
+        layers_[i]->computeGradients(*layers_[i + 1]);
         
-        for (std::size_t j = 0; j < nextLayer.getSize(); ++j) {
-            nextLayerDeltas.push_back(nextLayer.getNeuron(j).getDelta());
-            nextLayerWeights.push_back(nextLayer.getNeuron(j).getInputWeights());
+        if (timingStep_) {
+            auto& layerStats = perfStats_.layers[i];
+            layerStats.backward.record(nanosSince(layerStart));
+            layerStats.backwardFlops += 2.0 * static_cast<double>(layers_[i]->getSize() * layers_[i + 1]->getSize());
         }
-        
-        currentLayer.computeGradients(nextLayerDeltas, nextLayerWeights);
+        if (countingStep_) {
+            accumulateCounters(perfStats_.layers[i].backwardCounters);
+        }
+    }
+    
+    if (timingStep_) {
+        perfStats_.phase(TrainingPhase::Backward).record(nanosSince(phaseStart));
+        phaseStart = PerfClock::now();
     }
     
     // Update weights
+    if (stepMetricsEnabled_) {
+        stepMetrics_.layers.assign(layers_.size(), LayerUpdateMetrics{});
+    }
+    
+    if (countingStep_) {
+        counters_->read(counterMark_);
+    }
+    
     for (std::size_t i = 1; i < layers_.size(); ++i) {
-        auto prevActivations = layers_[i-1]->getActivations();
-        layers_[i]->updateWeights(learningRate_, prevActivations);
+        const auto layerStart = timingStep_ ? PerfClock::now() : PerfClock::time_point{};
+        
+        const auto& prevActivations = layers_[i-1]->getActivations();
+        layers_[i]->updateWeights(learningRate_, prevActivations.data(), prevActivations.size(),
+                                  stepMetricsEnabled_ ? &stepMetrics_.layers[i] : nullptr);
+        
+        if (timingStep_) {
+            // Gradient product plus scaled subtraction per weight
+            auto& layerStats = perfStats_.layers[i];
+            layerStats.update.record(nanosSince(layerStart));
+            layerStats.updateFlops += 3.0 * static_cast<double>(layers_[i]->getInputSize() * layers_[i]->getSize());
+        }
+        if (countingStep_) {
+            accumulateCounters(perfStats_.layers[i].updateCounters);
+        }
+    }
+    
+    if (timingStep_) {
+        perfStats_.phase(TrainingPhase::Update).record(nanosSince(phaseStart));
+    }
+    
+    ++stepCounter_;
+    if (stepMetricsEnabled_) {
+        publishStepMetrics(loss);
+    }
+    
+    if (publishInterval_ > 0 && stepCounter_ % publishInterval_ == 0) {
+        publishWeights();
     }
     
     return loss;
 }
 
+template<typename T>
+void NeuralNetwork<T>::publishStepMetrics(T loss) {
+    stepMetrics_.step = stepCounter_;
+    stepMetrics_.loss = static_cast<double>(loss);
+    
+    if (stepMetrics_.nonFiniteCount() > 0) {
+        // Once training diverges every step is non-finite
+        NNV_LOG_WARNING_RATE_LIMITED(1.0, 3, "Non-finite gradients at step {} of network '{}'",
+                                     stepCounter_, name_);
+    }
+    
+    if (stepMetricsCallback_) {
+        stepMetricsCallback_(stepMetrics_);
+    }
+    
+    // Skipped if a reader is still copying the previous record
+    publishedStepMetrics_.tryPublish(stepMetrics_);
+}
+
 template<typename T>
 T NeuralNetwork<T>::trainSample(const std::vector<T>& inputs, const std::vector<T>& targets) {
-    auto outputs = forward(inputs);
-    return backward(targets, outputs);
+    NNV_ALLOCATION_SCOPE(Training);
+    const auto start = beginTimedStep();
+    
+    T loss = T{0};
+    if (forwardPass(inputs)) {
+        const auto& outputs = layers_.back()->getActivations();
+        loss = backwardPass(targets, outputs.data(), outputs.size());
+    }
+    
+    endTimedStep(start, 1);
+    publishMemoryUsage();
+    
+    samplesTrained_.fetch_add(1, std::memory_order_relaxed);
+    lastLoss_.store(static_cast<double>(loss), std::memory_order_relaxed);
+    return loss;
+}
+
+template<typename T>
+PerfClock::time_point NeuralNetwork<T>::beginTimedStep() {
+    timingStep_ = perfStatsEnabled_.load(std::memory_order_relaxed);
+    if (!timingStep_) {
+        return PerfClock::time_point{};
+    }
+    
+    if (perfStats_.layers.size() != layers_.size()) {
+        perfStats_.layers.resize(layers_.size());
+    }
+    
+    if (hardwareCountersEnabled_ && countersThread_ != std::this_thread::get_id()) {
+        // Counters only see the thread that opened them; trainAsync() runs on a pool thread
+        if (counters_->open()) {
+            countersThread_ = std::this_thread::get_id();
+        } else {
+            NNV_LOG_WARNING("Hardware counters unavailable on the training thread: {}", counters_->getError());
+            hardwareCountersEnabled_ = false;
+            perfStats_.hardwareCounters = false;
+        }
+    }
+    countingStep_ = hardwareCountersEnabled_;
+    allocationMark_ = utils::AllocationTracker::threadCounts();
+    
+    return PerfClock::now();
+}
+
+template<typename T>
+void NeuralNetwork<T>::accumulateCounters(utils::HardwareCounterValues& into) {
+    utils::HardwareCounterValues now;
+    if (counters_->read(now)) {
+        into.addDelta(counterMark_, now);
+        counterMark_ = now;
+    }
+}
+
+template<typename T>
+void NeuralNetwork<T>::endTimedStep(PerfClock::time_point start, std::size_t samples) {
+    if (!timingStep_) {
+        return;
+    }
+    
+    timingStep_ = false;
+    countingStep_ = false;
+    const std::uint64_t nanos = nanosSince(start);
+    perfStats_.allocations += utils::AllocationTracker::threadCounts() - allocationMark_;
+    perfStats_.steps.record(nanos);
+    perfStats_.stepNanos += nanos;
+    perfStats_.samples += samples;
+    
+    // Skipped if a reader is still copying the previous statistics
+    publishedPerfStats_.tryPublish(perfStats_);
+}
+
+template<typename T>
+void NeuralNetwork<T>::enablePerfStats(bool enabled) {
+    perfStatsEnabled_.store(enabled, std::memory_order_relaxed);
+}
+
+template<typename T>
+bool NeuralNetwork<T>::enableHardwareCounters(bool enabled) {
+    if (!enabled) {
+        hardwareCountersEnabled_ = false;
+        counters_.reset();
+        countersThread_ = std::thread::id{};
+        return true;
+    }
+    
+    auto counters = std::make_unique<utils::PerfCounterGroup>();
+    if (!counters->open()) {
+        NNV_LOG_WARNING("Hardware counters unavailable for network '{}': {}", name_, counters->getError());
+        return false;
+    }
+    
+    counters_ = std::move(counters);
+    countersThread_ = std::this_thread::get_id();
+    hardwareCountersEnabled_ = true;
+    perfStats_.hardwareCounters = true;
+    perfStatsEnabled_.store(true, std::memory_order_relaxed);
+    
+    NNV_LOG_DEBUG("Enabled hardware counters for network '{}'", name_);
+    return true;
+}
+
+template<typename T>
+void NeuralNetwork<T>::resetPerfStats() {
+    perfStats_.clear();
+    publishedPerfStats_.tryPublish(perfStats_);
 }
 
 template<typename T>
@@ -210,13 +468,116 @@ T NeuralNetwork<T>::trainBatch(const std::vector<std::vector<T>>& inputBatch,
         return T{0};
     }
     
+    NNV_PROFILE_SCOPE_CAT("trainBatch", "training");
+    NNV_ALLOCATION_SCOPE(Training);
+    
     T totalLoss = T{0};
     
+    statsSampling_ = activationStats_ && activationStats_->beginBatch(layers_.size());
+    
+    const auto stepStart = beginTimedStep();
+    
+    // Accuracy and timing are only gathered while someone is listening
+    const bool streaming = hasBatchMetricsStreams_.load(std::memory_order_relaxed);
+    const bool timed = streaming || eventLog_;
+    const auto start = timed ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{};
+    std::size_t correct = 0;
+    
     for (std::size_t i = 0; i < inputBatch.size(); ++i) {
-        totalLoss += trainSample(inputBatch[i], targetBatch[i]);
+        // Outputs are read in place; a steady-state step allocates nothing
+        if (!forwardPass(inputBatch[i])) {
+            continue;
+        }
+        const auto& outputs = layers_.back()->getActivations();
+        if (streaming && outputs.size() == targetBatch[i].size() && !outputs.empty()) {
+            correct += isCorrectPrediction(outputs.data(), targetBatch[i].data(), outputs.size());
+        }
+        totalLoss += backwardPass(targetBatch[i], outputs.data(), outputs.size());
+    }
+    
+    if (activationStats_) {
+        statsSampling_ = false;
+        activationStats_->endBatch();
+    }
+    
+    endTimedStep(stepStart, inputBatch.size());
+    publishMemoryUsage();
+    
+    const T meanLoss = totalLoss / static_cast<T>(inputBatch.size());
+    batchesTrained_.fetch_add(1, std::memory_order_relaxed);
+    samplesTrained_.fetch_add(inputBatch.size(), std::memory_order_relaxed);
+    lastLoss_.store(static_cast<double>(meanLoss), std::memory_order_relaxed);
+    const auto elapsed = timed ? std::chrono::steady_clock::now() - start : std::chrono::steady_clock::duration{};
+    
+    if (eventLog_) {
+        utils::StepEvent event;
+        event.step = stepCounter_;
+        event.samples = inputBatch.size();
+        event.nanos = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+        event.loss = static_cast<double>(meanLoss);
+        event.learningRate = static_cast<double>(learningRate_);
+        event.gradientNorm = stepMetricsEnabled_ ? stepMetrics_.gradientNorm()
+                                                 : std::numeric_limits<double>::quiet_NaN();
+        eventLog_->logStep(event);
+    }
+    
+    if (streaming) {
+        const double seconds = std::chrono::duration<double>(elapsed).count();
+        
+        BatchMetrics record;
+        record.step = stepCounter_;
+        record.batchSize = inputBatch.size();
+        record.loss = static_cast<double>(meanLoss);
+        record.accuracy = inputBatch.empty() ? 0.0 : static_cast<double>(correct) / static_cast<double>(inputBatch.size());
+        record.samplesPerSecond = seconds > 0.0 ? static_cast<double>(inputBatch.size()) / seconds : 0.0;
+        record.learningRate = static_cast<double>(learningRate_);
+        if (stepMetricsEnabled_) {
+            record.gradientNorm = stepMetrics_.gradientNorm();
+        }
+        publishBatchMetrics(record);
+    }
+    
+    return meanLoss;
+}
+
+template<typename T>
+void NeuralNetwork<T>::publishBatchMetrics(BatchMetrics& record) {
+    // The list is replaced, never modified, so a subscribe in progress cannot make the trainer wait or miss a record
+    const auto streams = batchMetricsStreams_.read();
+    if (!streams) {
+        return;
     }
     
-    return totalLoss / static_cast<T>(inputBatch.size());
+    for (const auto& stream : *streams) {
+        stream->push(record);
+    }
+}
+
+template<typename T>
+std::shared_ptr<BatchMetricsStream> NeuralNetwork<T>::subscribeBatchMetrics(std::size_t capacity) {
+    auto stream = std::make_shared<BatchMetricsStream>(capacity);
+    
+    std::lock_guard<std::mutex> lock(batchMetricsMutex_);
+    auto streams = std::make_unique<BatchMetricsStreamList>();
+    if (const auto current = batchMetricsStreams_.read()) {
+        *streams = *current;
+    }
+    streams->push_back(stream);
+    batchMetricsStreams_.publish(std::move(streams));
+    hasBatchMetricsStreams_.store(true);
+    return stream;
+}
+
+template<typename T>
+void NeuralNetwork<T>::unsubscribeBatchMetrics(const std::shared_ptr<BatchMetricsStream>& stream) {
+    std::lock_guard<std::mutex> lock(batchMetricsMutex_);
+    auto streams = std::make_unique<BatchMetricsStreamList>();
+    if (const auto current = batchMetricsStreams_.read()) {
+        *streams = *current;
+    }
+    streams->erase(std::remove(streams->begin(), streams->end(), stream), streams->end());
+    hasBatchMetricsStreams_.store(!streams->empty());
+    batchMetricsStreams_.publish(std::move(streams));
 }
 
 template<typename T>
@@ -229,48 +590,237 @@ NeuralNetwork<T>::train(const std::vector<std::vector<T>>& inputData,
                        const std::vector<std::vector<T>>* validationTargets,
                        ProgressCallback progressCallback) {
     
-    TrainingHistory history;
+    if (!beginTraining()) {
+        NNV_LOG_WARNING("Network '{}' is already training", name_);
+        return {};
+    }
+    
+    // Create mutable copies for shuffling
+    auto inputs = inputData;
+    auto targets = targetData;
+    
+    auto history = runTraining(inputs, targets, epochs, batchSize, validationInputs,
+                               validationTargets, std::move(progressCallback), nullptr);
+    finishTraining();
+    return history;
+}
+
+template<typename T>
+std::future<typename NeuralNetwork<T>::TrainingHistory>
+NeuralNetwork<T>::trainAsync(std::vector<std::vector<T>> inputData,
+                            std::vector<std::vector<T>> targetData,
+                            std::size_t epochs,
+                            std::size_t batchSize,
+                            utils::CancellationToken cancellation,
+                            ProgressCallback progressCallback) {
+    
+    // Claimed before queueing so the destructor waits for a task that has not started yet
+    if (!beginTraining()) {
+        NNV_LOG_WARNING("Network '{}' is already training", name_);
+        std::promise<TrainingHistory> rejected;
+        rejected.set_value({});
+        return rejected.get_future();
+    }
+    
+    return utils::ThreadPool::getShared().submit(
+        [this, inputs = std::move(inputData), targets = std::move(targetData), epochs, batchSize,
+         cancellation = std::move(cancellation), progressCallback = std::move(progressCallback)]() mutable {
+            TrainingHistory history;
+            try {
+                history = runTraining(inputs, targets, epochs, batchSize, nullptr, nullptr,
+                                      std::move(progressCallback), &cancellation);
+            } catch (...) {
+                finishTraining();
+                throw;
+            }
+            
+            finishTraining();
+            return history;
+        });
+}
+
+template<typename T>
+void NeuralNetwork<T>::stopTraining() {
+    {
+        std::lock_guard<std::mutex> lock(trainingStateMutex_);
+        shouldStop_.store(true);
+    }
+    trainingStateChanged_.notify_all();
+}
+
+template<typename T>
+void NeuralNetwork<T>::pauseTraining() {
+    std::lock_guard<std::mutex> lock(trainingStateMutex_);
+    isPaused_.store(true);
+}
+
+template<typename T>
+void NeuralNetwork<T>::resumeTraining() {
+    {
+        std::lock_guard<std::mutex> lock(trainingStateMutex_);
+        isPaused_.store(false);
+    }
+    trainingStateChanged_.notify_all();
+}
+
+template<typename T>
+void NeuralNetwork<T>::waitForTraining() const {
+    std::unique_lock<std::mutex> lock(trainingStateMutex_);
+    trainingStateChanged_.wait(lock, [this]() { return !isTraining_.load(); });
+}
+
+template<typename T>
+bool NeuralNetwork<T>::beginTraining() {
+    std::lock_guard<std::mutex> lock(trainingStateMutex_);
+    if (isTraining_.load()) {
+        return false;
+    }
+    
     isTraining_.store(true);
     shouldStop_.store(false);
+    return true;
+}
+
+template<typename T>
+void NeuralNetwork<T>::finishTraining() {
+    // Notify under the lock: a waiting destructor may free the network right after
+    std::lock_guard<std::mutex> lock(trainingStateMutex_);
+    isTraining_.store(false);
+    isPaused_.store(false);
+    trainingStateChanged_.notify_all();
+}
+
+template<typename T>
+bool NeuralNetwork<T>::waitWhilePaused(const utils::CancellationToken* cancellation) {
+    auto stopRequested = [this, cancellation]() {
+        return shouldStop_.load() || (cancellation && cancellation->isCancelled());
+    };
+    
+    if (!isPaused_.load()) {
+        return !stopRequested();
+    }
+    
+    // Cancelling the token must wake a paused run without polling
+    utils::CancellationToken::Registration wake;
+    if (cancellation) {
+        wake = cancellation->onCancel([this]() {
+            std::lock_guard<std::mutex> lock(trainingStateMutex_);
+            trainingStateChanged_.notify_all();
+        });
+    }
+    
+    std::unique_lock<std::mutex> lock(trainingStateMutex_);
+    trainingStateChanged_.wait(lock, [&]() { return !isPaused_.load() || stopRequested(); });
+    return !stopRequested();
+}
+
+template<typename T>
+typename NeuralNetwork<T>::TrainingHistory
+NeuralNetwork<T>::runTraining(std::vector<std::vector<T>>& inputs,
+                             std::vector<std::vector<T>>& targets,
+                             std::size_t epochs,
+                             std::size_t batchSize,
+                             const std::vector<std::vector<T>>* validationInputs,
+                             const std::vector<std::vector<T>>* validationTargets,
+                             ProgressCallback progressCallback,
+                             const utils::CancellationToken* cancellation) {
+    
+    NNV_ALLOCATION_SCOPE(Training);
+    TrainingHistory history;
+    dropoutActive_ = true;
     
     NNV_LOG_INFO("Starting training for network '{}': {} epochs, batch size {}", 
                 name_, epochs, batchSize);
     
-    // Create mutable copies for shuffling
-    auto inputs = inputData;
-    auto targets = targetData;
+    if (eventLog_) {
+        nlohmann::json config;
+        config["network"] = name_;
+        config["layers"] = nlohmann::json::array();
+        for (const auto& layer : layers_) {
+            config["layers"].push_back(layer->getSize());
+        }
+        config["learning_rate"] = learningRate_;
+        config["epochs"] = epochs;
+        config["batch_size"] = batchSize;
+        config["samples"] = inputs.size();
+        config["validation_samples"] = validationInputs ? validationInputs->size() : std::size_t{0};
+        eventLog_->logRunStart(config.dump());
+    }
     
-    for (std::size_t epoch = 0; epoch < epochs && !shouldStop_.load(); ++epoch) {
-        // Shuffle data
-        shuffleData(inputs, targets);
+    bool running = true;
+    for (std::size_t epoch = 0; epoch < epochs && running; ++epoch) {
+        NNV_PROFILE_SCOPE_CAT("epoch", "training");
+        
+        const auto epochStart = std::chrono::steady_clock::now();
+        const bool timingFetch = perfStatsEnabled_.load(std::memory_order_relaxed);
+        const auto fetchStart = timingFetch ? PerfClock::now() : PerfClock::time_point{};
         
-        // Create batches
-        auto batches = createBatches(inputs, targets, batchSize);
+        std::vector<std::pair<std::vector<std::vector<T>>, std::vector<std::vector<T>>>> batches;
+        {
+            NNV_PROFILE_SCOPE_CAT("data fetch", "data");
+            
+            // Shuffle data
+            shuffleData(inputs, targets);
+            
+            // Create batches
+            batches = createBatches(inputs, targets, batchSize);
+        }
+        
+        if (timingFetch) {
+            perfStats_.phase(TrainingPhase::DataFetch).record(nanosSince(fetchStart));
+        }
         
         T epochLoss = T{0};
         for (const auto& batch : batches) {
+            if (!waitWhilePaused(cancellation)) {
+                running = false;
+                break;
+            }
             epochLoss += trainBatch(batch.first, batch.second);
         }
+        
+        // A partially trained epoch is not recorded
+        if (!running) {
+            break;
+        }
         epochLoss /= static_cast<T>(batches.size());
         
-        // Compute training accuracy
-        auto trainOutputs = predictBatch(inputs);
-        T trainAccuracy = computeAccuracy(trainOutputs, targets);
+        // Training accuracy and validation; the span covers only these
+        T trainAccuracy = T{0};
+        T valLoss = T{0};
+        T valAccuracy = T{0};
+        {
+            NNV_PROFILE_SCOPE_CAT("epoch evaluation", "training");
+            auto trainOutputs = predictBatch(inputs);
+            trainAccuracy = computeAccuracy(trainOutputs, targets);
+            
+            if (validationInputs && validationTargets) {
+                auto valResult = evaluate(*validationInputs, *validationTargets);
+                valLoss = valResult.first;
+                valAccuracy = valResult.second;
+            }
+        }
         
         history.trainLoss.push_back(epochLoss);
         history.trainAccuracy.push_back(trainAccuracy);
-        
-        // Validation
-        T valLoss = T{0};
-        T valAccuracy = T{0};
         if (validationInputs && validationTargets) {
-            auto valResult = evaluate(*validationInputs, *validationTargets);
-            valLoss = valResult.first;
-            valAccuracy = valResult.second;
             history.valLoss.push_back(valLoss);
             history.valAccuracy.push_back(valAccuracy);
         }
         
+        if (eventLog_) {
+            const bool validated = validationInputs && validationTargets;
+            utils::EpochEvent event;
+            event.epoch = epoch;
+            event.step = stepCounter_;
+            event.trainLoss = static_cast<double>(epochLoss);
+            event.trainAccuracy = static_cast<double>(trainAccuracy);
+            event.valLoss = validated ? static_cast<double>(valLoss) : std::numeric_limits<double>::quiet_NaN();
+            event.valAccuracy = validated ? static_cast<double>(valAccuracy) : std::numeric_limits<double>::quiet_NaN();
+            event.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - epochStart).count();
+            eventLog_->logEpoch(event);
+        }
+        
         // Update progress
         trainingProgress_.store(static_cast<T>(epoch + 1) / static_cast<T>(epochs));
         
@@ -285,10 +835,23 @@ NeuralNetwork<T>::train(const std::vector<std::vector<T>>& inputData,
         }
     }
     
-    isTraining_.store(false);
-    trainingProgress_.store(T{1});
+    dropoutActive_ = false;
     
-    NNV_LOG_INFO("Training completed for network '{}'", name_);
+    if (eventLog_) {
+        utils::RunEndEvent event;
+        event.epochs = history.trainLoss.size();
+        event.steps = stepCounter_;
+        event.stopped = running ? 0 : 1;
+        eventLog_->logRunEnd(event);
+        eventLog_->flush();
+    }
+    
+    if (running) {
+        trainingProgress_.store(T{1});
+        NNV_LOG_INFO("Training completed for network '{}'", name_);
+    } else {
+        NNV_LOG_INFO("Training of network '{}' stopped after {} epochs", name_, history.trainLoss.size());
+    }
     return history;
 }
 
@@ -302,13 +865,38 @@ std::pair<T, T> NeuralNetwork<T>::evaluate(const std::vector<std::vector<T>>& in
     }
     
     auto outputs = predictBatch(inputData);
+    if (outputs.empty()) {
+        return {T{0}, T{0}};
+    }
     
-    // Compute average loss
-    T totalLoss = T{0};
-    for (std::size_t i = 0; i < outputs.size(); ++i) {
-        totalLoss += lossFunction_(outputs[i], targetData[i]);
+    // Weights are fixed here, so the whole set is one B x K fused loss pass
+    const std::size_t rows = outputs.size();
+    const std::size_t cols = outputs.front().size();
+    bool rectangular = cols > 0;
+    for (std::size_t i = 0; i < rows && rectangular; ++i) {
+        rectangular = outputs[i].size() == cols && targetData[i].size() == cols;
+    }
+    
+    T avgLoss = T{0};
+    if (rectangular) {
+        // Loss only: no gradient view; the gather buffers keep their capacity between calls
+        evaluationOutputs_.resize(rows * cols);
+        evaluationTargets_.resize(rows * cols);
+        for (std::size_t i = 0; i < rows; ++i) {
+            std::copy(outputs[i].begin(), outputs[i].end(), evaluationOutputs_.begin() + i * cols);
+            std::copy(targetData[i].begin(), targetData[i].end(), evaluationTargets_.begin() + i * cols);
+        }
+        avgLoss = fusedLossFunction_(ConstMatrixView<T>(evaluationOutputs_.data(), rows, cols),
+                                     ConstMatrixView<T>(evaluationTargets_.data(), rows, cols),
+                                     MatrixView<T>{});
+    } else {
+        // Mismatched targets score zero loss, as the per-sample functions do
+        T totalLoss = T{0};
+        for (std::size_t i = 0; i < rows; ++i) {
+            totalLoss += lossFunction_(outputs[i], targetData[i]);
+        }
+        avgLoss = totalLoss / static_cast<T>(rows);
     }
-    T avgLoss = totalLoss / static_cast<T>(outputs.size());
     
     // Compute accuracy
     T accuracy = computeAccuracy(outputs, targetData);
@@ -318,15 +906,46 @@ std::pair<T, T> NeuralNetwork<T>::evaluate(const std::vector<std::vector<T>>& in
 
 template<typename T>
 std::vector<T> NeuralNetwork<T>::predict(const std::vector<T>& inputs) {
-    bool wasTraining = isTraining_.load();
-    isTraining_.store(false); // Disable dropout for inference
+    bool wasDropoutActive = dropoutActive_;
+    dropoutActive_ = false; // Disable dropout for inference
     
     auto outputs = forward(inputs);
     
-    isTraining_.store(wasTraining); // Restore training state
+    dropoutActive_ = wasDropoutActive; // Restore training state
     return outputs;
 }
 
+template<typename T>
+bool NeuralNetwork<T>::predict(const std::vector<T>& inputs, std::vector<T>& outputs,
+                               std::vector<T>& scratch) const {
+    if (layers_.size() < 2 || inputs.size() != layers_[0]->getSize()) {
+        NNV_LOG_ERROR_RATE_LIMITED(1.0, 5, "Input size {} doesn't match first layer size {}",
+                                   inputs.size(), layers_.empty() ? 0 : layers_[0]->getSize());
+        return false;
+    }
+    
+    // Hidden layers alternate between the two halves of scratch
+    std::size_t hidden = 0;
+    for (std::size_t i = 1; i + 1 < layers_.size(); ++i) {
+        hidden = std::max<std::size_t>(hidden, layers_[i]->getSize());
+    }
+    if (scratch.size() < 2 * hidden) {
+        scratch.resize(2 * hidden);
+    }
+    outputs.resize(layers_.back()->getSize());
+    
+    const T* current = inputs.data();
+    std::size_t currentSize = inputs.size();
+    for (std::size_t i = 1; i < layers_.size(); ++i) {
+        T* next = i + 1 == layers_.size() ? outputs.data() : scratch.data() + (i % 2) * hidden;
+        layers_[i]->infer(current, currentSize, next);
+        current = next;
+        currentSize = layers_[i]->getSize();
+    }
+    
+    return true;
+}
+
 template<typename T>
 std::vector<std::vector<T>> NeuralNetwork<T>::predictBatch(const std::vector<std::vector<T>>& inputBatch) {
     std::vector<std::vector<T>> outputs;
@@ -359,13 +978,233 @@ void NeuralNetwork<T>::reset() {
         layer->reset();
     }
     
-    isTraining_.store(false);
     shouldStop_.store(false);
     trainingProgress_.store(T{0});
+    stepCounter_ = 0;
+    
+    if (activationStats_) {
+        activationStats_->reset();
+    }
+    publishMemoryUsage();
     
     NNV_LOG_DEBUG("Reset network '{}'", name_);
 }
 
+template<typename T>
+void NeuralNetwork<T>::enableActivationStats(std::size_t sampleInterval) {
+    if (!activationStats_) {
+        activationStats_ = std::make_shared<ActivationStatsCollector>(sampleInterval);
+    } else {
+        activationStats_->setSampleInterval(sampleInterval);
+    }
+    
+    NNV_LOG_DEBUG("Enabled activation statistics for network '{}' (1 in {} batches)", 
+                 name_, sampleInterval);
+}
+
+template<typename T>
+void NeuralNetwork<T>::disableActivationStats() {
+    activationStats_.reset();
+    statsSampling_ = false;
+}
+
+template<typename T>
+NetworkMemoryUsage NeuralNetwork<T>::memoryUsage() const {
+    std::lock_guard<std::mutex> lock(networkMutex_);
+    
+    NetworkMemoryUsage usage;
+    collectMemoryUsage(usage);
+    return usage;
+}
+
+template<typename T>
+void NeuralNetwork<T>::collectMemoryUsage(NetworkMemoryUsage& usage) const {
+    // Reuses the capacity of usage.layers so a steady-state publish allocates nothing
+    usage.layers.clear();
+    for (const auto& layer : layers_) {
+        usage.layers.push_back(layer->memoryUsage());
+    }
+    
+    usage.network = LayerMemoryUsage{};
+    usage.network.scratch = (outputGradients_.capacity() + evaluationOutputs_.capacity() +
+                             evaluationTargets_.capacity()) * sizeof(T);
+    usage.network.metadata = sizeof(NeuralNetwork) + name_.capacity() +
+                             stepMetrics_.layers.capacity() * sizeof(LayerUpdateMetrics);
+}
+
+template<typename T>
+void NeuralNetwork<T>::publishMemoryUsage() {
+    // Skipped if a reader is still copying the previous snapshot
+    publishedMemoryUsage_.tryPublishWith([this](NetworkMemoryUsage& usage) { collectMemoryUsage(usage); });
+}
+
+template<typename T>
+CostModel NeuralNetwork<T>::costModel(std::size_t batchSize) const {
+    std::lock_guard<std::mutex> lock(networkMutex_);
+    
+    CostModel model;
+    model.batchSize = batchSize;
+    model.layers.resize(layers_.size());
+    if (layers_.empty()) {
+        return model;
+    }
+    
+    const double batch = static_cast<double>(batchSize);
+    const double scalar = static_cast<double>(sizeof(T));
+    model.layers[0].outputSize = layers_[0]->getSize();
+    model.layers[0].activationBytes = batchSize * layers_[0]->getSize() * sizeof(T);
+    
+    for (std::size_t i = 1; i < layers_.size(); ++i) {
+        const double in = static_cast<double>(layers_[i]->getInputSize());
+        const double out = static_cast<double>(layers_[i]->getSize());
+        const double weights = in * out;
+        
+        LayerCost& cost = model.layers[i];
+        cost.inputSize = layers_[i]->getInputSize();
+        cost.outputSize = layers_[i]->getSize();
+        cost.parameterBytes = static_cast<std::size_t>((weights + out) * scalar);
+        cost.activationBytes = batchSize * cost.outputSize * sizeof(T);
+        
+        // Weights and biases, inputs, weighted inputs and activations
+        cost.forward.flops = batch * 2.0 * weights;
+        cost.forward.bytes = batch * (weights + in + 3.0 * out) * scalar;
+        
+        // Next layer's weights and deltas; scratch, weighted inputs, biases and deltas of this layer
+        if (i + 1 < layers_.size()) {
+            const double next = static_cast<double>(layers_[i + 1]->getSize());
+            cost.backward.flops = batch * 2.0 * out * next;
+            cost.backward.bytes = batch * (out * next + next + 4.0 * out) * scalar;
+        }
+        
+        // Weights and biases read and written, deltas and inputs read
+        cost.update.flops = batch * 3.0 * weights;
+        cost.update.bytes = batch * (2.0 * (weights + out) + out + in) * scalar;
+    }
+    
+    return model;
+}
+
+template<typename T>
+void NeuralNetwork<T>::writeMetrics(utils::MetricsWriter& out) const {
+    const utils::MetricLabels model = {{"model", name_}};
+    
+    out.gauge("nnv_training_active", "1 while a training run is active",
+              isTraining_.load() ? 1.0 : 0.0, model);
+    out.gauge("nnv_training_progress", "Fraction of requested epochs completed",
+              static_cast<double>(trainingProgress_.load()), model);
+    out.counter("nnv_training_batches_total", "Training batches completed",
+                static_cast<double>(batchesTrained_.load(std::memory_order_relaxed)), model);
+    out.counter("nnv_training_samples_total", "Training samples processed",
+                static_cast<double>(samplesTrained_.load(std::memory_order_relaxed)), model);
+    out.gauge("nnv_training_loss", "Mean loss of the last training batch",
+              lastLoss_.load(std::memory_order_relaxed), model);
+    
+    if (perfStatsEnabled_.load(std::memory_order_relaxed)) {
+        const PerfStats stats = getPerfStats();
+        const auto quantiles = [](const TimingHistogram& histogram) {
+            std::vector<std::pair<double, double>> values;
+            for (double q : {0.5, 0.9, 0.99}) {
+                values.emplace_back(q, histogram.percentileNanos(q) * 1e-9);
+            }
+            return values;
+        };
+        
+        out.gauge("nnv_training_samples_per_second", "Training throughput over step time",
+                  stats.samplesPerSecond(), model);
+        out.summary("nnv_training_step_seconds", "Wall time of training steps",
+                    quantiles(stats.steps), static_cast<double>(stats.steps.totalNanos) * 1e-9,
+                    stats.steps.count, model);
+        
+        for (std::size_t i = 0; i < static_cast<std::size_t>(TrainingPhase::Count); ++i) {
+            const auto phase = static_cast<TrainingPhase>(i);
+            const auto& histogram = stats.phase(phase);
+            utils::MetricLabels labels = model;
+            labels.emplace_back("phase", getTrainingPhaseName(phase));
+            out.summary("nnv_training_phase_seconds", "Wall time of training step phases",
+                        quantiles(histogram), static_cast<double>(histogram.totalNanos) * 1e-9,
+                        histogram.count, labels);
+        }
+        
+        if (utils::AllocationTracker::isAvailable()) {
+            out.counter("nnv_training_allocations_total", "Heap allocations during timed training steps",
+                        static_cast<double>(stats.allocations.allocations), model);
+            out.counter("nnv_training_allocated_bytes_total", "Bytes allocated during timed training steps",
+                        static_cast<double>(stats.allocations.bytes), model);
+        }
+    }
+    
+    if (const auto streams = batchMetricsStreams_.read()) {
+        for (std::size_t i = 0; i < streams->size(); ++i) {
+            utils::MetricLabels labels = model;
+            labels.emplace_back("subscriber", std::to_string(i));
+            out.gauge("nnv_batch_metrics_queue_depth", "Batch metrics records waiting for a subscriber",
+                      static_cast<double>((*streams)[i]->size()), labels);
+            out.counter("nnv_batch_metrics_dropped_total", "Batch metrics records dropped on a full queue",
+                        static_cast<double>((*streams)[i]->getDroppedCount()), labels);
+        }
+    }
+    
+    // The training thread owns the layers; only its published snapshot is safe to read here
+    const auto memory = publishedMemoryUsage_.read().total();
+    const std::pair<const char*, std::size_t> categories[] = {
+        {"weights", memory.weights},
+        {"optimizer_state", memory.optimizerState},
+        {"activations", memory.activations},
+        {"scratch", memory.scratch},
+        {"metadata", memory.metadata}
+    };
+    for (const auto& category : categories) {
+        utils::MetricLabels labels = model;
+        labels.emplace_back("category", category.first);
+        out.gauge("nnv_model_memory_bytes", "Memory held by the model",
+                  static_cast<double>(category.second), labels);
+    }
+}
+
+template<typename T>
+std::unique_ptr<NeuralNetwork<T>> NeuralNetwork<T>::clone() const {
+    std::lock_guard<std::mutex> lock(networkMutex_);
+    
+    auto copy = std::make_unique<NeuralNetwork<T>>(name_);
+    copy->learningRate_ = learningRate_;
+    copy->lossType_ = lossType_;
+    copy->optimizerType_ = optimizerType_;
+    copy->updateLossFunction();
+    copy->updateOptimizer();
+    
+    copy->layers_.reserve(layers_.size());
+    for (const auto& layer : layers_) {
+        copy->layers_.push_back(layer->clone());
+    }
+    
+    return copy;
+}
+
+template<typename T>
+void NeuralNetwork<T>::enableWeightPublishing(std::size_t interval) {
+    publishInterval_ = interval > 0 ? interval : 1;
+    if (!publishedWeights_) {
+        publishedWeights_ = std::make_unique<utils::RcuPointer<NeuralNetwork<T>>>();
+    }
+    publishWeights();
+}
+
+template<typename T>
+void NeuralNetwork<T>::disableWeightPublishing() {
+    publishInterval_ = 0;
+    publishedWeights_.reset();
+}
+
+template<typename T>
+void NeuralNetwork<T>::publishWeights() {
+    if (publishedWeights_) {
+        NNV_PROFILE_SCOPE_CAT("publishWeights", "training");
+        
+        // O(layers): parameters are shared until training next writes them
+        publishedWeights_->publish(clone());
+    }
+}
+
 template<typename T>
 nlohmann::json NeuralNetwork<T>::toJson() const {
     std::lock_guard<std::mutex> lock(networkMutex_);
@@ -415,6 +1254,7 @@ void NeuralNetwork<T>::fromJson(const nlohmann::json& json) {
             layers_.push_back(std::move(layer));
         }
     }
+    publishMemoryUsage();
 }
 
 template<typename T>
@@ -429,6 +1269,10 @@ bool NeuralNetwork<T>::saveToFile(const std::string& filename) const {
 
         file << json.dump(4);
         NNV_LOG_INFO("Saved network '{}' to file: {}", name_, filename);
+        
+        if (eventLog_) {
+            eventLog_->logCheckpoint(stepCounter_, filename);
+        }
         return true;
 
     } catch (const std::exception& e) {
@@ -462,7 +1306,7 @@ bool NeuralNetwork<T>::loadFromFile(const std::string& filename) {
 template<typename T>
 void NeuralNetwork<T>::updateLossFunction() {
     lossFunction_ = LossFactory::getFunction<T>(lossType_);
-    lossGradientFunction_ = LossFactory::getGradient<T>(lossType_);
+    fusedLossFunction_ = LossFactory::getFused<T>(lossType_);
 }
 
 template<typename T>
@@ -481,27 +1325,28 @@ T NeuralNetwork<T>::computeAccuracy(const std::vector<std::vector<T>>& outputs,
     std::size_t correct = 0;
 
     for (std::size_t i = 0; i < outputs.size(); ++i) {
-        if (outputs[i].size() == 1) {
-            // Binary classification or regression
-            T prediction = outputs[i][0] > T{0.5} ? T{1} : T{0};
-            if (std::abs(prediction - targets[i][0]) < T{0.5}) {
-                correct++;
-            }
-        } else {
-            // Multi-class classification
-            auto maxOutputIt = std::max_element(outputs[i].begin(), outputs[i].end());
-            auto maxTargetIt = std::max_element(targets[i].begin(), targets[i].end());
-
-            if (std::distance(outputs[i].begin(), maxOutputIt) ==
-                std::distance(targets[i].begin(), maxTargetIt)) {
-                correct++;
-            }
+        if (!outputs[i].empty() && outputs[i].size() == targets[i].size() &&
+            isCorrectPrediction(outputs[i].data(), targets[i].data(), outputs[i].size())) {
+            correct++;
         }
     }
 
     return static_cast<T>(correct) / static_cast<T>(outputs.size());
 }
 
+template<typename T>
+bool NeuralNetwork<T>::isCorrectPrediction(const T* outputs, const T* targets, std::size_t size) {
+    if (size == 1) {
+        // Binary classification or regression
+        T prediction = outputs[0] > T{0.5} ? T{1} : T{0};
+        return std::abs(prediction - targets[0]) < T{0.5};
+    }
+
+    // Multi-class classification
+    return std::max_element(outputs, outputs + size) - outputs ==
+           std::max_element(targets, targets + size) - targets;
+}
+
 template<typename T>
 void NeuralNetwork<T>::shuffleData(std::vector<std::vector<T>>& inputs,
                                   std::vector<std::vector<T>>& targets) const {
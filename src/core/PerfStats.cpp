@@ -0,0 +1,145 @@
+/**
+ * @file PerfStats.cpp
+ * @brief Implementation of training performance statistics
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#include "core/PerfStats.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+
+namespace nnv {
+namespace core {
+
+const char* getTrainingPhaseName(TrainingPhase phase) {
+    switch (phase) {
+        case TrainingPhase::DataFetch: return "data fetch";
+        case TrainingPhase::Forward:   return "forward";
+        case TrainingPhase::Loss:      return "loss";
+        case TrainingPhase::Backward:  return "backward";
+        case TrainingPhase::Update:    return "update";
+        default:                       return "unknown";
+    }
+}
+
+void TimingHistogram::record(std::uint64_t nanos) {
+    std::size_t bucket = 0;
+    for (std::uint64_t v = nanos >> 1; v != 0 && bucket + 1 < kBucketCount; v >>= 1) {
+        ++bucket;
+    }
+
+    ++buckets[bucket];
+    ++count;
+    totalNanos += nanos;
+    minNanos = std::min(minNanos, nanos);
+    maxNanos = std::max(maxNanos, nanos);
+}
+
+void TimingHistogram::merge(const TimingHistogram& other) {
+    for (std::size_t i = 0; i < kBucketCount; ++i) {
+        buckets[i] += other.buckets[i];
+    }
+    count += other.count;
+    totalNanos += other.totalNanos;
+    minNanos = std::min(minNanos, other.minNanos);
+    maxNanos = std::max(maxNanos, other.maxNanos);
+}
+
+double TimingHistogram::percentileNanos(double p) const {
+    if (count == 0) {
+        return 0.0;
+    }
+
+    const double rank = std::clamp(p, 0.0, 1.0) * static_cast<double>(count);
+    double seen = 0.0;
+
+    for (std::size_t i = 0; i < kBucketCount; ++i) {
+        if (buckets[i] == 0) {
+            continue;
+        }
+
+        const double next = seen + static_cast<double>(buckets[i]);
+        if (rank <= next) {
+            // Interpolate within the bucket, clamped to the observed range
+            const double low = i == 0 ? 0.0 : std::ldexp(1.0, static_cast<int>(i));
+            const double high = std::ldexp(1.0, static_cast<int>(i) + 1);
+            const double value = low + (high - low) * (rank - seen) / static_cast<double>(buckets[i]);
+            return std::clamp(value, static_cast<double>(minNanos), static_cast<double>(maxNanos));
+        }
+        seen = next;
+    }
+
+    return static_cast<double>(maxNanos);
+}
+
+void PerfStats::clear() {
+    for (auto& histogram : phases) {
+        histogram.clear();
+    }
+    for (auto& layer : layers) {
+        layer = LayerPerfStats{};
+    }
+    steps.clear();
+    allocations = utils::AllocationCounts{};
+    samples = 0;
+    stepNanos = 0;
+}
+
+std::string PerfStats::toString() const {
+    std::ostringstream oss;
+    oss << std::fixed << std::setprecision(2);
+    oss << "samples: " << samples << ", samples/s: " << samplesPerSecond() << "\n";
+    if (utils::AllocationTracker::isAvailable()) {
+        oss << "allocations/step: " << allocationsPerStep() << ", bytes/step: "
+            << (steps.count > 0 ? static_cast<double>(allocations.bytes) / static_cast<double>(steps.count) : 0.0)
+            << "\n";
+    }
+
+    oss << "phase        count     mean us    p50 us    p99 us\n";
+    for (std::size_t i = 0; i < phases.size(); ++i) {
+        const auto& histogram = phases[i];
+        oss << std::left << std::setw(12) << getTrainingPhaseName(static_cast<TrainingPhase>(i))
+            << std::right << std::setw(7) << histogram.count
+            << std::setw(12) << histogram.meanNanos() / 1000.0
+            << std::setw(10) << histogram.percentileNanos(0.5) / 1000.0
+            << std::setw(10) << histogram.percentileNanos(0.99) / 1000.0 << "\n";
+    }
+
+    oss << "layer   fwd us  bwd us  upd us  fwd GF/s  bwd GF/s  upd GF/s\n";
+    for (std::size_t l = 1; l < layers.size(); ++l) {
+        const auto& layer = layers[l];
+        oss << std::setw(5) << l
+            << std::setw(9) << layer.forward.meanNanos() / 1000.0
+            << std::setw(8) << layer.backward.meanNanos() / 1000.0
+            << std::setw(8) << layer.update.meanNanos() / 1000.0
+            << std::setw(10) << layer.forwardGflops()
+            << std::setw(10) << layer.backwardGflops()
+            << std::setw(10) << layer.updateGflops() << "\n";
+    }
+
+    if (hardwareCounters) {
+        // Low IPC with a high LLC miss rate points at memory, high IPC at compute
+        oss << "layer  fwd IPC  bwd IPC  upd IPC  fwd LLC%  bwd LLC%  upd LLC%  fwd br%  bwd br%  upd br%\n";
+        for (std::size_t l = 1; l < layers.size(); ++l) {
+            const auto& layer = layers[l];
+            oss << std::setw(5) << l
+                << std::setw(9) << layer.forwardCounters.ipc()
+                << std::setw(9) << layer.backwardCounters.ipc()
+                << std::setw(9) << layer.updateCounters.ipc()
+                << std::setw(10) << layer.forwardCounters.cacheMissRate() * 100.0
+                << std::setw(10) << layer.backwardCounters.cacheMissRate() * 100.0
+                << std::setw(10) << layer.updateCounters.cacheMissRate() * 100.0
+                << std::setw(9) << layer.forwardCounters.branchMissRate() * 100.0
+                << std::setw(9) << layer.backwardCounters.branchMissRate() * 100.0
+                << std::setw(9) << layer.updateCounters.branchMissRate() * 100.0 << "\n";
+        }
+    }
+
+    return oss.str();
+}
+
+} // namespace core
+} // namespace nnv
@@ -7,6 +7,8 @@
 
 #include "graphics/AnimationSystem.hpp"
 #include "graphics/ColorScheme.hpp"
+#include "utils/AllocationTracker.hpp"
+#include "utils/Profiler.hpp"
 #include <cmath>
 #include <algorithm>
 
@@ -214,6 +216,9 @@ AnimationSystem::AnimationSystem(const AnimationConfig& config)
 }
 
 void AnimationSystem::update(float deltaTime) {
+    NNV_PROFILE_SCOPE_CAT("AnimationSystem::update", "render");
+    NNV_ALLOCATION_SCOPE(Animation);
+    
     if (!enabled_) {
         return;
     }
@@ -0,0 +1,373 @@
+/**
+ * @file FrameBuilder.cpp
+ * @brief Implementation of headless per-frame geometry generation
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#include "graphics/FrameBuilder.hpp"
+#include "core/NeuralNetwork.hpp"
+#include "core/PerfStats.hpp"
+#include "utils/Profiler.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace nnv {
+namespace graphics {
+
+namespace {
+
+constexpr float kPi = 3.14159265358979f;
+
+// On-screen radius in pixels below which neurons use fewer triangles
+constexpr float kFullDetailRadius = 8.0f;
+constexpr float kReducedDetailRadius = 3.0f;
+
+std::size_t segmentCount(NeuronDetail detail) {
+    switch (detail) {
+        case NeuronDetail::Full:    return 16;
+        case NeuronDetail::Reduced: return 6;
+        default:                    return 4;
+    }
+}
+
+bool intersects(float minX, float minY, float maxX, float maxY, const sf::FloatRect& rect) {
+    return maxX >= rect.left && minX <= rect.left + rect.width
+        && maxY >= rect.top && minY <= rect.top + rect.height;
+}
+
+sf::FloatRect boundsOf(const std::vector<sf::Vector2f>& points) {
+    if (points.empty()) {
+        return sf::FloatRect();
+    }
+
+    sf::Vector2f low = points.front();
+    sf::Vector2f high = points.front();
+    for (const auto& p : points) {
+        low.x = std::min(low.x, p.x);
+        low.y = std::min(low.y, p.y);
+        high.x = std::max(high.x, p.x);
+        high.y = std::max(high.y, p.y);
+    }
+    return sf::FloatRect(low.x, low.y, high.x - low.x, high.y - low.y);
+}
+
+std::size_t colorIndex(float t) {
+    t = std::max(0.0f, std::min(1.0f, t));
+    return static_cast<std::size_t>(t * 255.0f + 0.5f);
+}
+
+// Calls visit(bitIndex) for every set bit
+template<typename Visit>
+void forEachSetBit(const std::vector<std::uint64_t>& mask, Visit&& visit) {
+    for (std::size_t w = 0; w < mask.size(); ++w) {
+        std::uint64_t word = mask[w];
+        while (word != 0) {
+            const std::size_t bit = static_cast<std::size_t>(__builtin_ctzll(word));
+            visit(w * 64 + bit);
+            word &= word - 1;
+        }
+    }
+}
+
+} // namespace
+
+const char* getFrameStageName(FrameStage stage) {
+    switch (stage) {
+        case FrameStage::Layout:        return "layout";
+        case FrameStage::Culling:       return "culling";
+        case FrameStage::LevelOfDetail: return "lod";
+        case FrameStage::Colors:        return "colors";
+        case FrameStage::Geometry:      return "geometry";
+        default:                        return "unknown";
+    }
+}
+
+std::uint64_t FrameStats::totalNanos() const {
+    std::uint64_t total = 0;
+    for (auto nanos : stageNanos) {
+        total += nanos;
+    }
+    return total;
+}
+
+void FrameGeometry::fillRenderStats(RenderStats& renderStats) const {
+    renderStats.neuronsRendered = static_cast<int>(stats.neuronsVisible);
+    renderStats.connectionsRendered = static_cast<int>(stats.connectionsDrawn);
+    renderStats.drawCalls = (neuronTriangles.empty() ? 0 : 1) + (connectionLines.empty() ? 0 : 1);
+    renderStats.memoryUsage = vertexCount() * sizeof(sf::Vertex);
+}
+
+FrameBuilder::FrameBuilder(const RenderConfig& config)
+    : config_(config)
+{
+}
+
+const FrameGeometry& FrameBuilder::build(const core::DefaultNetwork& network, const Viewport& viewport) {
+    NNV_PROFILE_SCOPE_CAT("FrameBuilder::build", "render");
+    NNV_ALLOCATION_SCOPE(Rendering);
+    const utils::AllocationProbe allocations;
+    geometry_.stats = FrameStats{};
+
+    const auto timeStage = [this](FrameStage stage, auto&& run) {
+        const auto start = core::PerfClock::now();
+        run();
+        geometry_.stats.stageNanos[static_cast<std::size_t>(stage)] = core::nanosSince(start);
+    };
+
+    timeStage(FrameStage::Layout, [&]() { computeLayout(network, viewport); });
+    timeStage(FrameStage::Culling, [&]() { cull(network, viewport); });
+    timeStage(FrameStage::LevelOfDetail, [&]() { selectLevelOfDetail(network); });
+    timeStage(FrameStage::Colors, [&]() { computeColors(network); });
+    timeStage(FrameStage::Geometry, [&]() { generateGeometry(); });
+
+    geometry_.stats.allocations = allocations.counts();
+    return geometry_;
+}
+
+void FrameBuilder::computeLayout(const core::DefaultNetwork& network, const Viewport& viewport) {
+    NNV_PROFILE_SCOPE_CAT("FrameBuilder::layout", "render");
+    const std::size_t layerCount = network.getLayerCount();
+    positions_.resize(layerCount);
+    layerBounds_.resize(layerCount);
+
+    for (std::size_t l = 0; l < layerCount; ++l) {
+        const std::size_t size = network.getLayer(l).getSize();
+        auto& positions = positions_[l];
+        positions.resize(size);
+
+        for (std::size_t i = 0; i < size; ++i) {
+            positions[i] = viewport.worldToScreen(config_.getNeuronPosition(l, i, size, layerCount));
+        }
+        layerBounds_[l] = boundsOf(positions);
+        geometry_.stats.neuronsTotal += size;
+    }
+
+    screenRadius_ = config_.neuron.radius * viewport.zoom;
+}
+
+void FrameBuilder::cull(const core::DefaultNetwork& network, const Viewport& viewport) {
+    NNV_PROFILE_SCOPE_CAT("FrameBuilder::culling", "render");
+    const std::size_t layerCount = network.getLayerCount();
+    neuronVisible_.resize(layerCount);
+    connectionVisible_.resize(layerCount);
+    maxAbsWeight_ = 0.0f;
+
+    // Viewport bounds give the screen size; positions are already in screen space
+    const float margin = config_.cullingMargin;
+    const sf::FloatRect screen(-margin, -margin,
+                               viewport.bounds.width + 2.0f * margin,
+                               viewport.bounds.height + 2.0f * margin);
+    const bool culling = config_.enableCulling;
+    auto& stats = geometry_.stats;
+
+    for (std::size_t l = 0; l < layerCount; ++l) {
+        const auto& positions = positions_[l];
+        auto& visible = neuronVisible_[l];
+        visible.assign(positions.size(), 1);
+
+        if (culling) {
+            for (std::size_t i = 0; i < positions.size(); ++i) {
+                const sf::Vector2f& p = positions[i];
+                visible[i] = intersects(p.x - screenRadius_, p.y - screenRadius_,
+                                        p.x + screenRadius_, p.y + screenRadius_, screen) ? 1 : 0;
+            }
+        }
+        stats.neuronsVisible += static_cast<std::size_t>(std::count(visible.begin(), visible.end(), 1));
+
+        auto& mask = connectionVisible_[l];
+        if (l == 0) {
+            mask.clear();
+            continue;
+        }
+
+        // A connection is kept if its bounding box touches the screen
+        const auto& layer = network.getLayer(l);
+        const auto& from = positions_[l - 1];
+        const std::size_t fanIn = layer.getInputSize();
+        mask.assign((positions.size() * fanIn + 63) / 64, 0);
+        stats.connectionsTotal += positions.size() * fanIn;
+
+        // Every connection lies inside the box around both layers: skip off-screen layer pairs
+        if (culling && !intersects(std::min(layerBounds_[l - 1].left, layerBounds_[l].left),
+                                   std::min(layerBounds_[l - 1].top, layerBounds_[l].top),
+                                   std::max(layerBounds_[l - 1].left + layerBounds_[l - 1].width,
+                                            layerBounds_[l].left + layerBounds_[l].width),
+                                   std::max(layerBounds_[l - 1].top + layerBounds_[l - 1].height,
+                                            layerBounds_[l].top + layerBounds_[l].height), screen)) {
+            continue;
+        }
+
+        for (std::size_t k = 0; k < positions.size(); ++k) {
+            const sf::Vector2f& end = positions[k];
+            const float* row = layer.getWeightRow(k);
+            const std::size_t base = k * fanIn;
+
+            for (std::size_t i = 0; i < fanIn; ++i) {
+                const sf::Vector2f& start = from[i];
+                if (culling && !intersects(std::min(start.x, end.x), std::min(start.y, end.y),
+                                           std::max(start.x, end.x), std::max(start.y, end.y), screen)) {
+                    continue;
+                }
+                mask[(base + i) / 64] |= std::uint64_t{1} << ((base + i) % 64);
+                maxAbsWeight_ = std::max(maxAbsWeight_, std::abs(row[i]));
+                ++stats.connectionsVisible;
+            }
+        }
+    }
+}
+
+std::size_t FrameBuilder::weightBucket(float weight) const {
+    const float scaled = std::abs(weight) / maxAbsWeight_ * static_cast<float>(kWeightBuckets);
+    return std::min(kWeightBuckets - 1, static_cast<std::size_t>(scaled));
+}
+
+void FrameBuilder::selectLevelOfDetail(const core::DefaultNetwork& network) {
+    NNV_PROFILE_SCOPE_CAT("FrameBuilder::lod", "render");
+    auto& stats = geometry_.stats;
+
+    stats.neuronDetail = NeuronDetail::Full;
+    if (config_.enableLOD) {
+        stats.neuronDetail = screenRadius_ >= kFullDetailRadius ? NeuronDetail::Full
+                           : screenRadius_ >= kReducedDetailRadius ? NeuronDetail::Reduced
+                           : NeuronDetail::Minimal;
+    }
+
+    drawnConnections_.clear();
+    const std::size_t budget = static_cast<std::size_t>(std::max(0, config_.maxVisibleConnections));
+    if (budget == 0 || stats.connectionsVisible == 0 || maxAbsWeight_ <= 0.0f) {
+        return;
+    }
+
+    const float threshold = config_.enableLOD ? config_.connection.weightThreshold : 0.0f;
+    const std::size_t layerCount = network.getLayerCount();
+
+    // Keep the strongest connections: find the lowest |weight| bucket that fits the budget
+    std::size_t cutoff = 0;
+    if (stats.connectionsVisible > budget) {
+        std::array<std::size_t, kWeightBuckets> histogram{};
+        for (std::size_t l = 1; l < layerCount; ++l) {
+            // Mask bits index the row-major weight matrix directly
+            const float* weights = network.getLayer(l).getWeightData();
+            forEachSetBit(connectionVisible_[l], [&](std::size_t bit) {
+                if (std::abs(weights[bit]) >= threshold) {
+                    ++histogram[weightBucket(weights[bit])];
+                }
+            });
+        }
+
+        std::size_t kept = 0;
+        cutoff = kWeightBuckets;
+        while (cutoff > 0 && kept + histogram[cutoff - 1] <= budget) {
+            kept += histogram[--cutoff];
+        }
+        // Even the strongest bucket alone exceeds the budget: take it truncated
+        cutoff = std::min(cutoff, kWeightBuckets - 1);
+    }
+
+    for (std::size_t l = 1; l < layerCount && drawnConnections_.size() < budget; ++l) {
+        const auto& layer = network.getLayer(l);
+        const std::size_t fanIn = layer.getInputSize();
+        const float* weights = layer.getWeightData();
+
+        forEachSetBit(connectionVisible_[l], [&](std::size_t bit) {
+            const float weight = weights[bit];
+            if (drawnConnections_.size() >= budget || std::abs(weight) < threshold
+                || weightBucket(weight) < cutoff) {
+                return;
+            }
+            drawnConnections_.push_back({static_cast<std::uint32_t>(l),
+                                         static_cast<std::uint32_t>(bit / fanIn),
+                                         static_cast<std::uint32_t>(bit % fanIn),
+                                         weight});
+        });
+    }
+
+    stats.connectionsDrawn = drawnConnections_.size();
+}
+
+void FrameBuilder::computeColors(const core::DefaultNetwork& network) {
+    NNV_PROFILE_SCOPE_CAT("FrameBuilder::colors", "render");
+
+    // Colors are 8-bit, so 256-entry tables are exact up to rounding
+    if (!colorTablesValid_) {
+        for (std::size_t j = 0; j < kColorTableSize; ++j) {
+            const float t = static_cast<float>(j) / static_cast<float>(kColorTableSize - 1);
+            activationColors_[j] = colorManager_.getActivationColor(t, config_.colorScheme);
+            weightColors_[j] = colorManager_.getWeightColor(2.0f * t - 1.0f, 1.0f, config_.colorScheme);
+        }
+        colorTablesValid_ = true;
+    }
+
+    const std::size_t layerCount = network.getLayerCount();
+    neuronColors_.resize(layerCount);
+    for (std::size_t l = 0; l < layerCount; ++l) {
+        const auto& activations = network.getLayer(l).getActivations();
+        const auto& visible = neuronVisible_[l];
+        auto& colors = neuronColors_[l];
+        colors.resize(visible.size());
+
+        for (std::size_t i = 0; i < visible.size(); ++i) {
+            if (visible[i]) {
+                colors[i] = activationColors_[colorIndex(static_cast<float>(activations[i]))];
+            }
+        }
+    }
+
+    connectionColors_.resize(drawnConnections_.size());
+    const float alpha = std::max(0.0f, std::min(1.0f, config_.connection.alphaMultiplier));
+    for (std::size_t c = 0; c < drawnConnections_.size(); ++c) {
+        const float normalized = drawnConnections_[c].weight / maxAbsWeight_;
+        sf::Color color = weightColors_[colorIndex(0.5f * (normalized + 1.0f))];
+        // Weak connections fade out so strong ones stand out in dense layers
+        color.a = static_cast<sf::Uint8>(color.a * alpha * (0.25f + 0.75f * std::abs(normalized)));
+        connectionColors_[c] = color;
+    }
+}
+
+void FrameBuilder::generateGeometry() {
+    NNV_PROFILE_SCOPE_CAT("FrameBuilder::geometry", "render");
+    auto& triangles = geometry_.neuronTriangles;
+    auto& lines = geometry_.connectionLines;
+    const auto& stats = geometry_.stats;
+
+    // Unit polygon for the chosen detail; quads are rotated 45 degrees to be axis-aligned
+    const std::size_t segments = segmentCount(stats.neuronDetail);
+    const float rotation = stats.neuronDetail == NeuronDetail::Minimal ? kPi / 4.0f : 0.0f;
+    std::array<sf::Vector2f, 17> ring;
+    for (std::size_t s = 0; s <= segments; ++s) {
+        const float angle = rotation + 2.0f * kPi * static_cast<float>(s) / static_cast<float>(segments);
+        ring[s] = sf::Vector2f(std::cos(angle) * screenRadius_, std::sin(angle) * screenRadius_);
+    }
+
+    triangles.clear();
+    triangles.reserve(stats.neuronsVisible * segments * 3);
+    for (std::size_t l = 0; l < positions_.size(); ++l) {
+        const auto& positions = positions_[l];
+        const auto& visible = neuronVisible_[l];
+        const auto& colors = neuronColors_[l];
+
+        for (std::size_t i = 0; i < positions.size(); ++i) {
+            if (!visible[i]) {
+                continue;
+            }
+            const sf::Vector2f& center = positions[i];
+            for (std::size_t s = 0; s < segments; ++s) {
+                triangles.emplace_back(center, colors[i]);
+                triangles.emplace_back(center + ring[s], colors[i]);
+                triangles.emplace_back(center + ring[s + 1], colors[i]);
+            }
+        }
+    }
+
+    lines.clear();
+    lines.reserve(drawnConnections_.size() * 2);
+    for (std::size_t c = 0; c < drawnConnections_.size(); ++c) {
+        const auto& connection = drawnConnections_[c];
+        lines.emplace_back(positions_[connection.layer - 1][connection.from], connectionColors_[c]);
+        lines.emplace_back(positions_[connection.layer][connection.to], connectionColors_[c]);
+    }
+}
+
+} // namespace graphics
+} // namespace nnv
@@ -7,6 +7,8 @@
 
 #include "graphics/RenderConfig.hpp"
 #include "graphics/ColorScheme.hpp"
+#include "utils/AllocationTracker.hpp"
+#include "utils/MetricsServer.hpp"
 #include <cmath>
 #include <algorithm>
 
@@ -230,5 +232,20 @@ nlohmann::json RenderConfig::toJson() const {
     return json;
 }
 
+void RenderStats::writeMetrics(utils::MetricsWriter& out) const {
+    out.gauge("nnv_render_fps", "Frames per second", fps);
+    out.gauge("nnv_render_frame_seconds", "Render time of the last frame", renderTime * 1e-3);
+    out.gauge("nnv_render_neurons", "Neurons drawn in the last frame", neuronsRendered);
+    out.gauge("nnv_render_connections", "Connections drawn in the last frame", connectionsRendered);
+    out.gauge("nnv_render_draw_calls", "Draw calls in the last frame", drawCalls);
+    out.gauge("nnv_render_memory_bytes", "Memory held by render buffers", static_cast<double>(memoryUsage));
+    if (utils::AllocationTracker::isAvailable()) {
+        out.gauge("nnv_render_frame_allocations", "Heap allocations of the main thread in the last frame",
+                  static_cast<double>(frameAllocations));
+        out.gauge("nnv_render_frame_allocated_bytes", "Bytes allocated by the main thread in the last frame",
+                  static_cast<double>(frameAllocatedBytes));
+    }
+}
+
 } // namespace graphics
 } // namespace nnv
@@ -24,6 +24,9 @@ int main(int argc, char* argv[]) {
         // Initialize logging system
         nnv::utils::Logger::initialize();
         
+        // Keep the frame loop off the log sinks; queued records are flushed at exit
+        nnv::utils::Logger::enableAsync();
+        
         // Log application startup
         NNV_LOG_INFO("Neural Network Visualizer v1.0.0 starting...");
         
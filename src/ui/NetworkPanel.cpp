@@ -7,7 +7,10 @@
 
 #include "ui/NetworkPanel.hpp"
 #include "core/NeuralNetwork.hpp"
+#include "core/IncrementalEvaluator.hpp"
+#include "utils/AllocationTracker.hpp"
 #include "utils/Logger.hpp"
+#include "utils/Profiler.hpp"
 
 #ifdef HAS_IMGUI
 #include <imgui.h>
@@ -30,7 +33,12 @@ NetworkPanel::NetworkPanel()
 {
 }
 
+NetworkPanel::~NetworkPanel() = default;
+
 void NetworkPanel::render() {
+    NNV_PROFILE_SCOPE_CAT("NetworkPanel::render", "ui");
+    NNV_ALLOCATION_SCOPE(UI);
+    
     if (!beginPanel()) {
         return;
     }
@@ -61,6 +69,7 @@ void NetworkPanel::render() {
 
 void NetworkPanel::setNeuralNetwork(std::shared_ptr<core::DefaultNetwork> network) {
     network_ = network;
+    evaluator_.reset();
     initializeFromNetwork();
     modified_ = false;
 }
@@ -128,6 +137,61 @@ std::shared_ptr<core::DefaultNetwork> NetworkPanel::createNetwork() {
     }
 }
 
+bool NetworkPanel::setProbeInput(const std::vector<core::Scalar>& inputs) {
+    if (!network_) {
+        return false;
+    }
+    
+    if (!evaluator_) {
+        evaluator_ = std::make_unique<core::IncrementalEvaluator<core::Scalar>>(*network_);
+    }
+    
+    return evaluator_->evaluate(inputs);
+}
+
+bool NetworkPanel::editWeight(std::size_t layer, std::size_t neuron, std::size_t input, core::Scalar weight) {
+    if (!network_) {
+        return false;
+    }
+    
+    if (!evaluator_ || !evaluator_->isValid()) {
+        // No probe input: plain edit, picked up by the next forward pass
+        if (layer == 0 || layer >= network_->getLayerCount() ||
+            neuron >= network_->getLayer(layer).getSize() ||
+            input >= network_->getLayer(layer).getInputSize()) {
+            NNV_LOG_WARNING("Invalid weight index ({}, {}, {}) for weight edit", layer, neuron, input);
+            return false;
+        }
+        network_->getLayer(layer).getNeuron(neuron).setInputWeight(input, weight);
+        return true;
+    }
+    
+    return evaluator_->setWeight(layer, neuron, input, weight);
+}
+
+bool NetworkPanel::editBias(std::size_t layer, std::size_t neuron, core::Scalar bias) {
+    if (!network_) {
+        return false;
+    }
+    
+    if (!evaluator_ || !evaluator_->isValid()) {
+        if (layer >= network_->getLayerCount() || neuron >= network_->getLayer(layer).getSize()) {
+            return false;
+        }
+        network_->getLayer(layer).getNeuron(neuron).setBias(bias);
+        return true;
+    }
+    
+    return evaluator_->setBias(layer, neuron, bias);
+}
+
+std::vector<core::Scalar> NetworkPanel::getProbeOutputs() const {
+    if (!evaluator_ || !evaluator_->isValid()) {
+        return {};
+    }
+    return evaluator_->getOutputs();
+}
+
 void NetworkPanel::renderNetworkInfo() {
 #ifdef HAS_IMGUI
     ImGui::Text("Network Information");
@@ -0,0 +1,124 @@
+/**
+ * @file AlignedAllocator.cpp
+ * @brief Implementation of aligned allocation and memory tracking
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#include "utils/AlignedAllocator.hpp"
+
+#include <atomic>
+#include <cstdlib>
+
+#ifdef NNV_PLATFORM_WINDOWS
+#include <malloc.h>
+#endif
+
+#ifdef NNV_PLATFORM_LINUX
+#include <sys/mman.h>
+#endif
+
+namespace nnv {
+namespace utils {
+
+namespace {
+
+constexpr std::size_t kCategoryCount = static_cast<std::size_t>(MemoryCategory::Count);
+
+std::atomic<std::size_t> g_allocated[kCategoryCount];
+std::atomic<std::size_t> g_peak[kCategoryCount];
+std::atomic<bool> g_hugePages{true};
+
+std::size_t roundUp(std::size_t value, std::size_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+void recordAllocation(std::size_t bytes, MemoryCategory category) {
+    const auto index = static_cast<std::size_t>(category);
+    const std::size_t current = g_allocated[index].fetch_add(bytes, std::memory_order_relaxed) + bytes;
+
+    std::size_t peak = g_peak[index].load(std::memory_order_relaxed);
+    while (current > peak &&
+           !g_peak[index].compare_exchange_weak(peak, current, std::memory_order_relaxed)) {
+    }
+}
+
+} // namespace
+
+void* MemoryTracker::allocate(std::size_t bytes, MemoryCategory category) {
+    const bool huge = g_hugePages.load(std::memory_order_relaxed) && bytes >= kHugePageSize;
+    const std::size_t alignment = huge ? kHugePageSize : kBufferAlignment;
+    const std::size_t size = roundUp(bytes > 0 ? bytes : 1, alignment);
+
+#ifdef NNV_PLATFORM_WINDOWS
+    void* ptr = _aligned_malloc(size, alignment);
+#else
+    void* ptr = std::aligned_alloc(alignment, size);
+#endif
+
+    if (!ptr) {
+        throw std::bad_alloc();
+    }
+
+#if defined(NNV_PLATFORM_LINUX) && defined(MADV_HUGEPAGE)
+    if (huge) {
+        // Advisory only: ignored when THP is disabled system-wide
+        madvise(ptr, size, MADV_HUGEPAGE);
+    }
+#endif
+
+    recordAllocation(bytes, category);
+    return ptr;
+}
+
+void MemoryTracker::deallocate(void* ptr, std::size_t bytes, MemoryCategory category) noexcept {
+    if (!ptr) {
+        return;
+    }
+
+#ifdef NNV_PLATFORM_WINDOWS
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+
+    g_allocated[static_cast<std::size_t>(category)].fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+std::size_t MemoryTracker::getAllocatedBytes(MemoryCategory category) {
+    return g_allocated[static_cast<std::size_t>(category)].load(std::memory_order_relaxed);
+}
+
+std::size_t MemoryTracker::getPeakBytes(MemoryCategory category) {
+    return g_peak[static_cast<std::size_t>(category)].load(std::memory_order_relaxed);
+}
+
+std::size_t MemoryTracker::getTotalAllocatedBytes() {
+    std::size_t total = 0;
+    for (const auto& allocated : g_allocated) {
+        total += allocated.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+void MemoryTracker::setHugePagesEnabled(bool enabled) {
+    g_hugePages.store(enabled, std::memory_order_relaxed);
+}
+
+bool MemoryTracker::areHugePagesEnabled() {
+    return g_hugePages.load(std::memory_order_relaxed);
+}
+
+const char* MemoryTracker::getCategoryName(MemoryCategory category) {
+    switch (category) {
+        case MemoryCategory::Weights:        return "weights";
+        case MemoryCategory::OptimizerState: return "optimizer_state";
+        case MemoryCategory::Activations:    return "activations";
+        case MemoryCategory::Workspace:      return "workspace";
+        case MemoryCategory::Other:          return "other";
+        default:                             return "unknown";
+    }
+}
+
+} // namespace utils
+} // namespace nnv
@@ -0,0 +1,152 @@
+/**
+ * @file AllocationHooks.cpp
+ * @brief Replacement global operator new/delete that feed AllocationTracker
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ *
+ * Built as the nnv_allocation_hooks object library rather than part of
+ * nnv_utils: replacing the global operators is an opt-in decision of the
+ * final executable.
+ */
+
+#include "utils/AllocationTracker.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+
+#ifdef NNV_PLATFORM_WINDOWS
+#include <malloc.h>
+#endif
+
+using nnv::utils::AllocationTracker;
+
+namespace {
+
+const bool g_hooksRegistered = (AllocationTracker::markAvailable(), true);
+
+void* allocate(std::size_t size) {
+    if (size == 0) {
+        size = 1;
+    }
+
+    for (;;) {
+        if (void* p = std::malloc(size)) {
+            AllocationTracker::recordAllocation(size);
+            return p;
+        }
+        std::new_handler handler = std::get_new_handler();
+        if (!handler) {
+            throw std::bad_alloc();
+        }
+        handler();
+    }
+}
+
+void* allocateAligned(std::size_t size, std::align_val_t alignment) {
+    const auto align = static_cast<std::size_t>(alignment);
+    if (size == 0) {
+        size = 1;
+    }
+
+    for (;;) {
+#ifdef NNV_PLATFORM_WINDOWS
+        void* p = _aligned_malloc(size, align);
+#else
+        void* p = nullptr;
+        if (posix_memalign(&p, std::max(align, sizeof(void*)), size) != 0) {
+            p = nullptr;
+        }
+#endif
+        if (p) {
+            AllocationTracker::recordAllocation(size);
+            return p;
+        }
+        std::new_handler handler = std::get_new_handler();
+        if (!handler) {
+            throw std::bad_alloc();
+        }
+        handler();
+    }
+}
+
+void deallocate(void* p) noexcept {
+    if (p) {
+        AllocationTracker::recordDeallocation();
+        std::free(p);
+    }
+}
+
+void deallocateAligned(void* p) noexcept {
+    if (p) {
+        AllocationTracker::recordDeallocation();
+#ifdef NNV_PLATFORM_WINDOWS
+        _aligned_free(p);
+#else
+        std::free(p);
+#endif
+    }
+}
+
+} // namespace
+
+void* operator new(std::size_t size) {
+    return allocate(size);
+}
+
+void* operator new[](std::size_t size) {
+    return allocate(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    try {
+        return allocate(size);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    try {
+        return allocate(size);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    return allocateAligned(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    return allocateAligned(size, alignment);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    try {
+        return allocateAligned(size, alignment);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    try {
+        return allocateAligned(size, alignment);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void operator delete(void* p) noexcept { deallocate(p); }
+void operator delete[](void* p) noexcept { deallocate(p); }
+void operator delete(void* p, std::size_t) noexcept { deallocate(p); }
+void operator delete[](void* p, std::size_t) noexcept { deallocate(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { deallocate(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { deallocate(p); }
+
+void operator delete(void* p, std::align_val_t) noexcept { deallocateAligned(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { deallocateAligned(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { deallocateAligned(p); }
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept { deallocateAligned(p); }
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept { deallocateAligned(p); }
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept { deallocateAligned(p); }
@@ -0,0 +1,142 @@
+/**
+ * @file AllocationTracker.cpp
+ * @brief Implementation of heap allocation counters
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#include "utils/AllocationTracker.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+
+namespace nnv {
+namespace utils {
+
+namespace {
+
+constexpr std::size_t kTagCount = static_cast<std::size_t>(AllocationTag::Count);
+constexpr std::size_t kMaxThreadSlots = 256;
+
+/**
+ * @brief Counters of one thread, written only by that thread
+ *
+ * The last slot is shared by all threads beyond kMaxThreadSlots and is
+ * updated with atomic read-modify-write instead.
+ */
+struct alignas(64) ThreadSlot {
+    std::array<std::atomic<std::uint64_t>, kTagCount> allocations;
+    std::array<std::atomic<std::uint64_t>, kTagCount> deallocations;
+    std::array<std::atomic<std::uint64_t>, kTagCount> bytes;
+};
+
+// Zero-initialized static storage; the hooks may run before any constructor
+ThreadSlot g_slots[kMaxThreadSlots];
+std::atomic<std::size_t> g_slotCount{0};
+std::atomic<bool> g_available{false};
+
+// Trivial thread_locals need no initialization on first use, which would recurse into operator new
+thread_local ThreadSlot* t_slot = nullptr;
+thread_local bool t_sharedSlot = false;
+thread_local AllocationTag t_tag = AllocationTag::Untagged;
+thread_local std::uint64_t t_allocations = 0;
+thread_local std::uint64_t t_deallocations = 0;
+thread_local std::uint64_t t_bytes = 0;
+
+ThreadSlot& threadSlot() {
+    if (!t_slot) {
+        const std::size_t index = g_slotCount.fetch_add(1, std::memory_order_relaxed);
+        t_sharedSlot = index >= kMaxThreadSlots - 1;
+        t_slot = &g_slots[t_sharedSlot ? kMaxThreadSlots - 1 : index];
+    }
+    return *t_slot;
+}
+
+void increment(std::atomic<std::uint64_t>& counter, std::uint64_t amount) {
+    if (t_sharedSlot) {
+        counter.fetch_add(amount, std::memory_order_relaxed);
+    } else {
+        counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+    }
+}
+
+} // namespace
+
+const char* getAllocationTagName(AllocationTag tag) {
+    switch (tag) {
+        case AllocationTag::Untagged:    return "untagged";
+        case AllocationTag::Training:    return "training";
+        case AllocationTag::Rendering:   return "rendering";
+        case AllocationTag::Animation:   return "animation";
+        case AllocationTag::UI:          return "ui";
+        case AllocationTag::DataLoading: return "data_loading";
+        case AllocationTag::Logging:     return "logging";
+        case AllocationTag::Metrics:     return "metrics";
+        default:                         return "unknown";
+    }
+}
+
+bool AllocationTracker::isAvailable() {
+    return g_available.load(std::memory_order_relaxed);
+}
+
+AllocationCounts AllocationTracker::threadCounts() {
+    AllocationCounts counts;
+    counts.allocations = t_allocations;
+    counts.deallocations = t_deallocations;
+    counts.bytes = t_bytes;
+    return counts;
+}
+
+AllocationCounts AllocationTracker::totalCounts(AllocationTag tag) {
+    const auto index = static_cast<std::size_t>(tag);
+    const std::size_t slots = std::min(g_slotCount.load(std::memory_order_relaxed), kMaxThreadSlots);
+
+    AllocationCounts counts;
+    for (std::size_t i = 0; i < slots; ++i) {
+        counts.allocations += g_slots[i].allocations[index].load(std::memory_order_relaxed);
+        counts.deallocations += g_slots[i].deallocations[index].load(std::memory_order_relaxed);
+        counts.bytes += g_slots[i].bytes[index].load(std::memory_order_relaxed);
+    }
+    return counts;
+}
+
+AllocationCounts AllocationTracker::totalCounts() {
+    AllocationCounts counts;
+    for (std::size_t tag = 0; tag < kTagCount; ++tag) {
+        counts += totalCounts(static_cast<AllocationTag>(tag));
+    }
+    return counts;
+}
+
+AllocationTag AllocationTracker::currentTag() {
+    return t_tag;
+}
+
+AllocationTag AllocationTracker::setCurrentTag(AllocationTag tag) {
+    const AllocationTag previous = t_tag;
+    t_tag = tag;
+    return previous;
+}
+
+void AllocationTracker::recordAllocation(std::size_t bytes) noexcept {
+    ++t_allocations;
+    t_bytes += bytes;
+
+    ThreadSlot& slot = threadSlot();
+    const auto index = static_cast<std::size_t>(t_tag);
+    increment(slot.allocations[index], 1);
+    increment(slot.bytes[index], bytes);
+}
+
+void AllocationTracker::recordDeallocation() noexcept {
+    ++t_deallocations;
+    increment(threadSlot().deallocations[static_cast<std::size_t>(t_tag)], 1);
+}
+
+void AllocationTracker::markAvailable() noexcept {
+    g_available.store(true, std::memory_order_relaxed);
+}
+
+} // namespace utils
+} // namespace nnv
@@ -0,0 +1,502 @@
+/**
+ * @file BinaryDataset.cpp
+ * @brief Implementation of the memory-mapped binary dataset format
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#include "utils/BinaryDataset.hpp"
+#include "utils/Logger.hpp"
+#include "utils/Profiler.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+#ifndef NNV_PLATFORM_WINDOWS
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// The header and arrays are memcpy'd and mapped raw, so the host must match the file's byte order
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+#error ".nnvd files are little endian; big-endian hosts are not supported"
+#endif
+
+namespace nnv {
+namespace utils {
+
+namespace {
+
+std::uint64_t alignArray(std::uint64_t offset) {
+    const std::uint64_t alignment = BinaryDatasetHeader::kArrayAlignment;
+    return (offset + alignment - 1) / alignment * alignment;
+}
+
+std::uint16_t floatToHalf(float value) {
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    const std::uint32_t sign = (bits >> 16) & 0x8000u;
+    const std::uint32_t exponent = (bits >> 23) & 0xFFu;
+    std::uint32_t mantissa = bits & 0x7FFFFFu;
+
+    if (exponent == 0xFFu) {
+        // Inf stays Inf, NaN stays a quiet NaN
+        return static_cast<std::uint16_t>(sign | 0x7C00u | (mantissa ? 0x200u : 0u));
+    }
+
+    const int halfExponent = static_cast<int>(exponent) - 127 + 15;
+    if (halfExponent >= 31) {
+        return static_cast<std::uint16_t>(sign | 0x7C00u);
+    }
+
+    if (halfExponent <= 0) {
+        // Subnormal half (or zero): shift the implicit bit into the mantissa
+        if (halfExponent < -10) {
+            return static_cast<std::uint16_t>(sign);
+        }
+        mantissa |= 0x800000u;
+        const int shift = 14 - halfExponent;
+        std::uint32_t half = mantissa >> shift;
+        const std::uint32_t remainder = mantissa & ((1u << shift) - 1u);
+        const std::uint32_t halfway = 1u << (shift - 1);
+        if (remainder > halfway || (remainder == halfway && (half & 1u))) {
+            ++half;
+        }
+        return static_cast<std::uint16_t>(sign | half);
+    }
+
+    std::uint32_t half = (static_cast<std::uint32_t>(halfExponent) << 10) | (mantissa >> 13);
+    const std::uint32_t remainder = mantissa & 0x1FFFu;
+    if (remainder > 0x1000u || (remainder == 0x1000u && (half & 1u))) {
+        // A carry out of the mantissa correctly bumps the exponent, up to Inf
+        ++half;
+    }
+    return static_cast<std::uint16_t>(sign | half);
+}
+
+float halfToFloat(std::uint16_t half) {
+    const std::uint32_t sign = static_cast<std::uint32_t>(half & 0x8000u) << 16;
+    std::uint32_t exponent = (half >> 10) & 0x1Fu;
+    std::uint32_t mantissa = half & 0x3FFu;
+    std::uint32_t bits;
+
+    if (exponent == 0x1Fu) {
+        bits = sign | 0x7F800000u | (mantissa << 13);
+    } else if (exponent != 0) {
+        bits = sign | ((exponent + 127 - 15) << 23) | (mantissa << 13);
+    } else if (mantissa == 0) {
+        bits = sign;
+    } else {
+        // Normalize a subnormal half
+        exponent = 127 - 15 + 1;
+        while ((mantissa & 0x400u) == 0) {
+            mantissa <<= 1;
+            --exponent;
+        }
+        bits = sign | (exponent << 23) | ((mantissa & 0x3FFu) << 13);
+    }
+
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+template<typename T>
+void encodeValues(const std::vector<T>& values, DatasetElementType type, float scale,
+                  std::vector<unsigned char>& out) {
+    const std::size_t start = out.size();
+    out.resize(start + values.size() * getDatasetElementSize(type));
+    unsigned char* dst = out.data() + start;
+
+    switch (type) {
+        case DatasetElementType::UInt8:
+            for (std::size_t i = 0; i < values.size(); ++i) {
+                const float step = std::round(static_cast<float>(values[i]) / scale);
+                dst[i] = static_cast<unsigned char>(std::clamp(step, 0.0f, 255.0f));
+            }
+            break;
+        case DatasetElementType::Float16:
+            for (std::size_t i = 0; i < values.size(); ++i) {
+                const std::uint16_t half = floatToHalf(static_cast<float>(values[i]));
+                std::memcpy(dst + i * sizeof(half), &half, sizeof(half));
+            }
+            break;
+        case DatasetElementType::Float32:
+            for (std::size_t i = 0; i < values.size(); ++i) {
+                const float value = static_cast<float>(values[i]);
+                std::memcpy(dst + i * sizeof(value), &value, sizeof(value));
+            }
+            break;
+    }
+}
+
+template<typename T>
+void decodeValues(const unsigned char* src, std::size_t count, DatasetElementType type, float scale, T* out) {
+    switch (type) {
+        case DatasetElementType::UInt8:
+            for (std::size_t i = 0; i < count; ++i) {
+                out[i] = static_cast<T>(static_cast<float>(src[i]) * scale);
+            }
+            break;
+        case DatasetElementType::Float16:
+            for (std::size_t i = 0; i < count; ++i) {
+                std::uint16_t half;
+                std::memcpy(&half, src + i * sizeof(half), sizeof(half));
+                out[i] = static_cast<T>(halfToFloat(half));
+            }
+            break;
+        case DatasetElementType::Float32:
+            for (std::size_t i = 0; i < count; ++i) {
+                float value;
+                std::memcpy(&value, src + i * sizeof(value), sizeof(value));
+                out[i] = static_cast<T>(value);
+            }
+            break;
+    }
+}
+
+bool isValidElementType(DatasetElementType type) {
+    return getDatasetElementSize(type) != 0;
+}
+
+} // anonymous namespace
+
+const char* getDatasetElementTypeName(DatasetElementType type) {
+    switch (type) {
+        case DatasetElementType::UInt8:   return "u8";
+        case DatasetElementType::Float16: return "f16";
+        case DatasetElementType::Float32: return "f32";
+        default:                          return "unknown";
+    }
+}
+
+std::size_t getDatasetElementSize(DatasetElementType type) {
+    switch (type) {
+        case DatasetElementType::UInt8:   return 1;
+        case DatasetElementType::Float16: return 2;
+        case DatasetElementType::Float32: return 4;
+        default:                          return 0;
+    }
+}
+
+template<typename T>
+bool writeBinaryDataset(const Dataset<T>& dataset, const std::string& filename,
+                        const BinaryDatasetOptions& options) {
+    NNV_PROFILE_SCOPE_CAT("writeBinaryDataset", "data");
+
+    if (dataset.empty() || dataset.targets.size() != dataset.size()) {
+        NNV_LOG_ERROR("Cannot write dataset with {} inputs and {} targets to {}",
+                     dataset.size(), dataset.targets.size(), filename);
+        return false;
+    }
+    if (!isValidElementType(options.inputType) || !isValidElementType(options.targetType) ||
+        !(options.inputScale > 0.0f) || !(options.targetScale > 0.0f)) {
+        NNV_LOG_ERROR("Invalid element types or scales for binary dataset: {}", filename);
+        return false;
+    }
+
+    const std::size_t inputDim = dataset.inputs.front().size();
+    const std::size_t targetDim = dataset.targets.front().size();
+    for (std::size_t i = 0; i < dataset.size(); ++i) {
+        if (dataset.inputs[i].size() != inputDim || dataset.targets[i].size() != targetDim) {
+            NNV_LOG_ERROR("Sample {} has {} inputs and {} targets, expected {} and {}: {}",
+                         i, dataset.inputs[i].size(), dataset.targets[i].size(),
+                         inputDim, targetDim, filename);
+            return false;
+        }
+    }
+
+    // Class names in label index order
+    std::string labels;
+    if (!dataset.labelMap.empty()) {
+        std::vector<std::string> names(dataset.labelMap.size());
+        for (const auto& [name, index] : dataset.labelMap) {
+            if (index >= 0 && static_cast<std::size_t>(index) < names.size()) {
+                names[static_cast<std::size_t>(index)] = name;
+            }
+        }
+        for (const auto& name : names) {
+            labels += name;
+            labels += '\n';
+        }
+    }
+
+    BinaryDatasetHeader header{};
+    std::memcpy(header.magic, BinaryDatasetHeader::kMagic, sizeof(header.magic));
+    header.version = BinaryDatasetHeader::kVersion;
+    header.inputType = options.inputType;
+    header.targetType = options.targetType;
+    header.sampleCount = dataset.size();
+    header.inputDim = static_cast<std::uint32_t>(inputDim);
+    header.targetDim = static_cast<std::uint32_t>(targetDim);
+    header.inputScale = options.inputScale;
+    header.targetScale = options.targetScale;
+    header.inputOffset = BinaryDatasetHeader::kArrayAlignment;
+    header.targetOffset = alignArray(header.inputOffset +
+        header.sampleCount * inputDim * getDatasetElementSize(options.inputType));
+    header.labelsOffset = header.targetOffset +
+        header.sampleCount * targetDim * getDatasetElementSize(options.targetType);
+    header.labelsSize = labels.size();
+
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        NNV_LOG_ERROR("Failed to open file for writing: {}", filename);
+        return false;
+    }
+
+    std::vector<unsigned char> buffer;
+    auto writePadding = [&](std::uint64_t offset) {
+        const std::uint64_t position = static_cast<std::uint64_t>(file.tellp());
+        buffer.assign(static_cast<std::size_t>(offset - position), 0);
+        file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+    };
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    // Encode one sample at a time so the staging buffer stays small
+    writePadding(header.inputOffset);
+    for (const auto& input : dataset.inputs) {
+        buffer.clear();
+        encodeValues(input, options.inputType, options.inputScale, buffer);
+        file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+    }
+
+    writePadding(header.targetOffset);
+    for (const auto& target : dataset.targets) {
+        buffer.clear();
+        encodeValues(target, options.targetType, options.targetScale, buffer);
+        file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+    }
+
+    file.write(labels.data(), static_cast<std::streamsize>(labels.size()));
+
+    if (!file) {
+        NNV_LOG_ERROR("Failed to write binary dataset: {}", filename);
+        return false;
+    }
+
+    NNV_LOG_INFO("Saved {} samples ({} x {}, {} x {}) to binary dataset: {}",
+                dataset.size(), inputDim, getDatasetElementTypeName(options.inputType),
+                targetDim, getDatasetElementTypeName(options.targetType), filename);
+    return true;
+}
+
+MappedDataset::~MappedDataset() {
+    close();
+}
+
+bool MappedDataset::open(const std::string& filename, DatasetAccess access) {
+    NNV_PROFILE_SCOPE_CAT("MappedDataset::open", "data");
+    close();
+
+#ifdef NNV_PLATFORM_WINDOWS
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        NNV_LOG_ERROR("Failed to open binary dataset: {}", filename);
+        return false;
+    }
+    fallback_.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    const unsigned char* data = fallback_.data();
+    const std::size_t fileSize = fallback_.size();
+#else
+    const int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        NNV_LOG_ERROR("Failed to open binary dataset: {}", filename);
+        return false;
+    }
+
+    struct stat info {};
+    if (fstat(fd, &info) != 0 || info.st_size < static_cast<off_t>(sizeof(BinaryDatasetHeader))) {
+        NNV_LOG_ERROR("Binary dataset is too small to hold a header: {}", filename);
+        ::close(fd);
+        return false;
+    }
+    const std::size_t fileSize = static_cast<std::size_t>(info.st_size);
+
+    // MAP_SHARED read-only: every process training on this file shares its page cache
+    void* mapping = mmap(nullptr, fileSize, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+        NNV_LOG_ERROR("Failed to map binary dataset {} ({} bytes)", filename, fileSize);
+        return false;
+    }
+    const unsigned char* data = static_cast<const unsigned char*>(mapping);
+#endif
+
+    if (fileSize < sizeof(BinaryDatasetHeader)) {
+        NNV_LOG_ERROR("Binary dataset is too small to hold a header: {}", filename);
+        data_ = data;
+        fileSize_ = fileSize;
+        close();
+        return false;
+    }
+
+    BinaryDatasetHeader header;
+    std::memcpy(&header, data, sizeof(header));
+
+    bool valid = std::memcmp(header.magic, BinaryDatasetHeader::kMagic, sizeof(header.magic)) == 0 &&
+                 header.version == BinaryDatasetHeader::kVersion &&
+                 isValidElementType(header.inputType) && isValidElementType(header.targetType);
+    if (valid) {
+        // Check every array lies inside the file, guarding against overflow from a corrupt header
+        const std::uint64_t limit = fileSize;
+        const std::uint64_t inputBytes = header.sampleCount * header.inputDim *
+                                         getDatasetElementSize(header.inputType);
+        const std::uint64_t targetBytes = header.sampleCount * header.targetDim *
+                                          getDatasetElementSize(header.targetType);
+        const bool noOverflow = header.inputDim == 0 || header.sampleCount <= limit / header.inputDim;
+        const bool noTargetOverflow = header.targetDim == 0 || header.sampleCount <= limit / header.targetDim;
+        // Aligned offsets keep getRawInputs()/getRawTargets() safe to read as float or half arrays
+        const bool aligned = header.inputOffset % BinaryDatasetHeader::kArrayAlignment == 0 &&
+                             header.targetOffset % BinaryDatasetHeader::kArrayAlignment == 0;
+        valid = noOverflow && noTargetOverflow && aligned &&
+                header.inputOffset <= limit && inputBytes <= limit - header.inputOffset &&
+                header.targetOffset <= limit && targetBytes <= limit - header.targetOffset &&
+                header.labelsOffset <= limit && header.labelsSize <= limit - header.labelsOffset;
+    }
+    if (!valid) {
+        NNV_LOG_ERROR("Not a valid or complete .nnvd dataset: {}", filename);
+        data_ = data;
+        fileSize_ = fileSize;
+        close();
+        return false;
+    }
+
+    data_ = data;
+    fileSize_ = fileSize;
+    header_ = header;
+
+    const char* labels = reinterpret_cast<const char*>(data_ + header_.labelsOffset);
+    std::size_t start = 0;
+    for (std::size_t i = 0; i < header_.labelsSize; ++i) {
+        if (labels[i] == '\n') {
+            classNames_.emplace_back(labels + start, i - start);
+            start = i + 1;
+        }
+    }
+
+    setAccessPattern(access);
+
+    NNV_LOG_INFO("Mapped {} samples ({} x {}, {} x {}) from binary dataset: {}",
+                size(), getInputDim(), getDatasetElementTypeName(getInputType()),
+                getTargetDim(), getDatasetElementTypeName(getTargetType()), filename);
+    return true;
+}
+
+void MappedDataset::close() {
+    if (!data_) {
+        return;
+    }
+
+#ifdef NNV_PLATFORM_WINDOWS
+    fallback_.clear();
+    fallback_.shrink_to_fit();
+#else
+    munmap(const_cast<unsigned char*>(data_), fileSize_);
+#endif
+
+    data_ = nullptr;
+    fileSize_ = 0;
+    header_ = BinaryDatasetHeader{};
+    classNames_.clear();
+}
+
+void MappedDataset::setAccessPattern(DatasetAccess access) {
+#ifndef NNV_PLATFORM_WINDOWS
+    if (!data_) {
+        return;
+    }
+    // Sequential epochs want read-ahead; shuffled ones would only waste it
+    const int advice = access == DatasetAccess::Random ? MADV_RANDOM : MADV_SEQUENTIAL;
+    if (madvise(const_cast<unsigned char*>(data_), fileSize_, advice) != 0) {
+        NNV_LOG_DEBUG("madvise failed for mapped dataset ({} bytes)", fileSize_);
+    }
+#else
+    (void)access;
+#endif
+}
+
+template<typename T>
+void MappedDataset::readInput(std::size_t index, T* out) const {
+    const std::size_t stride = header_.inputDim * getDatasetElementSize(header_.inputType);
+    decodeValues(data_ + header_.inputOffset + index * stride, header_.inputDim,
+                 header_.inputType, header_.inputScale, out);
+}
+
+template<typename T>
+void MappedDataset::readTarget(std::size_t index, T* out) const {
+    const std::size_t stride = header_.targetDim * getDatasetElementSize(header_.targetType);
+    decodeValues(data_ + header_.targetOffset + index * stride, header_.targetDim,
+                 header_.targetType, header_.targetScale, out);
+}
+
+template<typename T>
+void MappedDataset::readBatch(const std::size_t* indices, std::size_t count,
+                              std::vector<std::vector<T>>& inputs,
+                              std::vector<std::vector<T>>& targets) const {
+    inputs.resize(count);
+    targets.resize(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        inputs[i].resize(header_.inputDim);
+        targets[i].resize(header_.targetDim);
+        readInput(indices[i], inputs[i].data());
+        readTarget(indices[i], targets[i].data());
+    }
+}
+
+template<typename T>
+Dataset<T> MappedDataset::toDataset() const {
+    Dataset<T> dataset;
+    if (!data_) {
+        return dataset;
+    }
+
+    dataset.inputs.resize(size());
+    dataset.targets.resize(size());
+    for (std::size_t i = 0; i < size(); ++i) {
+        dataset.inputs[i].resize(header_.inputDim);
+        dataset.targets[i].resize(header_.targetDim);
+        readInput(i, dataset.inputs[i].data());
+        readTarget(i, dataset.targets[i].data());
+    }
+
+    for (std::size_t i = 0; i < classNames_.size(); ++i) {
+        dataset.labelMap[classNames_[i]] = static_cast<int>(i);
+    }
+
+    // Per-sample names can be recovered when targets are class indices
+    if (!classNames_.empty() && header_.targetDim == 1) {
+        dataset.labels.reserve(size());
+        for (const auto& target : dataset.targets) {
+            const auto index = static_cast<std::size_t>(std::max<T>(target[0], T{0}));
+            dataset.labels.push_back(index < classNames_.size() ? classNames_[index] : std::string{});
+        }
+    }
+
+    return dataset;
+}
+
+// Explicit template instantiations
+template bool writeBinaryDataset<float>(const Dataset<float>&, const std::string&, const BinaryDatasetOptions&);
+template bool writeBinaryDataset<double>(const Dataset<double>&, const std::string&, const BinaryDatasetOptions&);
+template void MappedDataset::readInput<float>(std::size_t, float*) const;
+template void MappedDataset::readInput<double>(std::size_t, double*) const;
+template void MappedDataset::readTarget<float>(std::size_t, float*) const;
+template void MappedDataset::readTarget<double>(std::size_t, double*) const;
+template void MappedDataset::readBatch<float>(const std::size_t*, std::size_t,
+                                              std::vector<std::vector<float>>&,
+                                              std::vector<std::vector<float>>&) const;
+template void MappedDataset::readBatch<double>(const std::size_t*, std::size_t,
+                                               std::vector<std::vector<double>>&,
+                                               std::vector<std::vector<double>>&) const;
+template Dataset<float> MappedDataset::toDataset<float>() const;
+template Dataset<double> MappedDataset::toDataset<double>() const;
+
+} // namespace utils
+} // namespace nnv
@@ -33,6 +33,7 @@ bool ConfigManager::parseCommandLine(int argc, char* argv[]) {
             std::cout << "  --fullscreen, -f        Start in fullscreen mode\n";
             std::cout << "  --log-level, -l <level> Set log level (debug, info, warning, error, critical)\n";
             std::cout << "  --log-file <file>       Set log file path\n";
+            std::cout << "  --metrics-port <port>   Serve Prometheus metrics on 127.0.0.1:<port>/metrics\n";
             return false;
         }
         else if ((arg == "--config" || arg == "-c") && i + 1 < argc) {
@@ -72,6 +73,15 @@ bool ConfigManager::parseCommandLine(int argc, char* argv[]) {
         else if (arg == "--log-file" && i + 1 < argc) {
             set("logging.file", std::string(argv[++i]));
         }
+        else if (arg == "--metrics-port" && i + 1 < argc) {
+            try {
+                int port = std::stoi(argv[++i]);
+                set("metrics.port", port);
+            } catch (const std::exception& e) {
+                std::cerr << "Invalid metrics port: " << argv[i] << std::endl;
+                return false;
+            }
+        }
         else {
             std::cerr << "Unknown argument: " << arg << std::endl;
             return false;
@@ -163,9 +173,21 @@ core::NetworkConfig ConfigManager::loadNetworkConfig(const nlohmann::json& json)
     }
     
     if (json.contains("optimizer")) {
-        config.optimizer = parseOptimizerType(json["optimizer"].get<std::string>());
+        const auto& optimizerJson = json["optimizer"];
+
+        // Either "adam" or {"type": "adam", "learning_rate": 0.01, ...}
+        if (optimizerJson.is_object()) {
+            if (optimizerJson.contains("type")) {
+                config.optimizer = parseOptimizerType(optimizerJson["type"].get<std::string>());
+            }
+            if (optimizerJson.contains("learning_rate")) {
+                config.training.learning_rate = optimizerJson["learning_rate"].get<core::Scalar>();
+            }
+        } else {
+            config.optimizer = parseOptimizerType(optimizerJson.get<std::string>());
+        }
     }
-    
+
     if (json.contains("loss")) {
         config.loss = parseLossType(json["loss"].get<std::string>());
     }
@@ -273,6 +295,10 @@ nlohmann::json ConfigManager::getDefaultConfig() {
     config["logging"]["file"] = "";
     config["logging"]["console"] = true;
     
+    // Prometheus metrics endpoint (port 0 disables it)
+    config["metrics"]["port"] = 0;
+    config["metrics"]["bind_address"] = "127.0.0.1";
+    
     // Startup settings
     config["startup"]["network_file"] = "";
     config["startup"]["auto_load_last"] = false;
@@ -6,7 +6,10 @@
  */
 
 #include "utils/DataLoader.hpp"
+#include "utils/AllocationTracker.hpp"
+#include "utils/BinaryDataset.hpp"
 #include "utils/Logger.hpp"
+#include "utils/Profiler.hpp"
 #include <fstream>
 #include <sstream>
 #include <algorithm>
@@ -57,6 +60,8 @@ template<typename T>
 Dataset<T> DataLoader<T>::loadFromFile(const std::string& filename,
                                       DataFormat format,
                                       const PreprocessingConfig& config) {
+    NNV_PROFILE_SCOPE_CAT("DataLoader::loadFromFile", "data");
+    NNV_ALLOCATION_SCOPE(DataLoading);
     if (format == DataFormat::CSV) {
         format = detectFormat(filename);
     }
@@ -68,6 +73,9 @@ Dataset<T> DataLoader<T>::loadFromFile(const std::string& filename,
             case DataFormat::CSV:
                 dataset = loadCSV(filename);
                 break;
+            case DataFormat::Binary:
+                dataset = loadBinary(filename);
+                break;
             case DataFormat::Image:
                 // For single image, create dataset with one sample
                 {
@@ -99,6 +107,7 @@ Dataset<T> DataLoader<T>::loadCSV(const std::string& filename,
                                  bool hasHeader,
                                  char delimiter,
                                  int targetColumn) {
+    NNV_PROFILE_SCOPE_CAT("DataLoader::loadCSV", "data");
     Dataset<T> dataset;
     std::ifstream file(filename);
     
@@ -110,8 +119,11 @@ Dataset<T> DataLoader<T>::loadCSV(const std::string& filename,
     std::string line;
     bool firstLine = true;
     std::vector<std::string> headers;
+    std::size_t lineNumber = 0;
+    std::size_t parseFailures = 0;
     
     while (std::getline(file, line)) {
+        ++lineNumber;
         if (line.empty()) continue;
         
         auto values = parseCSVLine(line, delimiter);
@@ -136,7 +148,10 @@ Dataset<T> DataLoader<T>::loadCSV(const std::string& filename,
                 try {
                     input.push_back(static_cast<T>(std::stod(values[i])));
                 } catch (const std::exception&) {
-                    NNV_LOG_WARNING("Failed to parse value '{}' as number", values[i]);
+                    // One bad column repeats on every row; the total is reported below
+                    ++parseFailures;
+                    NNV_LOG_WARNING_RATE_LIMITED(1.0, 5, "Failed to parse value '{}' as number ({}:{})",
+                                                 values[i], filename, lineNumber);
                     input.push_back(T{0});
                 }
             }
@@ -170,13 +185,31 @@ Dataset<T> DataLoader<T>::loadCSV(const std::string& filename,
         firstLine = false;
     }
     
+    if (parseFailures > 0) {
+        NNV_LOG_WARNING("Replaced {} unparseable values with 0 in CSV file: {}", parseFailures, filename);
+    }
     NNV_LOG_INFO("Loaded {} samples from CSV file: {}", dataset.size(), filename);
     return dataset;
 }
 
+template<typename T>
+Dataset<T> DataLoader<T>::loadBinary(const std::string& filename) {
+    NNV_PROFILE_SCOPE_CAT("DataLoader::loadBinary", "data");
+    MappedDataset mapped;
+    // toDataset() reads front to back even when the copy is shuffled later
+    if (!mapped.open(filename, DatasetAccess::Sequential)) {
+        return Dataset<T>{};
+    }
+
+    Dataset<T> dataset = mapped.template toDataset<T>();
+    NNV_LOG_INFO("Loaded {} samples from binary dataset: {}", dataset.size(), filename);
+    return dataset;
+}
+
 template<typename T>
 Dataset<T> DataLoader<T>::loadMNIST(const std::string& imagesFile,
                                    const std::string& labelsFile) {
+    NNV_PROFILE_SCOPE_CAT("DataLoader::loadMNIST", "data");
     Dataset<T> dataset;
     
     try {
@@ -209,6 +242,7 @@ Dataset<T> DataLoader<T>::loadMNIST(const std::string& imagesFile,
 template<typename T>
 Dataset<T> DataLoader<T>::loadImagesFromDirectory(const std::string& directory,
                                                  const PreprocessingConfig& config) {
+    NNV_PROFILE_SCOPE_CAT("DataLoader::loadImagesFromDirectory", "data");
     Dataset<T> dataset;
     
     if (!std::filesystem::exists(directory)) {
@@ -268,7 +302,7 @@ std::vector<T> DataLoader<T>::loadImage(const std::string& filename,
         cv::Mat image = cv::imread(filename, config.grayscale ? cv::IMREAD_GRAYSCALE : cv::IMREAD_COLOR);
         
         if (image.empty()) {
-            NNV_LOG_WARNING("Failed to load image: {}", filename);
+            NNV_LOG_WARNING_RATE_LIMITED(1.0, 5, "Failed to load image: {}", filename);
             return imageData;
         }
         
@@ -310,6 +344,7 @@ std::vector<T> DataLoader<T>::loadImage(const std::string& filename,
 
 template<typename T>
 void DataLoader<T>::preprocess(Dataset<T>& dataset, const PreprocessingConfig& config) {
+    NNV_PROFILE_SCOPE_CAT("DataLoader::preprocess", "data");
     if (dataset.empty()) return;
     
     if (config.shuffle) {
@@ -489,6 +524,8 @@ bool DataLoader<T>::saveToFile(const Dataset<T>& dataset,
 
             NNV_LOG_INFO("Saved {} samples to CSV file: {}", dataset.size(), filename);
             return true;
+        } else if (format == DataFormat::Binary) {
+            return writeBinaryDataset(dataset, filename);
         } else {
             NNV_LOG_ERROR("Unsupported format for saving dataset: {}",
                          static_cast<int>(format));
@@ -515,7 +552,7 @@ DataFormat DataLoader<T>::detectFormat(const std::string& filename) {
         return DataFormat::CSV;
     } else if (ext == ".json") {
         return DataFormat::JSON;
-    } else if (ext == ".bin" || ext == ".dat") {
+    } else if (ext == ".nnvd" || ext == ".bin" || ext == ".dat") {
         return DataFormat::Binary;
     } else if (ext == ".idx3-ubyte" || ext == ".idx1-ubyte") {
         return DataFormat::MNIST;
@@ -0,0 +1,41 @@
+/**
+ * @file EpochReclamation.cpp
+ * @brief Implementation of epoch-based reclamation
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#include "utils/EpochReclamation.hpp"
+#include <thread>
+
+namespace nnv {
+namespace utils {
+
+EpochDomain::Guard EpochDomain::pin() {
+    for (;;) {
+        for (auto& slot : slots_) {
+            std::uint64_t expected = kIdle;
+            // Sequentially consistent so a writer that misses this slot in
+            // isQuiescent() has already swapped the pointer we load next
+            if (slot.epoch.load(std::memory_order_relaxed) == kIdle &&
+                slot.epoch.compare_exchange_strong(expected, epoch_.load())) {
+                return Guard(&slot.epoch);
+            }
+        }
+
+        std::this_thread::yield();
+    }
+}
+
+bool EpochDomain::isQuiescent(std::uint64_t retiredEpoch) const {
+    for (const auto& slot : slots_) {
+        const std::uint64_t pinned = slot.epoch.load();
+        if (pinned != kIdle && pinned <= retiredEpoch) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace utils
+} // namespace nnv
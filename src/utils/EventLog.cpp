@@ -0,0 +1,428 @@
+/**
+ * @file EventLog.cpp
+ * @brief Implementation of the binary event log writer and reader
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#include "utils/EventLog.hpp"
+#include "utils/Logger.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iterator>
+
+#ifndef NNV_PLATFORM_WINDOWS
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace nnv {
+namespace utils {
+
+namespace {
+
+constexpr std::size_t kRecordAlignment = 8;
+#ifdef NNV_PLATFORM_WINDOWS
+constexpr std::size_t kWriteBlockSize = 64 * 1024;
+#endif
+
+static_assert(sizeof(EventLog::FileHeader) == 32, "EventLog file header layout changed");
+static_assert(sizeof(EventLog::RecordHeader) == 24, "EventLog record header layout changed");
+
+std::size_t alignRecord(std::size_t bytes) {
+    return (bytes + kRecordAlignment - 1) / kRecordAlignment * kRecordAlignment;
+}
+
+std::int64_t systemNanos() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+// NaN and infinities are not valid JSON numbers
+nlohmann::json number(double value) {
+    return std::isfinite(value) ? nlohmann::json(value) : nlohmann::json(nullptr);
+}
+
+} // namespace
+
+const char* getEventTypeName(EventType type) {
+    switch (type) {
+        case EventType::RunStart: return "run_start";
+        case EventType::RunEnd: return "run_end";
+        case EventType::Step: return "step";
+        case EventType::Epoch: return "epoch";
+        case EventType::Checkpoint: return "checkpoint";
+        case EventType::Timing: return "timing";
+        case EventType::Message: return "message";
+        default: return "unknown";
+    }
+}
+
+EventLog::~EventLog() {
+    close();
+}
+
+bool EventLog::open(const std::string& path, std::size_t initialCapacity) {
+    close();
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    FileHeader header{};
+    std::memcpy(header.magic, kMagic, sizeof(header.magic));
+    header.version = kVersion;
+    header.headerSize = sizeof(FileHeader);
+    header.startNanos = systemNanos();
+
+#ifdef NNV_PLATFORM_WINDOWS
+    file_ = std::fopen(path.c_str(), "wb");
+    if (!file_) {
+        NNV_LOG_ERROR("Failed to create event log: {}", path);
+        return false;
+    }
+    buffer_.reserve(kWriteBlockSize);
+    buffer_.insert(buffer_.end(), reinterpret_cast<const char*>(&header),
+                   reinterpret_cast<const char*>(&header) + sizeof(header));
+#else
+    fd_ = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd_ < 0) {
+        NNV_LOG_ERROR("Failed to create event log: {}", path);
+        return false;
+    }
+
+    capacity_ = 0;
+    if (!grow(std::max(initialCapacity, sizeof(FileHeader) + 4096))) {
+        ::close(fd_);
+        fd_ = -1;
+        return false;
+    }
+    std::memcpy(mapping_, &header, sizeof(header));
+#endif
+
+    path_ = path;
+    used_ = sizeof(FileHeader);
+    recordCount_ = 0;
+    return true;
+}
+
+void EventLog::close() {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+#ifdef NNV_PLATFORM_WINDOWS
+    if (!file_) {
+        return;
+    }
+    std::fwrite(buffer_.data(), 1, buffer_.size(), file_);
+    buffer_.clear();
+    std::fclose(file_);
+    file_ = nullptr;
+#else
+    if (fd_ < 0) {
+        return;
+    }
+    if (mapping_) {
+        munmap(mapping_, capacity_);
+        mapping_ = nullptr;
+    }
+    // Drop the zero tail that was reserved for growth
+    if (ftruncate(fd_, static_cast<off_t>(used_)) != 0) {
+        NNV_LOG_WARNING("Failed to trim event log: {}", path_);
+    }
+    ::close(fd_);
+    fd_ = -1;
+    capacity_ = 0;
+#endif
+
+    path_.clear();
+}
+
+bool EventLog::isOpen() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+#ifdef NNV_PLATFORM_WINDOWS
+    return file_ != nullptr;
+#else
+    return fd_ >= 0;
+#endif
+}
+
+void EventLog::flush() {
+    std::lock_guard<std::mutex> lock(mutex_);
+#ifdef NNV_PLATFORM_WINDOWS
+    if (file_) {
+        std::fwrite(buffer_.data(), 1, buffer_.size(), file_);
+        buffer_.clear();
+        std::fflush(file_);
+    }
+#else
+    if (mapping_) {
+        msync(mapping_, used_, MS_ASYNC);
+    }
+#endif
+}
+
+std::uint64_t EventLog::getRecordCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return recordCount_;
+}
+
+std::uint64_t EventLog::getSize() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return used_;
+}
+
+#ifndef NNV_PLATFORM_WINDOWS
+bool EventLog::grow(std::size_t required) {
+    std::size_t capacity = std::max<std::size_t>(capacity_, 4096);
+    while (capacity < required) {
+        capacity *= 2;
+    }
+
+    if (ftruncate(fd_, static_cast<off_t>(capacity)) != 0) {
+        NNV_LOG_ERROR("Failed to grow event log {} to {} bytes", path_, capacity);
+        return false;
+    }
+
+    void* mapping = mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    if (mapping == MAP_FAILED) {
+        NNV_LOG_ERROR("Failed to map event log {} ({} bytes)", path_, capacity);
+        return false;
+    }
+
+    if (mapping_) {
+        munmap(mapping_, capacity_);
+    }
+    mapping_ = static_cast<char*>(mapping);
+    capacity_ = capacity;
+    return true;
+}
+#endif
+
+void EventLog::append(EventType type, const void* payload, std::size_t payloadSize,
+                      const char* text, std::size_t textSize) {
+    const std::size_t size = alignRecord(sizeof(RecordHeader) + payloadSize + textSize);
+
+    RecordHeader header{};
+    header.type = static_cast<std::uint16_t>(type);
+    header.payloadSize = static_cast<std::uint16_t>(payloadSize);
+    header.textSize = static_cast<std::uint32_t>(textSize);
+    header.timestampNanos = systemNanos();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+#ifdef NNV_PLATFORM_WINDOWS
+    if (!file_) {
+        return;
+    }
+    header.size = static_cast<std::uint32_t>(size);
+    const std::size_t start = buffer_.size();
+    buffer_.resize(start + size, 0);
+    std::memcpy(buffer_.data() + start, &header, sizeof(header));
+    if (payloadSize > 0) {
+        std::memcpy(buffer_.data() + start + sizeof(header), payload, payloadSize);
+    }
+    if (textSize > 0) {
+        std::memcpy(buffer_.data() + start + sizeof(header) + payloadSize, text, textSize);
+    }
+    if (buffer_.size() >= kWriteBlockSize) {
+        std::fwrite(buffer_.data(), 1, buffer_.size(), file_);
+        buffer_.clear();
+    }
+#else
+    if (fd_ < 0) {
+        return;
+    }
+    if (used_ + size > capacity_ && !grow(used_ + size)) {
+        return;
+    }
+
+    // Body first, size word last: a torn record reads as the end of the log.
+    //
+    // Crash consistency: the mapping is MAP_SHARED, so every store that
+    // reached memory survives a crash of this process in the page cache. The
+    // release store keeps the compiler and CPU from making the size word
+    // visible before the body, so a reader of a crashed writer's file sees
+    // either size 0 (the zeroed tail reserved by grow()) or a whole record.
+    // This does not cover power loss or a kernel crash, where writeback may
+    // persist pages out of order; flush() only requests asynchronous msync.
+    char* record = mapping_ + used_;
+    header.size = 0;
+    std::memcpy(record, &header, sizeof(header));
+    if (payloadSize > 0) {
+        std::memcpy(record + sizeof(header), payload, payloadSize);
+    }
+    if (textSize > 0) {
+        std::memcpy(record + sizeof(header) + payloadSize, text, textSize);
+    }
+    // Records start on kRecordAlignment boundaries of a page-aligned mapping
+    __atomic_store_n(reinterpret_cast<std::uint32_t*>(record), static_cast<std::uint32_t>(size),
+                     __ATOMIC_RELEASE);
+#endif
+
+    used_ += size;
+    ++recordCount_;
+}
+
+void EventLog::logRunStart(const std::string& configJson) {
+    append(EventType::RunStart, nullptr, 0, configJson.data(), configJson.size());
+}
+
+void EventLog::logRunEnd(const RunEndEvent& event) {
+    append(EventType::RunEnd, &event, sizeof(event), nullptr, 0);
+}
+
+void EventLog::logStep(const StepEvent& event) {
+    append(EventType::Step, &event, sizeof(event), nullptr, 0);
+}
+
+void EventLog::logEpoch(const EpochEvent& event) {
+    append(EventType::Epoch, &event, sizeof(event), nullptr, 0);
+}
+
+void EventLog::logCheckpoint(std::uint64_t step, const std::string& path) {
+    CheckpointEvent event;
+    event.step = step;
+    append(EventType::Checkpoint, &event, sizeof(event), path.data(), path.size());
+}
+
+void EventLog::logTiming(const std::string& name, std::uint64_t nanos, std::uint64_t count) {
+    TimingEvent event;
+    event.nanos = nanos;
+    event.count = count;
+    append(EventType::Timing, &event, sizeof(event), name.data(), name.size());
+}
+
+void EventLog::logMessage(const std::string& text) {
+    append(EventType::Message, nullptr, 0, text.data(), text.size());
+}
+
+bool EventLogReader::open(const std::string& path) {
+    data_.clear();
+    offset_ = 0;
+    truncated_ = false;
+
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        NNV_LOG_ERROR("Failed to open event log: {}", path);
+        return false;
+    }
+    data_.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+
+    EventLog::FileHeader header{};
+    if (data_.size() < sizeof(header)) {
+        NNV_LOG_ERROR("Not an event log: {}", path);
+        return false;
+    }
+    std::memcpy(&header, data_.data(), sizeof(header));
+    if (std::memcmp(header.magic, EventLog::kMagic, sizeof(header.magic)) != 0 ||
+        header.headerSize < sizeof(header) || header.headerSize > data_.size()) {
+        NNV_LOG_ERROR("Not an event log: {}", path);
+        return false;
+    }
+    if (header.version > EventLog::kVersion) {
+        NNV_LOG_WARNING("Event log {} has version {}, reading as version {}", path, header.version,
+                        EventLog::kVersion);
+    }
+
+    startNanos_ = header.startNanos;
+    offset_ = header.headerSize;
+    return true;
+}
+
+bool EventLogReader::next(EventRecord& out) {
+    if (offset_ + sizeof(EventLog::RecordHeader) > data_.size()) {
+        return false;
+    }
+
+    EventLog::RecordHeader header{};
+    std::memcpy(&header, data_.data() + offset_, sizeof(header));
+    if (header.size == 0) {
+        // End of a log that was not closed. The writer publishes the size word
+        // last with release ordering, so after a process crash a non-zero size
+        // means the whole body was written (see EventLog::append).
+        return false;
+    }
+    if (header.size < sizeof(header) || offset_ + header.size > data_.size() ||
+        sizeof(header) + header.payloadSize + header.textSize > header.size) {
+        truncated_ = true;
+        return false;
+    }
+
+    const char* body = data_.data() + offset_ + sizeof(header);
+    out.type = static_cast<EventType>(header.type);
+    out.timestampNanos = header.timestampNanos;
+    out.payload.assign(body, body + header.payloadSize);
+    out.text.assign(body + header.payloadSize, header.textSize);
+
+    offset_ += header.size;
+    return true;
+}
+
+nlohmann::json eventToJson(const EventRecord& record, std::int64_t startNanos) {
+    nlohmann::json json;
+    json["type"] = getEventTypeName(record.type);
+    json["time"] = static_cast<double>(record.timestampNanos - startNanos) * 1e-9;
+
+    switch (record.type) {
+        case EventType::RunStart: {
+            auto config = nlohmann::json::parse(record.text, nullptr, false);
+            json["config"] = config.is_discarded() ? nlohmann::json(record.text) : config;
+            break;
+        }
+        case EventType::RunEnd: {
+            RunEndEvent event;
+            record.get(event);
+            json["epochs"] = event.epochs;
+            json["steps"] = event.steps;
+            json["stopped"] = event.stopped != 0;
+            break;
+        }
+        case EventType::Step: {
+            StepEvent event;
+            record.get(event);
+            json["step"] = event.step;
+            json["samples"] = event.samples;
+            json["seconds"] = static_cast<double>(event.nanos) * 1e-9;
+            json["loss"] = number(event.loss);
+            json["learning_rate"] = number(event.learningRate);
+            json["gradient_norm"] = number(event.gradientNorm);
+            break;
+        }
+        case EventType::Epoch: {
+            EpochEvent event;
+            record.get(event);
+            json["epoch"] = event.epoch;
+            json["step"] = event.step;
+            json["train_loss"] = number(event.trainLoss);
+            json["train_accuracy"] = number(event.trainAccuracy);
+            json["val_loss"] = number(event.valLoss);
+            json["val_accuracy"] = number(event.valAccuracy);
+            json["seconds"] = number(event.seconds);
+            break;
+        }
+        case EventType::Checkpoint: {
+            CheckpointEvent event;
+            record.get(event);
+            json["step"] = event.step;
+            json["path"] = record.text;
+            break;
+        }
+        case EventType::Timing: {
+            TimingEvent event;
+            record.get(event);
+            json["name"] = record.text;
+            json["seconds"] = static_cast<double>(event.nanos) * 1e-9;
+            json["count"] = event.count;
+            break;
+        }
+        case EventType::Message:
+        default:
+            json["text"] = record.text;
+            break;
+    }
+
+    return json;
+}
+
+} // namespace utils
+} // namespace nnv
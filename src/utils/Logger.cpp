@@ -6,28 +6,335 @@
  */
 
 #include "utils/Logger.hpp"
+#include "utils/AllocationTracker.hpp"
+#include "utils/MpscRingBuffer.hpp"
 #include <iostream>
 #include <iomanip>
-#include <chrono>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
 
 namespace nnv {
 namespace utils {
 
+/**
+ * @brief Queue and writer thread behind asynchronous logging
+ */
+class AsyncLogBackend {
+public:
+    AsyncLogBackend(const AsyncLogOptions& options, std::atomic<std::uint64_t>& dropped)
+        : options_(options)
+        , queue_(std::max<std::size_t>(options.queueCapacity, 2))
+        , dropped_(dropped)
+    {
+        wakeThreshold_ = queue_.capacity() / 2;
+        batch_.reserve(kBatchSize + 1);
+        writer_ = std::thread(&AsyncLogBackend::run, this);
+    }
+
+    ~AsyncLogBackend() {
+        stop();
+    }
+
+    // Disable copy and move
+    NNV_DISABLE_COPY_AND_MOVE(AsyncLogBackend)
+
+    void push(LogLevel level, const std::string& message) {
+        Logger::Record record{level, std::chrono::system_clock::now(), message};
+        if (!queue_.tryPush(std::move(record))) {
+            if (options_.overflowPolicy == LogOverflowPolicy::Drop) {
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+
+            wake();
+            for (unsigned spins = 0; !queue_.tryPush(std::move(record)); ++spins) {
+                if (spins < 64) {
+                    std::this_thread::yield();
+                } else {
+                    std::this_thread::sleep_for(std::chrono::microseconds(50));
+                }
+            }
+        }
+
+        if (level >= LogLevel::Error || queue_.size() >= wakeThreshold_) {
+            wake();
+        }
+    }
+
+    void flush() {
+        const std::uint64_t target = queue_.totalPushed();
+        std::unique_lock<std::mutex> lock(wakeMutex_);
+        flushTarget_ = std::max(flushTarget_, target);
+        wake_.notify_one();
+        flushed_.wait(lock, [this, target]() { return flushedPosition_ >= target || stopped_; });
+    }
+
+    void stop() {
+        {
+            std::lock_guard<std::mutex> lock(wakeMutex_);
+            stopping_ = true;
+        }
+        wake_.notify_one();
+        if (writer_.joinable()) {
+            writer_.join();
+        }
+    }
+
+    std::size_t queueDepth() const {
+        return queue_.size();
+    }
+
+    // Best effort from a signal handler: the crashing thread may hold any lock
+    void drainForCrash() {
+        if (!options_.flushOnCrash) {
+            return;
+        }
+
+        for (int attempt = 0; drainLock_.test_and_set(std::memory_order_acquire); ++attempt) {
+            if (attempt > 1000) {
+                return;
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+
+        bool urgent = false;
+        drain(urgent, false);
+        Logger::writeBatch({}, true, false);
+        drainLock_.clear(std::memory_order_release);
+    }
+
+private:
+    static constexpr std::size_t kBatchSize = 256;
+
+    AsyncLogOptions options_;
+    MpscRingBuffer<Logger::Record> queue_;
+    std::atomic<std::uint64_t>& dropped_;
+    std::size_t wakeThreshold_ = 0;
+
+    std::thread writer_;
+    std::atomic<bool> wakePending_{false};
+    std::atomic_flag drainLock_ = ATOMIC_FLAG_INIT;
+    std::vector<Logger::Record> batch_;     ///< Writer-side scratch, guarded by drainLock_
+    std::uint64_t reportedDrops_ = 0;       ///< Drops already announced in the log
+
+    // Guarded by wakeMutex_
+    std::mutex wakeMutex_;
+    std::condition_variable wake_;
+    std::condition_variable flushed_;
+    std::uint64_t flushTarget_ = 0;         ///< Pushes a flush() caller waits for
+    std::uint64_t flushedPosition_ = 0;     ///< Pops written and flushed
+    bool stopping_ = false;
+    bool stopped_ = false;
+
+    void wake() {
+        if (wakePending_.exchange(true, std::memory_order_acq_rel)) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(wakeMutex_);
+        wake_.notify_one();
+    }
+
+    std::size_t drain(bool& urgent, bool lockLogger) {
+        std::size_t written = 0;
+        Logger::Record record;
+
+        for (;;) {
+            batch_.clear();
+
+            const std::uint64_t dropped = dropped_.load(std::memory_order_relaxed);
+            if (dropped > reportedDrops_) {
+                batch_.push_back({LogLevel::Warning, std::chrono::system_clock::now(),
+                                  "Log queue full, dropped " + std::to_string(dropped - reportedDrops_) + " records"});
+                reportedDrops_ = dropped;
+            }
+
+            while (batch_.size() < kBatchSize && queue_.tryPop(record)) {
+                urgent = urgent || record.level >= LogLevel::Error;
+                batch_.push_back(std::move(record));
+            }
+            if (batch_.empty()) {
+                break;
+            }
+
+            Logger::writeBatch(batch_, false, lockLogger);
+            written += batch_.size();
+        }
+
+        return written;
+    }
+
+    void run() {
+        NNV_ALLOCATION_SCOPE(Logging);
+        auto lastFlush = std::chrono::steady_clock::now();
+        bool dirty = false;
+
+        for (;;) {
+            std::uint64_t flushTarget = 0;
+            std::uint64_t flushedPosition = 0;
+            bool stopping = false;
+            {
+                std::unique_lock<std::mutex> lock(wakeMutex_);
+                wake_.wait_for(lock, options_.flushInterval, [this]() {
+                    return stopping_ || wakePending_.load(std::memory_order_acquire) ||
+                           flushTarget_ > flushedPosition_;
+                });
+                wakePending_.store(false, std::memory_order_release);
+                flushTarget = flushTarget_;
+                flushedPosition = flushedPosition_;
+                stopping = stopping_;
+            }
+
+            bool urgent = false;
+            while (drainLock_.test_and_set(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            dirty = drain(urgent, true) > 0 || dirty;
+
+            const std::uint64_t popped = queue_.totalPopped();
+            const auto now = std::chrono::steady_clock::now();
+            if (dirty && (urgent || stopping || flushTarget > flushedPosition ||
+                          now - lastFlush >= options_.flushInterval)) {
+                Logger::writeBatch({}, true, true);
+                lastFlush = now;
+                dirty = false;
+            }
+            drainLock_.clear(std::memory_order_release);
+
+            if (!dirty) {
+                {
+                    std::lock_guard<std::mutex> lock(wakeMutex_);
+                    flushedPosition_ = popped;
+                }
+                flushed_.notify_all();
+            }
+
+            if (stopping && popped == queue_.totalPushed()) {
+                break;
+            }
+            if (popped < flushTarget) {
+                // A producer claimed a slot but has not finished writing it
+                std::this_thread::yield();
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(wakeMutex_);
+            stopped_ = true;
+        }
+        flushed_.notify_all();
+    }
+};
+
+namespace {
+
+std::unique_ptr<AsyncLogBackend> asyncOwner;            // Guarded by asyncLifecycleMutex
+std::mutex asyncLifecycleMutex;
+std::atomic<AsyncLogBackend*> asyncBackend{nullptr};
+std::atomic<int> asyncCallers{0};
+std::atomic<std::uint64_t> asyncDropped{0};
+
+/**
+ * @brief Keeps the backend alive while a caller uses it
+ *
+ * disableAsync() unpublishes the backend and then waits for the caller count
+ * to drop to zero; both sides use sequentially consistent operations, so a
+ * caller either sees the null pointer or is waited for.
+ */
+class AsyncCallerGuard {
+public:
+    AsyncCallerGuard() {
+        asyncCallers.fetch_add(1, std::memory_order_seq_cst);
+        backend_ = asyncBackend.load(std::memory_order_seq_cst);
+    }
+
+    ~AsyncCallerGuard() {
+        asyncCallers.fetch_sub(1, std::memory_order_release);
+    }
+
+    NNV_DISABLE_COPY_AND_MOVE(AsyncCallerGuard)
+
+    AsyncLogBackend* backend() const { return backend_; }
+
+private:
+    AsyncLogBackend* backend_ = nullptr;
+};
+
+#ifdef SIGBUS
+constexpr int kFatalSignals[] = {SIGSEGV, SIGBUS, SIGFPE, SIGILL, SIGABRT};
+#else
+constexpr int kFatalSignals[] = {SIGSEGV, SIGFPE, SIGILL, SIGABRT};
+#endif
+constexpr std::size_t kFatalSignalCount = sizeof(kFatalSignals) / sizeof(kFatalSignals[0]);
+
+using SignalHandler = void (*)(int);
+SignalHandler previousHandlers[kFatalSignalCount] = {};
+
+void onFatalSignal(int signal) {
+    if (AsyncLogBackend* backend = asyncBackend.load(std::memory_order_acquire)) {
+        backend->drainForCrash();
+    }
+
+    // Hand the signal to whoever was installed before us (usually the default action)
+    for (std::size_t i = 0; i < kFatalSignalCount; ++i) {
+        if (kFatalSignals[i] == signal) {
+            SignalHandler previous = previousHandlers[i];
+            std::signal(signal, previous == SIG_ERR || previous == nullptr ? SIG_DFL : previous);
+            break;
+        }
+    }
+    std::raise(signal);
+}
+
+void installCrashHandlers() {
+    static std::once_flag installed;
+    std::call_once(installed, []() {
+        for (std::size_t i = 0; i < kFatalSignalCount; ++i) {
+            previousHandlers[i] = std::signal(kFatalSignals[i], onFatalSignal);
+        }
+    });
+}
+
+#ifdef HAS_SPDLOG
+spdlog::level::level_enum toSpdlogLevel(LogLevel level) {
+    switch (level) {
+        case LogLevel::Debug: return spdlog::level::debug;
+        case LogLevel::Info: return spdlog::level::info;
+        case LogLevel::Warning: return spdlog::level::warn;
+        case LogLevel::Error: return spdlog::level::err;
+        case LogLevel::Critical: return spdlog::level::critical;
+        default: return spdlog::level::info;
+    }
+}
+#endif
+
+} // namespace
+
 // Static member definitions
 std::unique_ptr<Logger> Logger::instance_ = nullptr;
 std::mutex Logger::mutex_;
+std::atomic<int> Logger::runtimeLevel_{static_cast<int>(LogLevel::Critical) + 1};
 
 void Logger::initialize(const std::string& logFile, LogLevel level) {
     std::lock_guard<std::mutex> lock(mutex_);
     if (!instance_) {
         instance_ = std::unique_ptr<Logger>(new Logger());
         instance_->initializeImpl(logFile, level);
+        runtimeLevel_.store(static_cast<int>(level), std::memory_order_relaxed);
     }
 }
 
 void Logger::shutdown() {
+    // Queued records still need the sinks
+    disableAsync();
+
     std::lock_guard<std::mutex> lock(mutex_);
     if (instance_) {
+        runtimeLevel_.store(static_cast<int>(LogLevel::Critical) + 1, std::memory_order_relaxed);
         instance_->shutdownImpl();
         instance_.reset();
     }
@@ -37,16 +344,92 @@ void Logger::setLevel(LogLevel level) {
     std::lock_guard<std::mutex> lock(mutex_);
     if (instance_) {
         instance_->setLevelImpl(level);
+        runtimeLevel_.store(static_cast<int>(level), std::memory_order_relaxed);
     }
 }
 
 void Logger::log(LogLevel level, const std::string& message) {
+    if (!isEnabled(level)) {
+        return;
+    }
+
+    {
+        AsyncCallerGuard guard;
+        if (AsyncLogBackend* backend = guard.backend()) {
+            backend->push(level, message);
+            return;
+        }
+    }
+
     std::lock_guard<std::mutex> lock(mutex_);
     if (instance_) {
         instance_->logImpl(level, message);
     }
 }
 
+void Logger::enableAsync(const AsyncLogOptions& options) {
+    std::lock_guard<std::mutex> lifecycle(asyncLifecycleMutex);
+    if (asyncOwner) {
+        return;
+    }
+
+    asyncDropped.store(0, std::memory_order_relaxed);
+    asyncOwner = std::make_unique<AsyncLogBackend>(options, asyncDropped);
+    asyncBackend.store(asyncOwner.get(), std::memory_order_seq_cst);
+
+    // Registered after the statics above, so it runs before they are destroyed
+    static std::once_flag registered;
+    std::call_once(registered, []() { std::atexit([]() { Logger::disableAsync(); }); });
+
+    if (options.flushOnCrash) {
+        installCrashHandlers();
+    }
+}
+
+void Logger::disableAsync() {
+    std::lock_guard<std::mutex> lifecycle(asyncLifecycleMutex);
+    if (!asyncOwner) {
+        return;
+    }
+
+    asyncBackend.store(nullptr, std::memory_order_seq_cst);
+    while (asyncCallers.load(std::memory_order_seq_cst) != 0) {
+        std::this_thread::yield();
+    }
+
+    asyncOwner->stop();
+    asyncOwner.reset();
+}
+
+bool Logger::isAsync() {
+    return asyncBackend.load(std::memory_order_acquire) != nullptr;
+}
+
+void Logger::flush() {
+    {
+        AsyncCallerGuard guard;
+        if (AsyncLogBackend* backend = guard.backend()) {
+            backend->flush();
+            return;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (instance_) {
+        instance_->flushImpl();
+    }
+}
+
+std::uint64_t Logger::getDroppedCount() {
+    return asyncDropped.load(std::memory_order_relaxed);
+}
+
+std::size_t Logger::getQueueDepth() {
+    AsyncCallerGuard guard;
+    AsyncLogBackend* backend = guard.backend();
+    return backend ? backend->queueDepth() : 0;
+}
+
 void Logger::debug(const std::string& message) {
     log(LogLevel::Debug, message);
 }
@@ -67,25 +450,43 @@ void Logger::critical(const std::string& message) {
     log(LogLevel::Critical, message);
 }
 
+void Logger::writeBatch(const std::vector<Record>& records, bool flush, bool lock) {
+    std::unique_lock<std::mutex> guard(mutex_, std::defer_lock);
+    if (lock) {
+        guard.lock();
+    }
+    if (!instance_) {
+        return;
+    }
+
+    for (const auto& record : records) {
+        instance_->writeImpl(record);
+    }
+    if (flush) {
+        instance_->flushImpl();
+    }
+}
+
 void Logger::initializeImpl(const std::string& logFile, LogLevel level) {
+    currentLevel_ = level;
 #ifdef HAS_SPDLOG
     try {
         std::vector<spdlog::sink_ptr> sinks;
         
         // Console sink
         auto console_sink = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
-        console_sink->set_level(static_cast<spdlog::level::level_enum>(level));
+        console_sink->set_level(toSpdlogLevel(level));
         sinks.push_back(console_sink);
         
         // File sink (if specified)
         if (!logFile.empty()) {
             auto file_sink = std::make_shared<spdlog::sinks::basic_file_sink_mt>(logFile, true);
-            file_sink->set_level(static_cast<spdlog::level::level_enum>(level));
+            file_sink->set_level(toSpdlogLevel(level));
             sinks.push_back(file_sink);
         }
         
         spdlogger_ = std::make_shared<spdlog::logger>("nnv", sinks.begin(), sinks.end());
-        spdlogger_->set_level(static_cast<spdlog::level::level_enum>(level));
+        spdlogger_->set_level(toSpdlogLevel(level));
         spdlogger_->set_pattern("[%Y-%m-%d %H:%M:%S.%e] [%l] %v");
         
         spdlog::register_logger(spdlogger_);
@@ -94,7 +495,6 @@ void Logger::initializeImpl(const std::string& logFile, LogLevel level) {
         std::cerr << "Log initialization failed: " << ex.what() << std::endl;
     }
 #else
-    currentLevel_ = level;
     consoleOutput_ = true;
     
     if (!logFile.empty()) {
@@ -124,55 +524,70 @@ void Logger::shutdownImpl() {
 }
 
 void Logger::setLevelImpl(LogLevel level) {
+    currentLevel_ = level;
 #ifdef HAS_SPDLOG
     if (spdlogger_) {
-        spdlogger_->set_level(static_cast<spdlog::level::level_enum>(level));
+        spdlogger_->set_level(toSpdlogLevel(level));
     }
-#else
-    currentLevel_ = level;
 #endif
 }
 
 void Logger::logImpl(LogLevel level, const std::string& message) {
+    if (level < currentLevel_) {
+        return;
+    }
+
+    writeImpl(Record{level, std::chrono::system_clock::now(), message});
+#ifndef HAS_SPDLOG
+    // Synchronous lines are on disk when the call returns
+    flushImpl();
+#endif
+}
+
+void Logger::writeImpl(const Record& record) {
+    if (record.level < currentLevel_) {
+        return;
+    }
+
 #ifdef HAS_SPDLOG
     if (spdlogger_) {
-        switch (level) {
-            case LogLevel::Debug:
-                spdlogger_->debug(message);
-                break;
-            case LogLevel::Info:
-                spdlogger_->info(message);
-                break;
-            case LogLevel::Warning:
-                spdlogger_->warn(message);
-                break;
-            case LogLevel::Error:
-                spdlogger_->error(message);
-                break;
-            case LogLevel::Critical:
-                spdlogger_->critical(message);
-                break;
-        }
+        spdlogger_->log(record.time, spdlog::source_loc{}, toSpdlogLevel(record.level), record.message);
     }
 #else
-    if (level < currentLevel_) {
-        return;
-    }
-    
-    std::string timestamp = getCurrentTimestamp();
-    std::string levelStr = levelToString(level);
-    std::string logLine = "[" + timestamp + "] [" + levelStr + "] " + message;
-    
+    std::string logLine;
+    logLine.reserve(record.message.size() + 40);
+    logLine += '[';
+    logLine += formatTimestamp(record.time);
+    logLine += "] [";
+    logLine += levelToString(record.level);
+    logLine += "] ";
+    logLine += record.message;
+    logLine += '\n';
+
     if (consoleOutput_) {
-        if (level >= LogLevel::Error) {
-            std::cerr << logLine << std::endl;
+        if (record.level >= LogLevel::Error) {
+            std::cerr << logLine;
         } else {
-            std::cout << logLine << std::endl;
+            std::cout << logLine;
         }
     }
-    
+
+    if (fileStream_ && fileStream_->is_open()) {
+        *fileStream_ << logLine;
+    }
+#endif
+}
+
+void Logger::flushImpl() {
+#ifdef HAS_SPDLOG
+    if (spdlogger_) {
+        spdlogger_->flush();
+    }
+#else
+    if (consoleOutput_) {
+        std::cout.flush();
+    }
     if (fileStream_ && fileStream_->is_open()) {
-        *fileStream_ << logLine << std::endl;
         fileStream_->flush();
     }
 #endif
@@ -189,17 +604,22 @@ std::string Logger::levelToString(LogLevel level) const {
     }
 }
 
-std::string Logger::getCurrentTimestamp() const {
-    auto now = std::chrono::system_clock::now();
-    auto time_t = std::chrono::system_clock::to_time_t(now);
-    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
-        now.time_since_epoch()) % 1000;
-    
-    std::ostringstream oss;
-    oss << std::put_time(std::localtime(&time_t), "%Y-%m-%d %H:%M:%S");
-    oss << '.' << std::setfill('0') << std::setw(3) << ms.count();
-    
-    return oss.str();
+std::string Logger::formatTimestamp(std::chrono::system_clock::time_point time) {
+    // Date and time change once per second; only the milliseconds are formatted per line
+    const std::time_t seconds = std::chrono::system_clock::to_time_t(time);
+    if (seconds != cachedSecond_) {
+        std::ostringstream oss;
+        oss << std::put_time(std::localtime(&seconds), "%Y-%m-%d %H:%M:%S");
+        cachedDateTime_ = oss.str();
+        cachedSecond_ = seconds;
+    }
+
+    const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+        time.time_since_epoch()) % 1000;
+    char millis[8];
+    std::snprintf(millis, sizeof(millis), ".%03d", static_cast<int>(ms.count()));
+
+    return cachedDateTime_ + millis;
 }
 
 } // namespace utils
@@ -0,0 +1,250 @@
+/**
+ * @file MachinePeaks.cpp
+ * @brief Implementation of the compute and bandwidth probes
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#include "utils/MachinePeaks.hpp"
+#include "utils/AlignedAllocator.hpp"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <numeric>
+
+// Explicitly vectorized compute probes need GCC/Clang target attributes
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define NNV_X86_PEAK_PROBES 1
+#include <immintrin.h>
+#else
+#define NNV_X86_PEAK_PROBES 0
+#endif
+
+namespace nnv {
+namespace utils {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double secondsSince(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+// Prevents the compiler from treating the probe inputs as constants
+volatile float g_multiplier = 0.999999f;
+volatile float g_addend = 1e-6f;
+volatile float g_sink = 0.0f;
+
+double measureBandwidth(std::size_t arrayBytes, int repetitions) {
+    const std::size_t count = std::max<std::size_t>(arrayBytes / sizeof(float), 1024);
+    AlignedVector<float> a(count, 0.0f);
+    AlignedVector<float> b(count, 1.0f);
+    AlignedVector<float> c(count, 2.0f);
+    const float scalar = g_multiplier;
+
+    double best = 0.0;
+    for (int r = 0; r < repetitions; ++r) {
+        const auto start = Clock::now();
+        float* out = a.data();
+        const float* x = b.data();
+        const float* y = c.data();
+        for (std::size_t i = 0; i < count; ++i) {
+            out[i] = x[i] + scalar * y[i];
+        }
+        const double seconds = secondsSince(start);
+        g_sink = a[count / 2];
+
+        if (seconds > 0.0) {
+            best = std::max(best, 3.0 * sizeof(float) * static_cast<double>(count) / seconds * 1e-9);
+        }
+    }
+    return best;
+}
+
+// Portable probe: compiled with the build's flags, so it is only as wide as the layers
+double measurePortableCompute(int repetitions) {
+    // Enough independent chains to cover the latency of several vector units
+    constexpr std::size_t kChains = 128;
+    constexpr std::size_t kIterations = 1u << 17;
+
+    alignas(64) std::array<float, kChains> acc;
+    acc.fill(1.0f);
+    const float multiplier = g_multiplier;
+    const float addend = g_addend;
+
+    double best = 0.0;
+    for (int r = 0; r < repetitions; ++r) {
+        const auto start = Clock::now();
+        for (std::size_t n = 0; n < kIterations; ++n) {
+            for (std::size_t j = 0; j < kChains; ++j) {
+                acc[j] = acc[j] * multiplier + addend;
+            }
+        }
+        const double seconds = secondsSince(start);
+
+        float sum = 0.0f;
+        for (float value : acc) {
+            sum += value;
+        }
+        g_sink = sum;
+
+        if (seconds > 0.0) {
+            best = std::max(best, 2.0 * kChains * kIterations / seconds * 1e-9);
+        }
+    }
+    return best;
+}
+
+#if NNV_X86_PEAK_PROBES
+
+// Independent accumulators per probe: FMA latency (4-5 cycles) times two
+// issue ports, while leaving registers for the multiplier and addend. Each
+// chain starts from a different value so the compiler cannot merge them.
+constexpr int kVectorChains = 12;
+constexpr std::size_t kVectorIterations = 1u << 16;
+
+// Explicit intrinsics compiled for the target ISA regardless of the build's
+// -m flags; only called after __builtin_cpu_supports() confirms the ISA.
+// Returns FLOP per repetition divided by the best time, in GFLOP/s.
+
+__attribute__((target("avx512f"))) double measureAvx512Compute(int repetitions) {
+    __m512 acc[kVectorChains];
+    const __m512 multiplier = _mm512_set1_ps(g_multiplier);
+    const __m512 addend = _mm512_set1_ps(g_addend);
+
+    double best = 0.0;
+    for (int r = 0; r < repetitions; ++r) {
+        for (int j = 0; j < kVectorChains; ++j) {
+            acc[j] = _mm512_set1_ps(static_cast<float>(j + 1));
+        }
+        const auto start = Clock::now();
+        for (std::size_t n = 0; n < kVectorIterations; ++n) {
+#pragma GCC unroll 16
+            for (auto& value : acc) {
+                value = _mm512_fmadd_ps(value, multiplier, addend);
+            }
+        }
+        const double seconds = secondsSince(start);
+
+        __m512 sum = acc[0];
+        for (int j = 1; j < kVectorChains; ++j) {
+            sum = _mm512_add_ps(sum, acc[j]);
+        }
+        alignas(64) float lanes[16];
+        _mm512_store_ps(lanes, sum);
+        g_sink = std::accumulate(lanes, lanes + 16, 0.0f);
+
+        if (seconds > 0.0) {
+            best = std::max(best, 2.0 * 16 * kVectorChains * kVectorIterations / seconds * 1e-9);
+        }
+    }
+    return best;
+}
+
+__attribute__((target("avx2,fma"))) double measureAvx2Compute(int repetitions) {
+    __m256 acc[kVectorChains];
+    const __m256 multiplier = _mm256_set1_ps(g_multiplier);
+    const __m256 addend = _mm256_set1_ps(g_addend);
+
+    double best = 0.0;
+    for (int r = 0; r < repetitions; ++r) {
+        for (int j = 0; j < kVectorChains; ++j) {
+            acc[j] = _mm256_set1_ps(static_cast<float>(j + 1));
+        }
+        const auto start = Clock::now();
+        for (std::size_t n = 0; n < kVectorIterations; ++n) {
+#pragma GCC unroll 16
+            for (auto& value : acc) {
+                value = _mm256_fmadd_ps(value, multiplier, addend);
+            }
+        }
+        const double seconds = secondsSince(start);
+
+        __m256 sum = acc[0];
+        for (int j = 1; j < kVectorChains; ++j) {
+            sum = _mm256_add_ps(sum, acc[j]);
+        }
+        alignas(32) float lanes[8];
+        _mm256_store_ps(lanes, sum);
+        g_sink = std::accumulate(lanes, lanes + 8, 0.0f);
+
+        if (seconds > 0.0) {
+            best = std::max(best, 2.0 * 8 * kVectorChains * kVectorIterations / seconds * 1e-9);
+        }
+    }
+    return best;
+}
+
+__attribute__((target("sse2"))) double measureSse2Compute(int repetitions) {
+    __m128 acc[kVectorChains];
+    const __m128 multiplier = _mm_set1_ps(g_multiplier);
+    const __m128 addend = _mm_set1_ps(g_addend);
+
+    double best = 0.0;
+    for (int r = 0; r < repetitions; ++r) {
+        for (int j = 0; j < kVectorChains; ++j) {
+            acc[j] = _mm_set1_ps(static_cast<float>(j + 1));
+        }
+        const auto start = Clock::now();
+        for (std::size_t n = 0; n < kVectorIterations; ++n) {
+#pragma GCC unroll 16
+            for (auto& value : acc) {
+                value = _mm_add_ps(_mm_mul_ps(value, multiplier), addend);
+            }
+        }
+        const double seconds = secondsSince(start);
+
+        __m128 sum = acc[0];
+        for (int j = 1; j < kVectorChains; ++j) {
+            sum = _mm_add_ps(sum, acc[j]);
+        }
+        alignas(16) float lanes[4];
+        _mm_store_ps(lanes, sum);
+        g_sink = std::accumulate(lanes, lanes + 4, 0.0f);
+
+        if (seconds > 0.0) {
+            best = std::max(best, 2.0 * 4 * kVectorChains * kVectorIterations / seconds * 1e-9);
+        }
+    }
+    return best;
+}
+
+#endif
+
+void measureCompute(int repetitions, MachinePeaks& peaks) {
+#if NNV_X86_PEAK_PROBES
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        peaks.gflops = measureAvx512Compute(repetitions);
+        peaks.computeRoof = "avx512 fma probe";
+        return;
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        peaks.gflops = measureAvx2Compute(repetitions);
+        peaks.computeRoof = "avx2 fma probe";
+        return;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        peaks.gflops = measureSse2Compute(repetitions);
+        peaks.computeRoof = "sse2 probe";
+        return;
+    }
+#endif
+    peaks.gflops = measurePortableCompute(repetitions);
+    peaks.computeRoof = "portable probe";
+}
+
+} // namespace
+
+MachinePeaks measureMachinePeaks(std::size_t arrayBytes, int repetitions) {
+    repetitions = std::max(repetitions, 1);
+
+    MachinePeaks peaks;
+    peaks.gbps = measureBandwidth(arrayBytes, repetitions);
+    measureCompute(repetitions, peaks);
+    return peaks;
+}
+
+} // namespace utils
+} // namespace nnv
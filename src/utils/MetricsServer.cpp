@@ -0,0 +1,406 @@
+/**
+ * @file MetricsServer.cpp
+ * @brief Implementation of the Prometheus metrics writer and HTTP endpoint
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#include "utils/MetricsServer.hpp"
+#include "utils/AlignedAllocator.hpp"
+#include "utils/AllocationTracker.hpp"
+#include "utils/Logger.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+#ifndef NNV_PLATFORM_WINDOWS
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+#endif
+
+namespace nnv {
+namespace utils {
+
+namespace {
+
+constexpr std::size_t kMaxRequestBytes = 8192;
+
+std::string formatValue(double value) {
+    if (std::isnan(value)) {
+        return "NaN";
+    }
+    if (std::isinf(value)) {
+        return value > 0 ? "+Inf" : "-Inf";
+    }
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%.15g", value);
+    return buffer;
+}
+
+void appendEscaped(std::string& out, const std::string& text, bool quotes) {
+    for (char c : text) {
+        if (c == '\\') {
+            out += "\\\\";
+        } else if (c == '\n') {
+            out += "\\n";
+        } else if (c == '"' && quotes) {
+            out += "\\\"";
+        } else {
+            out += c;
+        }
+    }
+}
+
+} // namespace
+
+MetricsWriter::Family& MetricsWriter::family(const std::string& name, const std::string& help,
+                                             const char* type) {
+    for (auto& existing : families_) {
+        if (existing.name == name) {
+            return existing;
+        }
+    }
+    families_.push_back(Family{name, help, type, {}});
+    return families_.back();
+}
+
+void MetricsWriter::appendSample(std::string& out, const std::string& name, const MetricLabels& labels,
+                                 const char* extraLabel, const std::string& extraValue, double value) {
+    out += name;
+    if (!labels.empty() || extraLabel) {
+        out += '{';
+        bool first = true;
+        for (const auto& label : labels) {
+            if (!first) {
+                out += ',';
+            }
+            first = false;
+            out += label.first;
+            out += "=\"";
+            appendEscaped(out, label.second, true);
+            out += '"';
+        }
+        if (extraLabel) {
+            if (!first) {
+                out += ',';
+            }
+            out += extraLabel;
+            out += "=\"";
+            out += extraValue;
+            out += '"';
+        }
+        out += '}';
+    }
+    out += ' ';
+    out += formatValue(value);
+    out += '\n';
+}
+
+void MetricsWriter::counter(const std::string& name, const std::string& help, double value,
+                            const MetricLabels& labels) {
+    appendSample(family(name, help, "counter").samples, name, labels, nullptr, {}, value);
+}
+
+void MetricsWriter::gauge(const std::string& name, const std::string& help, double value,
+                          const MetricLabels& labels) {
+    appendSample(family(name, help, "gauge").samples, name, labels, nullptr, {}, value);
+}
+
+void MetricsWriter::histogram(const std::string& name, const std::string& help,
+                              const std::vector<double>& upperBounds, const std::vector<std::uint64_t>& counts,
+                              double sum, std::uint64_t count, const MetricLabels& labels) {
+    std::string& samples = family(name, help, "histogram").samples;
+    const std::string bucketName = name + "_bucket";
+
+    std::uint64_t cumulative = 0;
+    const std::size_t buckets = std::min(upperBounds.size(), counts.size());
+    for (std::size_t i = 0; i < buckets; ++i) {
+        cumulative += counts[i];
+        appendSample(samples, bucketName, labels, "le", formatValue(upperBounds[i]),
+                     static_cast<double>(cumulative));
+    }
+    appendSample(samples, bucketName, labels, "le", "+Inf", static_cast<double>(count));
+    appendSample(samples, name + "_sum", labels, nullptr, {}, sum);
+    appendSample(samples, name + "_count", labels, nullptr, {}, static_cast<double>(count));
+}
+
+void MetricsWriter::summary(const std::string& name, const std::string& help,
+                            const std::vector<std::pair<double, double>>& quantiles,
+                            double sum, std::uint64_t count, const MetricLabels& labels) {
+    std::string& samples = family(name, help, "summary").samples;
+    for (const auto& quantile : quantiles) {
+        appendSample(samples, name, labels, "quantile", formatValue(quantile.first), quantile.second);
+    }
+    appendSample(samples, name + "_sum", labels, nullptr, {}, sum);
+    appendSample(samples, name + "_count", labels, nullptr, {}, static_cast<double>(count));
+}
+
+std::string MetricsWriter::str() const {
+    std::string out;
+    for (const auto& entry : families_) {
+        out += "# HELP ";
+        out += entry.name;
+        out += ' ';
+        appendEscaped(out, entry.help, false);
+        out += "\n# TYPE ";
+        out += entry.name;
+        out += ' ';
+        out += entry.type;
+        out += '\n';
+        out += entry.samples;
+    }
+    return out;
+}
+
+std::size_t MetricsRegistry::add(Collector collector) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const std::size_t id = nextId_++;
+    collectors_.emplace_back(id, std::move(collector));
+    return id;
+}
+
+void MetricsRegistry::remove(std::size_t id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    collectors_.erase(std::remove_if(collectors_.begin(), collectors_.end(),
+                                     [id](const auto& entry) { return entry.first == id; }),
+                      collectors_.end());
+}
+
+std::string MetricsRegistry::collect() const {
+    MetricsWriter writer;
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& entry : collectors_) {
+        entry.second(writer);
+    }
+    return writer.str();
+}
+
+std::size_t addProcessMetrics(MetricsRegistry& registry) {
+    return registry.add([](MetricsWriter& out) {
+        out.gauge("nnv_log_queue_depth", "Log records waiting for the asynchronous writer",
+                  static_cast<double>(Logger::getQueueDepth()));
+        out.counter("nnv_log_dropped_total", "Log records dropped because the queue was full",
+                    static_cast<double>(Logger::getDroppedCount()));
+
+        for (std::size_t i = 0; i < static_cast<std::size_t>(MemoryCategory::Count); ++i) {
+            const auto category = static_cast<MemoryCategory>(i);
+            const MetricLabels labels = {{"category", MemoryTracker::getCategoryName(category)}};
+            out.gauge("nnv_tracked_memory_bytes", "Bytes held in aligned buffers",
+                      static_cast<double>(MemoryTracker::getAllocatedBytes(category)), labels);
+            out.gauge("nnv_tracked_memory_peak_bytes", "Peak bytes held in aligned buffers",
+                      static_cast<double>(MemoryTracker::getPeakBytes(category)), labels);
+        }
+
+        if (AllocationTracker::isAvailable()) {
+            for (std::size_t i = 0; i < static_cast<std::size_t>(AllocationTag::Count); ++i) {
+                const auto tag = static_cast<AllocationTag>(i);
+                const AllocationCounts counts = AllocationTracker::totalCounts(tag);
+                const MetricLabels labels = {{"subsystem", getAllocationTagName(tag)}};
+                out.counter("nnv_heap_allocations_total", "Calls to operator new",
+                            static_cast<double>(counts.allocations), labels);
+                out.counter("nnv_heap_deallocations_total", "Calls to operator delete",
+                            static_cast<double>(counts.deallocations), labels);
+                out.counter("nnv_heap_allocated_bytes_total", "Bytes requested from operator new",
+                            static_cast<double>(counts.bytes), labels);
+            }
+        }
+    });
+}
+
+MetricsServer::~MetricsServer() {
+    stop();
+}
+
+#ifdef NNV_PLATFORM_WINDOWS
+
+bool MetricsServer::start(std::uint16_t, const std::string&) {
+    NNV_LOG_WARNING("Metrics endpoint is not supported on this platform");
+    return false;
+}
+
+void MetricsServer::stop() {}
+
+void MetricsServer::serve() {}
+
+void MetricsServer::handleConnection(int) {}
+
+#else
+
+bool MetricsServer::start(std::uint16_t port, const std::string& bindAddress) {
+    stop();
+
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(port);
+    if (inet_pton(AF_INET, bindAddress.c_str(), &address.sin_addr) != 1) {
+        NNV_LOG_ERROR("Invalid metrics bind address: {}", bindAddress);
+        return false;
+    }
+
+    listenFd_ = ::socket(AF_INET, SOCK_STREAM, 0);
+    if (listenFd_ < 0) {
+        NNV_LOG_ERROR("Failed to create metrics socket");
+        return false;
+    }
+
+    const int reuse = 1;
+    setsockopt(listenFd_, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+    fcntl(listenFd_, F_SETFD, FD_CLOEXEC);
+
+    if (::bind(listenFd_, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0 ||
+        ::listen(listenFd_, 8) != 0) {
+        NNV_LOG_ERROR("Failed to listen for metrics on {}:{}", bindAddress, port);
+        ::close(listenFd_);
+        listenFd_ = -1;
+        return false;
+    }
+
+    socklen_t length = sizeof(address);
+    getsockname(listenFd_, reinterpret_cast<sockaddr*>(&address), &length);
+    port_ = ntohs(address.sin_port);
+
+    if (::pipe(wakeFds_) != 0) {
+        NNV_LOG_ERROR("Failed to create metrics server wake pipe");
+        ::close(listenFd_);
+        listenFd_ = -1;
+        port_ = 0;
+        return false;
+    }
+
+    running_.store(true);
+    thread_ = std::thread(&MetricsServer::serve, this);
+
+    NNV_LOG_INFO("Serving metrics on http://{}:{}/metrics", bindAddress, port_);
+    return true;
+}
+
+void MetricsServer::stop() {
+    if (!running_.exchange(false)) {
+        return;
+    }
+
+    const char wake = 1;
+    if (::write(wakeFds_[1], &wake, 1) < 0) {
+        NNV_LOG_WARNING("Failed to wake metrics server thread");
+    }
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+
+    ::close(listenFd_);
+    ::close(wakeFds_[0]);
+    ::close(wakeFds_[1]);
+    listenFd_ = -1;
+    wakeFds_[0] = wakeFds_[1] = -1;
+    port_ = 0;
+}
+
+void MetricsServer::serve() {
+    NNV_ALLOCATION_SCOPE(Metrics);
+    NNV_LOG_DEBUG("Metrics server thread started");
+
+    while (running_.load()) {
+        pollfd fds[2] = {{listenFd_, POLLIN, 0}, {wakeFds_[0], POLLIN, 0}};
+        if (::poll(fds, 2, -1) < 0) {
+            continue;
+        }
+        if (fds[1].revents != 0) {
+            break;
+        }
+        if ((fds[0].revents & POLLIN) == 0) {
+            continue;
+        }
+
+        const int client = ::accept(listenFd_, nullptr, nullptr);
+        if (client < 0) {
+            continue;
+        }
+
+        // A stalled client must not block scrapes forever
+        timeval timeout{2, 0};
+        setsockopt(client, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+        setsockopt(client, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+#ifdef SO_NOSIGPIPE
+        const int noSigpipe = 1;
+        setsockopt(client, SOL_SOCKET, SO_NOSIGPIPE, &noSigpipe, sizeof(noSigpipe));
+#endif
+
+        handleConnection(client);
+        ::close(client);
+    }
+
+    NNV_LOG_DEBUG("Metrics server thread stopped");
+}
+
+void MetricsServer::handleConnection(int fd) {
+    std::string request;
+    char buffer[1024];
+    while (request.find("\r\n\r\n") == std::string::npos && request.size() < kMaxRequestBytes) {
+        const ssize_t received = ::recv(fd, buffer, sizeof(buffer), 0);
+        if (received <= 0) {
+            break;
+        }
+        request.append(buffer, static_cast<std::size_t>(received));
+    }
+
+    // Request line: METHOD SP target SP version
+    const std::size_t methodEnd = request.find(' ');
+    const std::size_t targetEnd = methodEnd == std::string::npos ? std::string::npos : request.find(' ', methodEnd + 1);
+    if (targetEnd == std::string::npos) {
+        return;
+    }
+    const std::string method = request.substr(0, methodEnd);
+    std::string target = request.substr(methodEnd + 1, targetEnd - methodEnd - 1);
+    target = target.substr(0, target.find('?'));
+
+    const char* status = "200 OK";
+    const char* contentType = "text/plain; version=0.0.4; charset=utf-8";
+    std::string body;
+    if (method != "GET" && method != "HEAD") {
+        status = "405 Method Not Allowed";
+        contentType = "text/plain; charset=utf-8";
+        body = "Only GET is supported\n";
+    } else if (target == "/metrics") {
+        body = registry_.collect();
+        scrapes_.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        status = "404 Not Found";
+        contentType = "text/plain; charset=utf-8";
+        body = "Metrics are served at /metrics\n";
+    }
+
+    std::string response = "HTTP/1.1 ";
+    response += status;
+    response += "\r\nContent-Type: ";
+    response += contentType;
+    response += "\r\nContent-Length: " + std::to_string(body.size());
+    response += "\r\nConnection: close\r\n\r\n";
+    if (method != "HEAD") {
+        response += body;
+    }
+
+#ifdef MSG_NOSIGNAL
+    constexpr int kSendFlags = MSG_NOSIGNAL;
+#else
+    constexpr int kSendFlags = 0;
+#endif
+    std::size_t sent = 0;
+    while (sent < response.size()) {
+        const ssize_t written = ::send(fd, response.data() + sent, response.size() - sent, kSendFlags);
+        if (written <= 0) {
+            break;
+        }
+        sent += static_cast<std::size_t>(written);
+    }
+}
+
+#endif
+
+} // namespace utils
+} // namespace nnv
@@ -0,0 +1,199 @@
+/**
+ * @file PerfCounters.cpp
+ * @brief Implementation of hardware performance counters
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#include "utils/PerfCounters.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <limits>
+#include <utility>
+
+#ifdef NNV_PLATFORM_LINUX
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace nnv {
+namespace utils {
+
+const char* getHardwareCounterName(HardwareCounter counter) {
+    switch (counter) {
+        case HardwareCounter::Cycles: return "cycles";
+        case HardwareCounter::Instructions: return "instructions";
+        case HardwareCounter::CacheReferences: return "cache references";
+        case HardwareCounter::CacheMisses: return "cache misses";
+        case HardwareCounter::Branches: return "branches";
+        case HardwareCounter::BranchMisses: return "branch misses";
+        default: return "unknown";
+    }
+}
+
+void HardwareCounterValues::addDelta(const HardwareCounterValues& start, const HardwareCounterValues& end) {
+    const std::uint32_t measured = start.validMask & end.validMask;
+    for (std::size_t i = 0; i < kCount; ++i) {
+        // Scaled counts of a multiplexed group can step backwards slightly
+        if ((measured >> i) & 1u && end.counts[i] > start.counts[i]) {
+            counts[i] += end.counts[i] - start.counts[i];
+        }
+    }
+    validMask |= measured;
+}
+
+double HardwareCounterValues::ratio(HardwareCounter numerator, HardwareCounter denominator) const {
+    if (!isValid(numerator) || !isValid(denominator) || (*this)[denominator] == 0) {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+    return static_cast<double>((*this)[numerator]) / static_cast<double>((*this)[denominator]);
+}
+
+PerfCounterGroup::PerfCounterGroup() {
+    fds_.fill(-1);
+    order_.fill(HardwareCounter::Count);
+}
+
+PerfCounterGroup::~PerfCounterGroup() {
+    close();
+}
+
+#ifdef NNV_PLATFORM_LINUX
+
+namespace {
+
+std::string describeOpenError(int error) {
+    std::string message = std::string("perf_event_open failed: ") + std::strerror(error);
+    if (error == EACCES || error == EPERM) {
+        message += " (lower /proc/sys/kernel/perf_event_paranoid or allow perf_event_open in the container)";
+    } else if (error == ENOENT || error == EOPNOTSUPP || error == ENODEV) {
+        message += " (no hardware PMU, e.g. a virtual machine without counter passthrough)";
+    } else if (error == ENOSYS) {
+        message += " (kernel built without perf events)";
+    }
+    return message;
+}
+
+} // namespace
+
+bool PerfCounterGroup::open() {
+    close();
+    error_.clear();
+
+    static const std::pair<HardwareCounter, std::uint64_t> kEvents[] = {
+        {HardwareCounter::Cycles, PERF_COUNT_HW_CPU_CYCLES},
+        {HardwareCounter::Instructions, PERF_COUNT_HW_INSTRUCTIONS},
+        {HardwareCounter::CacheReferences, PERF_COUNT_HW_CACHE_REFERENCES},
+        {HardwareCounter::CacheMisses, PERF_COUNT_HW_CACHE_MISSES},
+        {HardwareCounter::Branches, PERF_COUNT_HW_BRANCH_INSTRUCTIONS},
+        {HardwareCounter::BranchMisses, PERF_COUNT_HW_BRANCH_MISSES}
+    };
+
+    for (const auto& event : kEvents) {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = event.second;
+        attr.disabled = leader_ < 0 ? 1 : 0;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        const int fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, leader_, PERF_FLAG_FD_CLOEXEC));
+        if (fd < 0) {
+            if (leader_ < 0) {
+                error_ = describeOpenError(errno);
+                return false;
+            }
+            // Optional member not provided by this CPU
+            continue;
+        }
+
+        if (leader_ < 0) {
+            leader_ = fd;
+        }
+        fds_[openCount_] = fd;
+        order_[openCount_] = event.first;
+        ++openCount_;
+    }
+
+    ioctl(leader_, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(leader_, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+
+    // A group that never gets scheduled reads as running for 0 ns
+    volatile std::uint64_t spin = 0;
+    for (int i = 0; i < 10000; ++i) {
+        spin = spin + static_cast<std::uint64_t>(i);
+    }
+    HardwareCounterValues probe;
+    if (!read(probe)) {
+        close();
+        error_ = "hardware counter group could not be scheduled";
+        return false;
+    }
+
+    return true;
+}
+
+void PerfCounterGroup::close() {
+    if (leader_ >= 0) {
+        ioctl(leader_, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+    }
+    for (std::size_t i = 0; i < openCount_; ++i) {
+        ::close(fds_[i]);
+        fds_[i] = -1;
+    }
+    leader_ = -1;
+    openCount_ = 0;
+}
+
+bool PerfCounterGroup::read(HardwareCounterValues& out) const {
+    if (leader_ < 0) {
+        return false;
+    }
+
+    // { nr, time_enabled, time_running, value[nr] }
+    std::uint64_t buffer[3 + kCount];
+    const ssize_t bytes = ::read(leader_, buffer, sizeof(buffer));
+    if (bytes < static_cast<ssize_t>((3 + openCount_) * sizeof(std::uint64_t)) || buffer[0] != openCount_) {
+        return false;
+    }
+
+    const std::uint64_t enabled = buffer[1];
+    const std::uint64_t running = buffer[2];
+    if (running == 0) {
+        return false;
+    }
+
+    const double scale = static_cast<double>(enabled) / static_cast<double>(running);
+    out = HardwareCounterValues{};
+    for (std::size_t i = 0; i < openCount_; ++i) {
+        const auto index = static_cast<std::size_t>(order_[i]);
+        out.counts[index] = running == enabled ? buffer[3 + i]
+                                               : static_cast<std::uint64_t>(static_cast<double>(buffer[3 + i]) * scale);
+        out.validMask |= 1u << index;
+    }
+    return true;
+}
+
+#else
+
+bool PerfCounterGroup::open() {
+    error_ = "hardware counters are only supported on Linux";
+    return false;
+}
+
+void PerfCounterGroup::close() {}
+
+bool PerfCounterGroup::read(HardwareCounterValues&) const {
+    return false;
+}
+
+#endif
+
+} // namespace utils
+} // namespace nnv
@@ -0,0 +1,301 @@
+/**
+ * @file Profiler.cpp
+ * @brief Implementation of the scoped instrumentation profiler
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#include "utils/Profiler.hpp"
+#include "utils/Logger.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace nnv {
+namespace utils {
+
+namespace {
+
+constexpr std::size_t kChunkSize = 4096;
+
+struct EventChunk {
+    std::array<ProfileEvent, kChunkSize> events;
+    std::atomic<EventChunk*> next{nullptr};
+};
+
+static_assert(Profiler::kMaxEventsPerThread % kChunkSize == 0, "The event ring must be whole chunks");
+
+/**
+ * @brief Ring of events written by exactly one thread
+ *
+ * The writer fills a slot and then publishes the new count with a release
+ * store; readers only look at slots in [cleared, count), so neither side
+ * needs a lock. Event i lives in slot i % kMaxEventsPerThread: chunks are
+ * allocated on first use, reused once clear() has hidden their events and
+ * never freed before the profiler itself. Readers hold the registry's read
+ * mutex, which clear() also takes, so no slot they can see is overwritten.
+ */
+struct ThreadBuffer {
+    explicit ThreadBuffer(std::uint32_t threadId) : id(threadId), tail(&head) {}
+
+    ~ThreadBuffer() {
+        EventChunk* chunk = head.next.load();
+        while (chunk) {
+            EventChunk* next = chunk->next.load();
+            delete chunk;
+            chunk = next;
+        }
+    }
+
+    void append(const ProfileEvent& event) {
+        const std::size_t index = count.load(std::memory_order_relaxed);
+        if (index - cleared.load(std::memory_order_acquire) >= Profiler::kMaxEventsPerThread) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        const std::size_t slot = index % Profiler::kMaxEventsPerThread;
+        if (slot == 0) {
+            tail = &head;
+        } else if (slot % kChunkSize == 0) {
+            EventChunk* next = tail->next.load(std::memory_order_relaxed);
+            if (!next) {
+                next = new EventChunk();
+                tail->next.store(next, std::memory_order_release);
+            }
+            tail = next;
+        }
+
+        tail->events[slot % kChunkSize] = event;
+        count.store(index + 1, std::memory_order_release);
+    }
+
+    template<typename Visit>
+    void forEach(Visit&& visit) const {
+        const std::size_t end = count.load(std::memory_order_acquire);
+        const std::size_t begin = std::min(cleared.load(std::memory_order_acquire), end);
+        if (begin == end) {
+            return;
+        }
+
+        const std::size_t first = begin % Profiler::kMaxEventsPerThread;
+        const EventChunk* chunk = &head;
+        for (std::size_t c = 0; c < first / kChunkSize; ++c) {
+            chunk = chunk->next.load(std::memory_order_acquire);
+        }
+
+        for (std::size_t i = begin; i < end; ++i) {
+            const std::size_t slot = i % Profiler::kMaxEventsPerThread;
+            if (i > begin && slot % kChunkSize == 0) {
+                chunk = slot == 0 ? &head : chunk->next.load(std::memory_order_acquire);
+            }
+            visit(chunk->events[slot % kChunkSize]);
+        }
+    }
+
+    std::uint32_t id;
+    std::string name;                       ///< Guarded by the registry mutex
+    EventChunk head;
+    EventChunk* tail;                       ///< Writer only
+    std::atomic<std::size_t> count{0};      ///< Events ever appended
+    std::atomic<std::size_t> cleared{0};    ///< Events before this index are hidden and their slots free
+    std::atomic<std::size_t> dropped{0};
+};
+
+struct Registry {
+    std::mutex mutex;
+    std::mutex readMutex;                   ///< Held while reading events and by clear()
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    std::atomic<bool> enabled{true};
+    std::string exitTracePath;
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+};
+
+Registry& registry() {
+    // Leaked so threads still running during static destruction can record
+    static Registry* instance = new Registry();
+    return *instance;
+}
+
+ThreadBuffer& threadBuffer() {
+    thread_local std::shared_ptr<ThreadBuffer> buffer = []() {
+        auto& reg = registry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        auto created = std::make_shared<ThreadBuffer>(static_cast<std::uint32_t>(reg.buffers.size() + 1));
+        reg.buffers.push_back(created);
+        return created;
+    }();
+    return *buffer;
+}
+
+void writeEscaped(std::ostream& out, const char* text) {
+    out << '"';
+    for (const char* c = text ? text : ""; *c; ++c) {
+        switch (*c) {
+            case '"':  out << "\\\""; break;
+            case '\\': out << "\\\\"; break;
+            case '\n': out << "\\n"; break;
+            default:
+                if (static_cast<unsigned char>(*c) >= 0x20) {
+                    out << *c;
+                }
+        }
+    }
+    out << '"';
+}
+
+void writeTraceAtExit() {
+    const std::string path = registry().exitTracePath;
+    if (!path.empty()) {
+        Profiler::writeChromeTrace(path);
+    }
+}
+
+} // namespace
+
+void Profiler::setEnabled(bool enabled) {
+    registry().enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool Profiler::isEnabled() {
+    return registry().enabled.load(std::memory_order_relaxed);
+}
+
+std::uint64_t Profiler::now() {
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - registry().start).count());
+}
+
+void Profiler::record(const char* name, const char* category,
+                      std::uint64_t startNanos, std::uint64_t endNanos) {
+    ProfileEvent event;
+    event.name = name;
+    event.category = category;
+    event.startNanos = startNanos;
+    event.durationNanos = endNanos > startNanos ? endNanos - startNanos : 0;
+    threadBuffer().append(event);
+}
+
+void Profiler::setThreadName(const std::string& name) {
+    auto& buffer = threadBuffer();
+    std::lock_guard<std::mutex> lock(registry().mutex);
+    buffer.name = name;
+}
+
+bool Profiler::writeChromeTrace(const std::string& filename) {
+    std::ofstream file(filename);
+    if (!file.is_open()) {
+        NNV_LOG_ERROR("Failed to open trace file for writing: {}", filename);
+        return false;
+    }
+
+    auto& reg = registry();
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    std::vector<std::string> names;
+    {
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        buffers = reg.buffers;
+        for (const auto& buffer : buffers) {
+            names.push_back(buffer->name);
+        }
+    }
+
+    // Timestamps in microseconds with nanosecond fractions
+    file << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    file.setf(std::ios::fixed);
+    file.precision(3);
+
+    // Keeps clear() from releasing slots for reuse while they are read
+    std::lock_guard<std::mutex> readLock(reg.readMutex);
+    bool first = true;
+    std::size_t written = 0;
+    for (std::size_t b = 0; b < buffers.size(); ++b) {
+        const auto& buffer = *buffers[b];
+
+        if (!names[b].empty()) {
+            file << (first ? "" : ",") << "\n{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":"
+                 << buffer.id << ",\"args\":{\"name\":";
+            writeEscaped(file, names[b].c_str());
+            file << "}}";
+            first = false;
+        }
+
+        buffer.forEach([&](const ProfileEvent& event) {
+            file << (first ? "" : ",") << "\n{\"ph\":\"X\",\"name\":";
+            writeEscaped(file, event.name);
+            file << ",\"cat\":";
+            writeEscaped(file, event.category);
+            file << ",\"ts\":" << static_cast<double>(event.startNanos) / 1000.0
+                 << ",\"dur\":" << static_cast<double>(event.durationNanos) / 1000.0
+                 << ",\"pid\":1,\"tid\":" << buffer.id << "}";
+            first = false;
+            ++written;
+        });
+    }
+
+    file << "\n]}\n";
+
+    if (!file.good()) {
+        NNV_LOG_ERROR("Failed to write trace file: {}", filename);
+        return false;
+    }
+
+    NNV_LOG_INFO("Wrote {} profile events from {} threads to {}", written, buffers.size(), filename);
+    return true;
+}
+
+void Profiler::writeChromeTraceAtExit(const std::string& filename) {
+    auto& reg = registry();
+    bool registerHandler = false;
+    {
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        registerHandler = reg.exitTracePath.empty();
+        reg.exitTracePath = filename;
+    }
+
+    if (registerHandler) {
+        std::atexit(writeTraceAtExit);
+    }
+}
+
+std::size_t Profiler::getEventCount() {
+    auto& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+
+    std::size_t total = 0;
+    for (const auto& buffer : reg.buffers) {
+        const std::size_t end = buffer->count.load(std::memory_order_acquire);
+        total += end - std::min(buffer->cleared.load(std::memory_order_acquire), end);
+    }
+    return total;
+}
+
+std::size_t Profiler::getDroppedCount() {
+    auto& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+
+    std::size_t total = 0;
+    for (const auto& buffer : reg.buffers) {
+        total += buffer->dropped.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+void Profiler::clear() {
+    auto& reg = registry();
+    std::lock_guard<std::mutex> readLock(reg.readMutex);
+    std::lock_guard<std::mutex> lock(reg.mutex);
+
+    for (const auto& buffer : reg.buffers) {
+        buffer->cleared.store(buffer->count.load(std::memory_order_acquire), std::memory_order_release);
+    }
+}
+
+} // namespace utils
+} // namespace nnv
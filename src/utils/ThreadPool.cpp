@@ -0,0 +1,134 @@
+/**
+ * @file ThreadPool.cpp
+ * @brief Implementation of the worker pool and cancellation tokens
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#include "utils/ThreadPool.hpp"
+#include "utils/Profiler.hpp"
+#include <algorithm>
+#include <utility>
+
+namespace nnv {
+namespace utils {
+
+struct CancellationToken::Registration::State {
+    std::atomic<bool> cancelled{false};
+    std::mutex mutex;
+    std::size_t nextId = 1;
+    std::vector<std::pair<std::size_t, std::function<void()>>> callbacks;
+};
+
+void CancellationToken::Registration::reset() {
+    if (!state_) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    auto& callbacks = state_->callbacks;
+    callbacks.erase(std::remove_if(callbacks.begin(), callbacks.end(),
+                                   [this](const auto& entry) { return entry.first == id_; }),
+                    callbacks.end());
+    state_.reset();
+}
+
+CancellationToken::CancellationToken()
+    : state_(std::make_shared<Registration::State>())
+{
+}
+
+void CancellationToken::cancel() {
+    // Callbacks run under the lock so Registration::reset() cannot return
+    // while one is still executing against a destroyed owner
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    if (state_->cancelled.exchange(true)) {
+        return;
+    }
+
+    for (auto& entry : state_->callbacks) {
+        entry.second();
+    }
+}
+
+bool CancellationToken::isCancelled() const {
+    return state_->cancelled.load();
+}
+
+CancellationToken::Registration CancellationToken::onCancel(std::function<void()> callback) const {
+    Registration registration;
+    {
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        if (!state_->cancelled.load()) {
+            registration.state_ = state_;
+            registration.id_ = state_->nextId++;
+            state_->callbacks.emplace_back(registration.id_, std::move(callback));
+            return registration;
+        }
+    }
+
+    callback();
+    return registration;
+}
+
+ThreadPool::ThreadPool(std::size_t threadCount)
+    : stopping_(false)
+{
+    if (threadCount == 0) {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    workers_.reserve(threadCount);
+    for (std::size_t i = 0; i < threadCount; ++i) {
+        workers_.emplace_back([this]() { workerLoop(); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    available_.notify_all();
+
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+ThreadPool& ThreadPool::getShared() {
+    static ThreadPool pool;
+    return pool;
+}
+
+void ThreadPool::enqueue(std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        tasks_.push_back(std::move(task));
+    }
+    available_.notify_one();
+}
+
+void ThreadPool::workerLoop() {
+    NNV_PROFILE_THREAD("nnv worker");
+    
+    for (;;) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            available_.wait(lock, [this]() { return stopping_ || !tasks_.empty(); });
+
+            if (tasks_.empty()) {
+                return; // Stopping and drained
+            }
+
+            task = std::move(tasks_.front());
+            tasks_.pop_front();
+        }
+
+        task();
+    }
+}
+
+} // namespace utils
+} // namespace nnv
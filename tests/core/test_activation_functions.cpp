@@ -0,0 +1,110 @@
+/**
+ * @file test_activation_functions.cpp
+ * @brief Unit tests for activation functions
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#include <gtest/gtest.h>
+#include "core/ActivationFunctions.hpp"
+#include "core/NeuralNetwork.hpp"
+
+using namespace nnv::core;
+
+namespace {
+
+// Reference product with the explicit Jacobian diag(s) - s s^T
+std::vector<double> jacobianProduct(const std::vector<double>& s, const std::vector<double>& v) {
+    std::vector<double> result(s.size(), 0.0);
+    for (std::size_t i = 0; i < s.size(); ++i) {
+        for (std::size_t j = 0; j < s.size(); ++j) {
+            double jacobian = (i == j ? s[i] : 0.0) - s[i] * s[j];
+            result[i] += jacobian * v[j];
+        }
+    }
+    return result;
+}
+
+} // namespace
+
+TEST(ActivationFunctionsTest, SoftmaxSumsToOne) {
+    auto s = activation::softmax(std::vector<double>{1.0, 2.0, 3.0, 1000.0});
+
+    double sum = 0.0;
+    for (double value : s) {
+        EXPECT_GE(value, 0.0);
+        sum += value;
+    }
+    EXPECT_NEAR(sum, 1.0, 1e-12);
+}
+
+TEST(ActivationFunctionsTest, SoftmaxJvpMatchesJacobian) {
+    auto s = activation::softmax(std::vector<double>{0.5, -1.0, 2.0, 0.1, -0.3});
+    std::vector<double> v = {1.0, -2.0, 0.5, 3.0, -0.25};
+
+    auto expected = jacobianProduct(s, v);
+    auto jvp = activation::softmaxJvp(s, v);
+    auto vjp = activation::softmaxVjp(s, v);
+
+    ASSERT_EQ(jvp.size(), expected.size());
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_NEAR(jvp[i], expected[i], 1e-12);
+        EXPECT_NEAR(vjp[i], expected[i], 1e-12);
+    }
+}
+
+TEST(ActivationFunctionsTest, SoftmaxVjpBatchedInPlace) {
+    const std::size_t rows = 3;
+    const std::size_t cols = 4;
+    std::vector<double> s;
+    std::vector<double> g = {0.1, 0.2, 0.3, 0.4,
+                             -1.0, 0.0, 1.0, 2.0,
+                             5.0, -5.0, 0.5, 0.0};
+
+    for (std::size_t r = 0; r < rows; ++r) {
+        auto row = activation::softmax(std::vector<double>{
+            0.1 * r, 1.0 - r, 0.5, -0.2 * r});
+        s.insert(s.end(), row.begin(), row.end());
+    }
+
+    std::vector<double> expected;
+    for (std::size_t r = 0; r < rows; ++r) {
+        std::vector<double> sr(s.begin() + r * cols, s.begin() + (r + 1) * cols);
+        std::vector<double> gr(g.begin() + r * cols, g.begin() + (r + 1) * cols);
+        auto row = jacobianProduct(sr, gr);
+        expected.insert(expected.end(), row.begin(), row.end());
+    }
+
+    activation::softmaxVjp(s.data(), g.data(), g.data(), rows, cols);
+
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_NEAR(g[i], expected[i], 1e-12);
+    }
+}
+
+TEST(ActivationFunctionsTest, SoftmaxCrossEntropyOutputDelta) {
+    NetworkConfig config;
+    config.loss = LossType::CrossEntropy;
+
+    LayerConfig inputLayer;
+    inputLayer.size = 3;
+    inputLayer.activation = ActivationType::None;
+    config.layers.push_back(inputLayer);
+
+    LayerConfig outputLayer;
+    outputLayer.size = 4;
+    outputLayer.activation = ActivationType::Softmax;
+    config.layers.push_back(outputLayer);
+
+    NeuralNetwork<double> network(config);
+    std::vector<double> targets = {0.0, 1.0, 0.0, 0.0};
+
+    auto outputs = network.forward({0.3, -0.7, 1.1});
+    network.backward(targets, outputs);
+
+    // Softmax + cross-entropy backpropagates as s - y
+    const auto& layer = network.getLayer(1);
+    for (std::size_t i = 0; i < outputs.size(); ++i) {
+        EXPECT_NEAR(layer.getNeuron(i).getDelta(), outputs[i] - targets[i], 1e-9);
+    }
+}
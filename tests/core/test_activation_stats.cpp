@@ -0,0 +1,111 @@
+/**
+ * @file test_activation_stats.cpp
+ * @brief Unit tests for sampled activation statistics
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#include <gtest/gtest.h>
+#include "core/ActivationStats.hpp"
+#include "core/NeuralNetwork.hpp"
+#include "core/Types.hpp"
+
+using namespace nnv::core;
+
+class ActivationStatsTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        NetworkConfig config;
+        config.name = "Stats Test";
+
+        LayerConfig inputLayer;
+        inputLayer.size = 3;
+        inputLayer.activation = ActivationType::None;
+        config.layers.push_back(inputLayer);
+
+        LayerConfig hidden;
+        hidden.size = 4;
+        hidden.activation = ActivationType::ReLU;
+        config.layers.push_back(hidden);
+
+        LayerConfig outputLayer;
+        outputLayer.size = 2;
+        outputLayer.activation = ActivationType::Sigmoid;
+        config.layers.push_back(outputLayer);
+
+        network = std::make_unique<NeuralNetwork<double>>(config);
+    }
+
+    void trainBatches(std::size_t count) {
+        std::vector<std::vector<double>> inputs = {{0.1, 0.2, 0.3}, {-0.5, 0.4, 0.9}};
+        std::vector<std::vector<double>> targets = {{1.0, 0.0}, {0.0, 1.0}};
+
+        for (std::size_t i = 0; i < count; ++i) {
+            network->trainBatch(inputs, targets);
+        }
+    }
+
+    std::unique_ptr<NeuralNetwork<double>> network;
+};
+
+TEST_F(ActivationStatsTest, WelfordMatchesDirectComputation) {
+    NeuronActivationStats stats;
+    const double values[] = {0.0, 1.0, 2.0, 0.0, 5.0};
+    for (double v : values) {
+        stats.add(v);
+    }
+
+    EXPECT_EQ(stats.count, 5u);
+    EXPECT_DOUBLE_EQ(stats.mean, 1.6);
+    EXPECT_NEAR(stats.variance(), 3.44, 1e-12);
+    EXPECT_DOUBLE_EQ(stats.zeroFraction(), 0.4);
+    EXPECT_DOUBLE_EQ(stats.min, 0.0);
+    EXPECT_DOUBLE_EQ(stats.max, 5.0);
+}
+
+TEST_F(ActivationStatsTest, DisabledByDefault) {
+    EXPECT_EQ(network->getActivationStats(), nullptr);
+    trainBatches(2);
+}
+
+TEST_F(ActivationStatsTest, SamplesEveryNthBatch) {
+    network->enableActivationStats(4);
+    auto stats = network->getActivationStats();
+    ASSERT_NE(stats, nullptr);
+
+    trainBatches(9); // Batches 0, 4 and 8 are sampled
+
+    auto snapshot = stats->snapshot();
+    EXPECT_EQ(snapshot.sampledBatches, 3u);
+    EXPECT_EQ(stats->getVersion(), 3u);
+
+    ASSERT_EQ(snapshot.layers.size(), 3u);
+    EXPECT_TRUE(snapshot.layers[0].empty()); // Input layer has no activation
+    ASSERT_EQ(snapshot.layers[1].size(), 4u);
+    ASSERT_EQ(snapshot.layers[2].size(), 2u);
+
+    // Two samples per batch
+    for (const auto& neuron : snapshot.layers[2]) {
+        EXPECT_EQ(neuron.count, 6u);
+        EXPECT_GT(neuron.min, 0.0);
+        EXPECT_LT(neuron.max, 1.0);
+        EXPECT_GE(neuron.mean, neuron.min);
+        EXPECT_LE(neuron.mean, neuron.max);
+    }
+}
+
+TEST_F(ActivationStatsTest, ResetClearsPublishedStats) {
+    network->enableActivationStats(1);
+    trainBatches(3);
+    EXPECT_EQ(network->getActivationStats()->snapshot().sampledBatches, 3u);
+
+    network->reset();
+
+    auto snapshot = network->getActivationStats()->snapshot();
+    EXPECT_EQ(snapshot.sampledBatches, 0u);
+    for (const auto& layer : snapshot.layers) {
+        for (const auto& neuron : layer) {
+            EXPECT_EQ(neuron.count, 0u);
+        }
+    }
+}
@@ -0,0 +1,123 @@
+/**
+ * @file test_cost_model.cpp
+ * @brief Unit tests for the analytic cost model and roofline analysis
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#include <gtest/gtest.h>
+#include "core/CostModel.hpp"
+#include "core/NeuralNetwork.hpp"
+#include "utils/MachinePeaks.hpp"
+
+using namespace nnv::core;
+
+namespace {
+
+NetworkConfig makeConfig() {
+    NetworkConfig config;
+    for (LayerSize size : {4u, 8u, 3u}) {
+        LayerConfig layerConfig;
+        layerConfig.size = size;
+        config.layers.push_back(layerConfig);
+    }
+    return config;
+}
+
+} // namespace
+
+TEST(CostModelTest, CountsWorkAndBytesPerLayer) {
+    NeuralNetwork<float> network(makeConfig());
+    const CostModel model = network.costModel(2);
+
+    ASSERT_EQ(model.layers.size(), 3u);
+    EXPECT_EQ(model.batchSize, 2u);
+    EXPECT_EQ(model.layers[0].activationBytes, 2 * 4 * sizeof(float));
+    EXPECT_DOUBLE_EQ(model.layers[0].total().flops, 0.0);
+
+    const LayerCost& hidden = model.layers[1];
+    EXPECT_EQ(hidden.inputSize, 4u);
+    EXPECT_EQ(hidden.outputSize, 8u);
+    EXPECT_EQ(hidden.parameterBytes, (4 * 8 + 8) * sizeof(float));
+    EXPECT_EQ(hidden.activationBytes, 2 * 8 * sizeof(float));
+    EXPECT_DOUBLE_EQ(hidden.forward.flops, 2.0 * 2 * 4 * 8);
+    EXPECT_DOUBLE_EQ(hidden.backward.flops, 2.0 * 2 * 8 * 3);
+    EXPECT_DOUBLE_EQ(hidden.update.flops, 3.0 * 2 * 4 * 8);
+    EXPECT_DOUBLE_EQ(hidden.forward.bytes, 2.0 * (4 * 8 + 4 + 3 * 8) * sizeof(float));
+    EXPECT_GT(hidden.update.bytes, 2.0 * hidden.parameterBytes);
+
+    // The output layer's deltas come from the loss, not from a next layer
+    EXPECT_DOUBLE_EQ(model.layers[2].backward.flops, 0.0);
+    EXPECT_EQ(model.parameterBytes(), (4 * 8 + 8 + 8 * 3 + 3) * sizeof(float));
+
+    // Cost is linear in the batch size
+    const CostModel single = network.costModel(1);
+    EXPECT_DOUBLE_EQ(model.total().flops, 2.0 * single.total().flops);
+    EXPECT_DOUBLE_EQ(model.total().bytes, 2.0 * single.total().bytes);
+}
+
+TEST(CostModelTest, MatchesMeasuredFlops) {
+    NeuralNetwork<float> network(makeConfig());
+    network.enablePerfStats();
+
+    std::vector<std::vector<float>> inputs(5, std::vector<float>(4, 0.5f));
+    std::vector<std::vector<float>> targets(5, std::vector<float>(3, 1.0f));
+    network.trainBatch(inputs, targets);
+
+    const CostModel model = network.costModel(inputs.size());
+    const PerfStats stats = network.getPerfStats();
+    for (std::size_t l = 1; l < model.layers.size(); ++l) {
+        EXPECT_DOUBLE_EQ(stats.layers[l].forwardFlops, model.layers[l].forward.flops);
+        EXPECT_DOUBLE_EQ(stats.layers[l].backwardFlops, model.layers[l].backward.flops);
+        EXPECT_DOUBLE_EQ(stats.layers[l].updateFlops, model.layers[l].update.flops);
+    }
+}
+
+TEST(CostModelTest, ClassifiesPointsAgainstTheRoofs) {
+    CostModel model;
+    model.batchSize = 1;
+    model.layers.resize(2);
+    model.layers[1].forward = {1e9, 1e9};       // 1 FLOP/B
+    model.layers[1].update = {4e9, 1e8};        // 40 FLOP/B
+
+    PerfStats stats;
+    stats.layers.resize(2);
+    stats.layers[1].forward.record(1000000000);  // 1 s per sample, 2 samples
+    stats.layers[1].forward.record(1000000000);
+    stats.layers[1].update.record(2000000000);
+
+    nnv::utils::MachinePeaks peaks;
+    peaks.gflops = 10.0;
+    peaks.gbps = 4.0;
+
+    const auto points = computeRoofline(model, stats, peaks);
+    ASSERT_EQ(points.size(), 2u);
+
+    EXPECT_EQ(points[0].phase, TrainingPhase::Forward);
+    EXPECT_DOUBLE_EQ(points[0].seconds, 2.0);
+    EXPECT_DOUBLE_EQ(points[0].gflops, 1.0);
+    EXPECT_DOUBLE_EQ(points[0].gbps, 1.0);
+    EXPECT_EQ(points[0].bound, RooflineBound::Memory);
+    EXPECT_DOUBLE_EQ(points[0].attainableGflops, 4.0);
+    EXPECT_DOUBLE_EQ(points[0].efficiency, 0.25);
+
+    EXPECT_EQ(points[1].phase, TrainingPhase::Update);
+    EXPECT_EQ(points[1].bound, RooflineBound::Compute);
+    EXPECT_DOUBLE_EQ(points[1].attainableGflops, 10.0);
+    EXPECT_DOUBLE_EQ(points[1].gflops, 2.0);
+
+    // Moving more bytes than DRAM allows means the data came from cache
+    peaks.gbps = 0.5;
+    EXPECT_EQ(computeRoofline(model, stats, peaks)[0].bound, RooflineBound::Cache);
+
+    EXPECT_NE(formatRoofline(points, peaks).find("memory"), std::string::npos);
+}
+
+TEST(CostModelTest, MachinePeakProbesReturnPositiveValues) {
+    const auto peaks = nnv::utils::measureMachinePeaks(std::size_t{1} << 20, 1);
+    EXPECT_GT(peaks.gflops, 0.0);
+    EXPECT_GT(peaks.gbps, 0.0);
+    EXPECT_GT(peaks.ridgeIntensity(), 0.0);
+    EXPECT_FALSE(peaks.computeRoof.empty());
+    EXPECT_NE(formatRoofline({}, peaks).find("(" + peaks.computeRoof + ")"), std::string::npos);
+}
@@ -0,0 +1,167 @@
+/**
+ * @file test_incremental_evaluator.cpp
+ * @brief Unit tests for the IncrementalEvaluator class
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#include <gtest/gtest.h>
+#include "core/IncrementalEvaluator.hpp"
+#include "core/NeuralNetwork.hpp"
+#include "core/Types.hpp"
+
+using namespace nnv::core;
+
+class IncrementalEvaluatorTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        network = std::make_unique<NeuralNetwork<double>>(makeConfig(ActivationType::Softmax));
+        evaluator = std::make_unique<IncrementalEvaluator<double>>(*network);
+    }
+
+    void TearDown() override {
+        evaluator.reset();
+        network.reset();
+    }
+
+    static NetworkConfig makeConfig(ActivationType outputActivation) {
+        NetworkConfig config;
+        config.name = "Incremental Test";
+
+        LayerConfig inputLayer;
+        inputLayer.size = 4;
+        inputLayer.activation = ActivationType::None;
+        config.layers.push_back(inputLayer);
+
+        LayerConfig hidden1;
+        hidden1.size = 6;
+        hidden1.activation = ActivationType::Tanh;
+        config.layers.push_back(hidden1);
+
+        LayerConfig hidden2;
+        hidden2.size = 5;
+        hidden2.activation = ActivationType::ReLU;
+        config.layers.push_back(hidden2);
+
+        LayerConfig outputLayer;
+        outputLayer.size = 3;
+        outputLayer.activation = outputActivation;
+        config.layers.push_back(outputLayer);
+
+        return config;
+    }
+
+    void expectMatchesFullForward() {
+        auto expected = network->predict(inputs);
+        const auto& actual = evaluator->getOutputs();
+
+        ASSERT_EQ(actual.size(), expected.size());
+        for (std::size_t i = 0; i < expected.size(); ++i) {
+            EXPECT_NEAR(actual[i], expected[i], 1e-9);
+        }
+    }
+
+    std::vector<double> inputs = {0.5, -0.25, 0.75, 1.0};
+    std::unique_ptr<NeuralNetwork<double>> network;
+    std::unique_ptr<IncrementalEvaluator<double>> evaluator;
+};
+
+TEST_F(IncrementalEvaluatorTest, EvaluateMatchesPredict) {
+    ASSERT_TRUE(evaluator->evaluate(inputs));
+    EXPECT_TRUE(evaluator->isValid());
+    expectMatchesFullForward();
+}
+
+TEST_F(IncrementalEvaluatorTest, WeightEditsMatchFullForward) {
+    ASSERT_TRUE(evaluator->evaluate(inputs));
+
+    EXPECT_TRUE(evaluator->setWeight(1, 2, 3, 0.9));
+    expectMatchesFullForward();
+
+    EXPECT_TRUE(evaluator->setWeight(2, 0, 5, -1.3));
+    expectMatchesFullForward();
+
+    EXPECT_TRUE(evaluator->setWeight(3, 1, 4, 2.0));
+    expectMatchesFullForward();
+}
+
+TEST_F(IncrementalEvaluatorTest, BiasEditsMatchFullForward) {
+    ASSERT_TRUE(evaluator->evaluate(inputs));
+
+    EXPECT_TRUE(evaluator->setBias(1, 4, 0.3));
+    expectMatchesFullForward();
+
+    EXPECT_TRUE(evaluator->setBias(2, 2, 1.5));
+    expectMatchesFullForward();
+
+    EXPECT_TRUE(evaluator->setBias(3, 0, -0.7));
+    expectMatchesFullForward();
+}
+
+TEST_F(IncrementalEvaluatorTest, EditsAreVisibleInNetwork) {
+    ASSERT_TRUE(evaluator->evaluate(inputs));
+    ASSERT_TRUE(evaluator->setWeight(1, 0, 0, 0.42));
+
+    EXPECT_DOUBLE_EQ(network->getLayer(1).getNeuron(0).getInputWeight(0), 0.42);
+
+    const auto outputs = evaluator->getOutputs();
+    auto layerOutputs = network->getLayer(3).getActivations();
+    for (std::size_t i = 0; i < outputs.size(); ++i) {
+        EXPECT_DOUBLE_EQ(layerOutputs[i], outputs[i]);
+    }
+}
+
+TEST_F(IncrementalEvaluatorTest, RejectsInvalidEdits) {
+    EXPECT_FALSE(evaluator->setWeight(1, 0, 0, 1.0)); // Not evaluated yet
+
+    ASSERT_TRUE(evaluator->evaluate(inputs));
+    EXPECT_FALSE(evaluator->setWeight(0, 0, 0, 1.0)); // Input layer has no weights
+    EXPECT_FALSE(evaluator->setWeight(1, 6, 0, 1.0)); // Neuron out of range
+    EXPECT_FALSE(evaluator->setWeight(1, 0, 4, 1.0)); // Input out of range
+    EXPECT_FALSE(evaluator->setBias(4, 0, 1.0));      // Layer out of range
+}
+
+TEST_F(IncrementalEvaluatorTest, InvalidatedByStructuralChange) {
+    ASSERT_TRUE(evaluator->evaluate(inputs));
+
+    LayerConfig extra;
+    extra.size = 2;
+    network->addLayer(extra);
+
+    EXPECT_FALSE(evaluator->setWeight(1, 0, 0, 1.0));
+    EXPECT_FALSE(evaluator->isValid());
+}
+
+TEST_F(IncrementalEvaluatorTest, ManyEditsWithSigmoidOutput) {
+    network = std::make_unique<NeuralNetwork<double>>(makeConfig(ActivationType::Sigmoid));
+    evaluator = std::make_unique<IncrementalEvaluator<double>>(*network);
+    evaluator->setRefreshInterval(0);
+
+    ASSERT_TRUE(evaluator->evaluate(inputs));
+
+    for (int step = 0; step < 50; ++step) {
+        std::size_t layer = 1 + step % 3;
+        std::size_t neuron = step % network->getLayer(layer).getSize();
+        std::size_t input = step % network->getLayer(layer - 1).getSize();
+        ASSERT_TRUE(evaluator->setWeight(layer, neuron, input, 0.05 * (step - 25)));
+    }
+
+    expectMatchesFullForward();
+}
+
+TEST_F(IncrementalEvaluatorTest, EditsAfterTrainingUseCurrentWeights) {
+    ASSERT_TRUE(evaluator->evaluate(inputs));
+
+    // Training rewrites every layer's weights and the cached pre-activations
+    network->setLearningRate(0.1);
+    for (int step = 0; step < 5; ++step) {
+        network->trainBatch({inputs}, {{0.0, 1.0, 0.0}});
+    }
+    EXPECT_TRUE(evaluator->setWeight(1, 2, 3, 0.9));
+    expectMatchesFullForward();
+
+    // So does a direct edit through the layer
+    network->getLayer(2).getMutableWeightRow(0)[1] += 0.5;
+    EXPECT_TRUE(evaluator->setBias(3, 0, -0.7));
+    expectMatchesFullForward();
+}
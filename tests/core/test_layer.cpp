@@ -0,0 +1,153 @@
+/**
+ * @file test_layer.cpp
+ * @brief Unit tests for the Layer class
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+#include "core/Layer.hpp"
+#include "core/NeuralNetwork.hpp"
+
+using namespace nnv::core;
+
+class LayerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        layer = std::make_unique<Layer<double>>(3, ActivationType::Sigmoid, "hidden");
+        layer->initializeWeights(2, InitializationType::Zero);
+        layer->setWeightMatrix({{0.1, 0.2}, {0.3, 0.4}, {0.5, 0.6}});
+        layer->setBiases({0.0, 0.5, -0.5});
+    }
+
+    std::unique_ptr<Layer<double>> layer;
+};
+
+TEST_F(LayerTest, WeightsAreContiguousRows) {
+    EXPECT_EQ(layer->getSize(), 3u);
+    EXPECT_EQ(layer->getInputSize(), 2u);
+
+    const double* data = layer->getWeightData();
+    EXPECT_DOUBLE_EQ(data[0], 0.1);
+    EXPECT_DOUBLE_EQ(data[3], 0.4);
+    EXPECT_EQ(layer->getWeightRow(2), data + 4);
+}
+
+TEST_F(LayerTest, NeuronHandleReadsAndWritesLayerArrays) {
+    auto neuron = layer->getNeuron(1);
+    EXPECT_EQ(neuron.getId(), 1u);
+    EXPECT_EQ(neuron.getInputCount(), 2u);
+    EXPECT_DOUBLE_EQ(neuron.getInputWeight(1), 0.4);
+    EXPECT_DOUBLE_EQ(neuron.getInputWeight(5), 0.0);
+
+    neuron.setInputWeight(0, 0.9);
+    neuron.setBias(1.5);
+    EXPECT_DOUBLE_EQ(layer->getWeightMatrix()[1][0], 0.9);
+    EXPECT_DOUBLE_EQ(layer->getBiases()[1], 1.5);
+
+    const Layer<double>& constLayer = *layer;
+    EXPECT_EQ(constLayer.getNeuron(1).getInputWeights(), (std::vector<double>{0.9, 0.4}));
+}
+
+TEST_F(LayerTest, ForwardAndActivation) {
+    layer->forward({1.0, 2.0});
+    layer->applyActivation();
+
+    const auto& weighted = layer->getWeightedInputs();
+    EXPECT_NEAR(weighted[0], 0.5, 1e-12);
+    EXPECT_NEAR(weighted[2], 1.7, 1e-12);
+
+    const auto& activations = layer->getActivations();
+    EXPECT_NEAR(activations[1], activation::sigmoid(1.1 + 0.5), 1e-12);
+}
+
+TEST_F(LayerTest, SparseNamesAndFlags) {
+    EXPECT_EQ(layer->getNeuron(0).getName(), "");
+    EXPECT_TRUE(layer->getNeuron(2).isTrainable());
+
+    layer->getNeuron(0).setName("bias unit");
+    layer->getNeuron(2).setTrainable(false);
+
+    EXPECT_EQ(layer->getNeuronName(0), "bias unit");
+    EXPECT_FALSE(layer->isNeuronTrainable(2));
+    EXPECT_TRUE(layer->isNeuronTrainable(1));
+
+    layer->getNeuron(0).setName("");
+    EXPECT_EQ(layer->getNeuronName(0), "");
+}
+
+TEST_F(LayerTest, JsonRoundTripKeepsNeuronFormat) {
+    layer->getNeuron(1).setName("second");
+    layer->getNeuron(2).setTrainable(false);
+
+    auto json = layer->toJson();
+    ASSERT_EQ(json["neurons"].size(), 3u);
+    EXPECT_EQ(json["neurons"][1]["input_weights"].get<std::vector<double>>(),
+              (std::vector<double>{0.3, 0.4}));
+    EXPECT_EQ(json["neurons"][1]["name"], "second");
+
+    Layer<double> restored(1);
+    restored.fromJson(json);
+
+    EXPECT_EQ(restored.getSize(), 3u);
+    EXPECT_EQ(restored.getInputSize(), 2u);
+    EXPECT_EQ(restored.getWeightMatrix(), layer->getWeightMatrix());
+    EXPECT_EQ(restored.getBiases(), layer->getBiases());
+    EXPECT_EQ(restored.getNeuronName(1), "second");
+    EXPECT_FALSE(restored.isNeuronTrainable(2));
+}
+
+TEST_F(LayerTest, MemoryUsageCountsArrays) {
+    auto usage = layer->memoryUsage();
+    EXPECT_GE(usage.weights, (3 * 2 + 3) * sizeof(double));
+    EXPECT_GE(usage.activations, 4 * 3 * sizeof(double));
+    EXPECT_EQ(usage.optimizerState, 0u);
+    EXPECT_EQ(usage.total(), usage.weights + usage.optimizerState + usage.activations +
+                             usage.scratch + usage.metadata);
+}
+
+TEST_F(LayerTest, CloneSharesParametersUntilWritten) {
+    auto copy = layer->clone();
+    EXPECT_TRUE(layer->hasSharedParameters());
+    EXPECT_EQ(copy->getWeightData(), layer->getWeightData());
+    EXPECT_EQ(copy->getActivationType(), ActivationType::Sigmoid);
+
+    copy->getNeuron(0).setInputWeight(1, 2.0);
+    EXPECT_FALSE(layer->hasSharedParameters());
+    EXPECT_NE(copy->getWeightData(), layer->getWeightData());
+    EXPECT_DOUBLE_EQ(copy->getWeightRow(0)[1], 2.0);
+    EXPECT_DOUBLE_EQ(layer->getWeightRow(0)[1], 0.2);
+    EXPECT_DOUBLE_EQ(copy->getBiases()[1], 0.5);
+}
+
+TEST_F(LayerTest, UpdateOnCloneLeavesOriginal) {
+    layer->forward({1.0, 2.0});
+    layer->applyActivation();
+    auto copy = layer->clone();
+
+    std::vector<double> inputs = {1.0, 2.0};
+    copy->computeGradients({1.0}, {{1.0, 1.0, 1.0}});
+    copy->updateWeights(0.1, inputs);
+
+    EXPECT_DOUBLE_EQ(layer->getWeightRow(2)[0], 0.5);
+    EXPECT_DOUBLE_EQ(layer->getBiases()[2], -0.5);
+    EXPECT_NE(copy->getWeightRow(2)[0], 0.5);
+}
+
+TEST(NetworkMemoryUsageTest, PerLayerBreakdown) {
+    NetworkConfig config;
+    for (LayerSize size : {8u, 16u, 4u}) {
+        LayerConfig layerConfig;
+        layerConfig.size = size;
+        config.layers.push_back(layerConfig);
+    }
+
+    NeuralNetwork<float> network(config);
+    auto usage = network.memoryUsage();
+
+    ASSERT_EQ(usage.layers.size(), 3u);
+    EXPECT_GE(usage.layers[1].weights, (16 * 8 + 16) * sizeof(float));
+    EXPECT_GE(usage.layers[2].weights, (4 * 16 + 4) * sizeof(float));
+    EXPECT_GT(usage.total().total(), usage.layers[1].total());
+}
@@ -0,0 +1,126 @@
+/**
+ * @file test_loss_functions.cpp
+ * @brief Unit tests for loss functions
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include "core/LossFunctions.hpp"
+
+using namespace nnv::core;
+
+class LossFunctionsTest : public ::testing::Test {
+protected:
+    static constexpr std::size_t kRows = 3;
+    static constexpr std::size_t kCols = 4;
+
+    std::vector<double> row(const std::vector<double>& matrix, std::size_t r) const {
+        return std::vector<double>(matrix.begin() + r * kCols, matrix.begin() + (r + 1) * kCols);
+    }
+
+    // Fused kernel must match the per-sample loss and gradient functions
+    void expectFusedMatchesScalar(LossType type) {
+        auto fused = LossFactory::getFused<double>(type);
+        auto lossFunction = LossFactory::getFunction<double>(type);
+        auto gradientFunction = LossFactory::getGradient<double>(type);
+
+        std::vector<double> gradients(kRows * kCols, 0.0);
+        double loss = fused(ConstMatrixView<double>(outputs.data(), kRows, kCols),
+                            ConstMatrixView<double>(targets.data(), kRows, kCols),
+                            MatrixView<double>(gradients.data(), kRows, kCols));
+
+        double expectedLoss = 0.0;
+        for (std::size_t r = 0; r < kRows; ++r) {
+            expectedLoss += lossFunction(row(outputs, r), row(targets, r));
+
+            auto expectedGradients = gradientFunction(row(outputs, r), row(targets, r));
+            for (std::size_t c = 0; c < kCols; ++c) {
+                EXPECT_NEAR(gradients[r * kCols + c], expectedGradients[c], 1e-12)
+                    << "row " << r << " col " << c;
+            }
+        }
+
+        EXPECT_NEAR(loss, expectedLoss / kRows, 1e-12);
+
+        // An empty gradient view computes the same loss without writing gradients
+        EXPECT_DOUBLE_EQ(fused(ConstMatrixView<double>(outputs.data(), kRows, kCols),
+                               ConstMatrixView<double>(targets.data(), kRows, kCols),
+                               MatrixView<double>{}), loss);
+    }
+
+    std::vector<double> outputs = {0.1, 0.7, 0.15, 0.05,
+                                   0.4, 0.3, 0.2, 0.1,
+                                   0.9, 0.02, 0.03, 0.05};
+    std::vector<double> targets = {0.0, 1.0, 0.0, 0.0,
+                                   0.0, 0.0, 1.0, 0.0,
+                                   1.0, 0.0, 0.0, 0.0};
+};
+
+TEST_F(LossFunctionsTest, FusedMeanSquaredError) {
+    expectFusedMatchesScalar(LossType::MeanSquaredError);
+}
+
+TEST_F(LossFunctionsTest, FusedCrossEntropy) {
+    expectFusedMatchesScalar(LossType::CrossEntropy);
+}
+
+TEST_F(LossFunctionsTest, FusedBinaryCrossEntropy) {
+    expectFusedMatchesScalar(LossType::BinaryCrossEntropy);
+}
+
+TEST_F(LossFunctionsTest, FusedHuber) {
+    // Residuals beyond delta exercise the linear branch
+    targets[3] = 2.5;
+    targets[4] = -1.5;
+    expectFusedMatchesScalar(LossType::Huber);
+}
+
+TEST_F(LossFunctionsTest, FusedFocal) {
+    expectFusedMatchesScalar(LossType::FocalLoss);
+}
+
+TEST_F(LossFunctionsTest, FusedRejectsShapeMismatch) {
+    std::vector<double> gradients(kRows * kCols, 0.0);
+    double loss = loss::meanSquaredErrorBatch(ConstMatrixView<double>(outputs.data(), kRows, kCols),
+                                              ConstMatrixView<double>(targets.data(), kRows - 1, kCols),
+                                              MatrixView<double>(gradients.data(), kRows, kCols));
+    EXPECT_DOUBLE_EQ(loss, 0.0);
+}
+
+TEST_F(LossFunctionsTest, PowIntMatchesPow) {
+    for (unsigned e = 0; e <= 9; ++e) {
+        EXPECT_NEAR(loss::powInt(0.73, e), std::pow(0.73, static_cast<double>(e)), 1e-15);
+    }
+
+    EXPECT_EQ(loss::focalIntegerGamma(2.0), 2);
+    EXPECT_EQ(loss::focalIntegerGamma(0.0), 0);
+    EXPECT_EQ(loss::focalIntegerGamma(2.5), -1);
+    EXPECT_EQ(loss::focalIntegerGamma(-1.0), -1);
+}
+
+TEST_F(LossFunctionsTest, FocalIntegerGammaMatchesPowPath) {
+    const double alpha = 0.25;
+    std::vector<double> fastGradients(kRows * kCols);
+    std::vector<double> slowGradients(kRows * kCols);
+
+    for (double gamma : {0.0, 1.0, 2.0, 3.0, 5.0}) {
+        double fast = loss::focalLossBatch(ConstMatrixView<double>(outputs.data(), kRows, kCols),
+                                           ConstMatrixView<double>(targets.data(), kRows, kCols),
+                                           MatrixView<double>(fastGradients.data(), kRows, kCols),
+                                           alpha, gamma);
+
+        // Nudging gamma off the integer forces the std::pow path
+        double nudged = gamma + 1e-12;
+        double slow = loss::focalLossBatch(ConstMatrixView<double>(outputs.data(), kRows, kCols),
+                                           ConstMatrixView<double>(targets.data(), kRows, kCols),
+                                           MatrixView<double>(slowGradients.data(), kRows, kCols),
+                                           alpha, nudged);
+
+        EXPECT_NEAR(fast, slow, 1e-9) << "gamma " << gamma;
+        for (std::size_t i = 0; i < fastGradients.size(); ++i) {
+            EXPECT_NEAR(fastGradients[i], slowGradients[i], 1e-9) << "gamma " << gamma;
+        }
+    }
+}
@@ -6,8 +6,12 @@
  */
 
 #include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include "core/LossFunctions.hpp"
 #include "core/NeuralNetwork.hpp"
 #include "core/Types.hpp"
+#include "utils/AllocationTracker.hpp"
 
 using namespace nnv::core;
 
@@ -141,6 +145,36 @@ TEST_F(NeuralNetworkTest, Evaluate) {
     EXPECT_LE(result.second, 1.0f);  // Accuracy should be <= 1
 }
 
+TEST_F(NeuralNetworkTest, EvaluateMatchesPerSampleLoss) {
+    std::vector<std::vector<float>> inputs = {
+        {0.0f, 0.0f},
+        {0.0f, 1.0f},
+        {1.0f, 0.0f},
+        {1.0f, 1.0f}
+    };
+    
+    std::vector<std::vector<float>> targets = {
+        {0.0f},
+        {1.0f},
+        {1.0f},
+        {0.0f}
+    };
+    
+    for (auto lossType : {LossType::MeanSquaredError, LossType::BinaryCrossEntropy, LossType::Huber}) {
+        network->setLossType(lossType);
+        const auto loss = LossFactory::getFunction<float>(lossType);
+        
+        float expected = 0.0f;
+        for (std::size_t i = 0; i < inputs.size(); ++i) {
+            expected += loss(network->predict(inputs[i]), targets[i]);
+        }
+        expected /= static_cast<float>(inputs.size());
+        
+        EXPECT_NEAR(network->evaluate(inputs, targets).first, expected, 1e-5f)
+            << static_cast<int>(lossType);
+    }
+}
+
 TEST_F(NeuralNetworkTest, PredictBatch) {
     std::vector<std::vector<float>> inputs = {
         {0.0f, 0.0f},
@@ -202,3 +236,222 @@ TEST_F(NeuralNetworkTest, JsonSerialization) {
     EXPECT_FLOAT_EQ(newNetwork->getLearningRate(), 0.123f);
     EXPECT_EQ(newNetwork->getLayerCount(), 3);
 }
+
+TEST_F(NeuralNetworkTest, SnapshotIsUnaffectedByTraining) {
+    std::vector<float> inputs = {0.5f, -0.3f};
+    std::vector<float> targets = {0.8f};
+
+    auto before = network->predict(inputs);
+    auto snapshot = network->snapshot();
+
+    EXPECT_EQ(snapshot->getLayerCount(), network->getLayerCount());
+    EXPECT_EQ(snapshot->getLayer(1).getWeightData(), network->getLayer(1).getWeightData());
+
+    for (int i = 0; i < 10; ++i) {
+        network->trainSample(inputs, targets);
+    }
+
+    EXPECT_NE(snapshot->getLayer(1).getWeightData(), network->getLayer(1).getWeightData());
+    EXPECT_NE(network->predict(inputs)[0], before[0]);
+
+    NeuralNetwork<float> restored("Restored");
+    restored.fromJson(snapshot->toJson());
+    EXPECT_FLOAT_EQ(restored.predict(inputs)[0], before[0]);
+}
+
+TEST_F(NeuralNetworkTest, CloneTrainsIndependently) {
+    auto copy = network->clone();
+    EXPECT_FLOAT_EQ(copy->getLearningRate(), network->getLearningRate());
+
+    std::vector<float> inputs = {1.0f, 0.0f};
+    auto before = network->predict(inputs);
+    copy->trainSample(inputs, {0.0f});
+
+    EXPECT_FLOAT_EQ(network->predict(inputs)[0], before[0]);
+    EXPECT_FALSE(network->getLayer(2).hasSharedParameters());
+}
+
+TEST_F(NeuralNetworkTest, PublishesWeightsEveryInterval) {
+    EXPECT_FALSE(network->getPublishedWeights());
+
+    network->enableWeightPublishing(2);
+    auto initial = network->getPublishedWeights();
+    ASSERT_TRUE(initial);
+    EXPECT_EQ(initial.version(), 1u);
+
+    const float weight = network->getLayer(1).getWeightData()[0];
+    std::vector<float> inputs = {0.5f, -0.3f};
+    for (int i = 0; i < 4; ++i) {
+        network->trainSample(inputs, {1.0f});
+    }
+
+    auto latest = network->getPublishedWeights();
+    EXPECT_EQ(latest.version(), 3u);
+    EXPECT_FLOAT_EQ(latest->getLayer(1).getWeightData()[0], network->getLayer(1).getWeightData()[0]);
+    EXPECT_FLOAT_EQ(initial->getLayer(1).getWeightData()[0], weight);
+
+    // Readers run inference on the pinned version directly
+    std::vector<float> outputs;
+    std::vector<float> scratch;
+    ASSERT_TRUE(latest->predict(inputs, outputs, scratch));
+    ASSERT_EQ(outputs.size(), 1u);
+    EXPECT_FLOAT_EQ(outputs[0], network->predict(inputs)[0]);
+    EXPECT_FALSE(latest->predict({1.0f}, outputs, scratch));
+
+    initial = {};
+    latest = {};
+    network->disableWeightPublishing();
+    EXPECT_FALSE(network->getPublishedWeights());
+}
+
+TEST(NeuralNetworkConstTest, ConstPredictMatchesPredict) {
+    NetworkConfig config;
+    for (auto [size, activation] : {std::pair{4u, ActivationType::None}, {5u, ActivationType::Tanh},
+                                    {6u, ActivationType::ReLU}, {3u, ActivationType::Softmax}}) {
+        LayerConfig layer;
+        layer.size = size;
+        layer.activation = activation;
+        config.layers.push_back(layer);
+    }
+    NeuralNetwork<float> network(config);
+    network.initializeWeights();
+
+    const std::vector<float> inputs = {0.2f, -0.7f, 0.4f, 1.0f};
+    std::vector<float> outputs;
+    std::vector<float> scratch;
+    ASSERT_TRUE(network.predict(inputs, outputs, scratch));
+
+    const auto expected = network.predict(inputs);
+    ASSERT_EQ(outputs.size(), expected.size());
+    for (std::size_t i = 0; i < outputs.size(); ++i) {
+        EXPECT_FLOAT_EQ(outputs[i], expected[i]);
+    }
+}
+
+TEST_F(NeuralNetworkTest, TrainAsyncCompletes) {
+    std::vector<std::vector<float>> inputs = {{0.0f, 0.0f}, {0.0f, 1.0f}, {1.0f, 0.0f}, {1.0f, 1.0f}};
+    std::vector<std::vector<float>> targets = {{0.0f}, {1.0f}, {1.0f}, {0.0f}};
+
+    auto future = network->trainAsync(inputs, targets, 5, 2);
+    auto history = future.get();
+
+    EXPECT_EQ(history.trainLoss.size(), 5u);
+    EXPECT_FALSE(network->isTraining());
+    EXPECT_FLOAT_EQ(network->getTrainingProgress(), 1.0f);
+}
+
+TEST_F(NeuralNetworkTest, CancelWakesPausedTraining) {
+    std::vector<std::vector<float>> inputs = {{0.0f, 1.0f}, {1.0f, 0.0f}};
+    std::vector<std::vector<float>> targets = {{1.0f}, {1.0f}};
+
+    nnv::utils::CancellationToken token;
+    network->pauseTraining();
+    auto future = network->trainAsync(inputs, targets, 100, 1, token);
+
+    EXPECT_TRUE(network->isTraining());
+    EXPECT_TRUE(network->isPaused());
+
+    // A second run is rejected while the first is active
+    auto rejected = network->trainAsync(inputs, targets, 1);
+    EXPECT_TRUE(rejected.get().trainLoss.empty());
+
+    token.cancel();
+    auto history = future.get();
+
+    EXPECT_TRUE(history.trainLoss.empty());
+    network->waitForTraining();
+    EXPECT_FALSE(network->isTraining());
+    EXPECT_FALSE(network->isPaused());
+}
+
+TEST_F(NeuralNetworkTest, ResumeContinuesPausedTraining) {
+    std::vector<std::vector<float>> inputs = {{0.0f, 1.0f}, {1.0f, 0.0f}};
+    std::vector<std::vector<float>> targets = {{1.0f}, {1.0f}};
+
+    network->pauseTraining();
+    auto future = network->trainAsync(inputs, targets, 3, 1);
+    network->resumeTraining();
+
+    EXPECT_EQ(future.get().trainLoss.size(), 3u);
+}
+
+TEST_F(NeuralNetworkTest, StreamsBatchMetricsToSubscribers) {
+    std::vector<std::vector<float>> inputs = {{0.0f, 0.0f}, {0.0f, 1.0f}, {1.0f, 0.0f}, {1.0f, 1.0f}};
+    std::vector<std::vector<float>> targets = {{0.0f}, {1.0f}, {1.0f}, {0.0f}};
+
+    auto stream = network->subscribeBatchMetrics(16);
+    auto small = network->subscribeBatchMetrics(2);
+
+    network->trainBatch(inputs, targets);
+    network->trainBatch(inputs, targets);
+    network->trainBatch(inputs, targets);
+
+    std::vector<BatchMetrics> records;
+    EXPECT_EQ(stream->drain(records), 3u);
+    EXPECT_EQ(stream->getDroppedCount(), 0u);
+    EXPECT_EQ(records[2].step, 12u);
+    EXPECT_EQ(records[0].batchSize, 4u);
+    EXPECT_GE(records[0].accuracy, 0.0);
+    EXPECT_LE(records[0].accuracy, 1.0);
+    EXPECT_FLOAT_EQ(static_cast<float>(records[0].learningRate), 0.01f);
+    EXPECT_TRUE(std::isnan(records[0].gradientNorm));
+
+    // A slow consumer loses the newest records, not the training step
+    EXPECT_EQ(small->getDroppedCount(), 1u);
+
+    network->enableStepMetrics();
+    network->unsubscribeBatchMetrics(small);
+    network->trainBatch(inputs, targets);
+
+    BatchMetrics record;
+    ASSERT_TRUE(stream->poll(record));
+    EXPECT_GT(record.gradientNorm, 0.0);
+    EXPECT_EQ(small->getDroppedCount(), 1u);
+}
+
+TEST_F(NeuralNetworkTest, BatchMetricsReachSubscribersDuringSubscriptionChanges) {
+    std::vector<std::vector<float>> inputs = {{0.0f, 1.0f}, {1.0f, 0.0f}};
+    std::vector<std::vector<float>> targets = {{1.0f}, {1.0f}};
+    constexpr std::size_t kBatches = 100;
+
+    auto stream = network->subscribeBatchMetrics(kBatches);
+    std::atomic<bool> done{false};
+    std::thread churn([&] {
+        while (!done.load()) {
+            network->unsubscribeBatchMetrics(network->subscribeBatchMetrics(1));
+        }
+    });
+
+    for (std::size_t i = 0; i < kBatches; ++i) {
+        // Let the other thread run, so some batches end while it is mid-update
+        std::this_thread::yield();
+        network->trainBatch(inputs, targets);
+    }
+    done.store(true);
+    churn.join();
+
+    // No record is skipped while another thread holds the subscriber lock
+    std::vector<BatchMetrics> records;
+    EXPECT_EQ(stream->drain(records), kBatches);
+    EXPECT_EQ(stream->getDroppedCount(), 0u);
+}
+
+TEST_F(NeuralNetworkTest, SteadyStateTrainingStepDoesNotAllocate) {
+    ASSERT_TRUE(nnv::utils::AllocationTracker::isAvailable());
+    network->enablePerfStats();
+    
+    std::vector<std::vector<float>> inputs = {{0.0f, 1.0f}, {1.0f, 0.0f}, {1.0f, 1.0f}, {0.0f, 0.0f}};
+    std::vector<std::vector<float>> targets = {{1.0f}, {1.0f}, {0.0f}, {0.0f}};
+    
+    // The first step sizes scratch buffers and statistics
+    network->trainBatch(inputs, targets);
+    network->trainSample(inputs[0], targets[0]);
+    
+    nnv::utils::AllocationProbe probe;
+    for (int step = 0; step < 10; ++step) {
+        network->trainBatch(inputs, targets);
+        network->trainSample(inputs[1], targets[1]);
+    }
+    EXPECT_EQ(probe.counts().allocations, 0u);
+    EXPECT_DOUBLE_EQ(network->getPerfStats().allocationsPerStep(), 0.0);
+}
@@ -0,0 +1,167 @@
+/**
+ * @file test_perf_stats.cpp
+ * @brief Unit tests for training performance statistics
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#include <gtest/gtest.h>
+#include "core/PerfStats.hpp"
+#include "core/NeuralNetwork.hpp"
+#include "utils/MetricsServer.hpp"
+
+using namespace nnv::core;
+
+TEST(PerfStatsTest, HistogramBucketsAndPercentiles) {
+    TimingHistogram histogram;
+    for (std::uint64_t i = 1; i <= 1000; ++i) {
+        histogram.record(i * 100);
+    }
+
+    EXPECT_EQ(histogram.count, 1000u);
+    EXPECT_EQ(histogram.minNanos, 100u);
+    EXPECT_EQ(histogram.maxNanos, 100000u);
+    EXPECT_DOUBLE_EQ(histogram.meanNanos(), 50050.0);
+
+    // Log2 buckets: percentiles are accurate to within a factor of two
+    const double p50 = histogram.percentileNanos(0.5);
+    EXPECT_GE(p50, 25000.0);
+    EXPECT_LE(p50, 100000.0);
+    EXPECT_LE(histogram.percentileNanos(0.99), 100000.0);
+    EXPECT_GE(histogram.percentileNanos(0.0), 100.0);
+}
+
+TEST(PerfStatsTest, HistogramMergeAndClear) {
+    TimingHistogram a;
+    TimingHistogram b;
+    a.record(10);
+    b.record(1000);
+    b.record(0);
+
+    a.merge(b);
+    EXPECT_EQ(a.count, 3u);
+    EXPECT_EQ(a.totalNanos, 1010u);
+    EXPECT_EQ(a.minNanos, 0u);
+    EXPECT_EQ(a.maxNanos, 1000u);
+
+    a.clear();
+    EXPECT_EQ(a.count, 0u);
+    EXPECT_DOUBLE_EQ(a.percentileNanos(0.5), 0.0);
+}
+
+TEST(PerfStatsTest, NetworkRecordsPhasesAndLayers) {
+    NetworkConfig config;
+    for (LayerSize size : {8u, 32u, 4u}) {
+        LayerConfig layerConfig;
+        layerConfig.size = size;
+        layerConfig.activation = ActivationType::Sigmoid;
+        config.layers.push_back(layerConfig);
+    }
+
+    NeuralNetwork<float> network(config);
+    std::vector<std::vector<float>> inputs(16, std::vector<float>(8, 0.5f));
+    std::vector<std::vector<float>> targets(16, std::vector<float>(4, 1.0f));
+
+    network.trainBatch(inputs, targets);
+    EXPECT_EQ(network.getPerfStats().samples, 0u); // Disabled by default
+
+    network.enablePerfStats();
+    network.train(inputs, targets, 2, 8);
+
+    auto stats = network.getPerfStats();
+    EXPECT_EQ(stats.samples, 32u);
+    EXPECT_EQ(stats.steps.count, 4u);
+    EXPECT_GT(stats.samplesPerSecond(), 0.0);
+    EXPECT_EQ(stats.phase(TrainingPhase::DataFetch).count, 2u);
+    EXPECT_EQ(stats.phase(TrainingPhase::Update).count, 32u);
+    // Evaluation passes between epochs are not timed
+    EXPECT_EQ(stats.phase(TrainingPhase::Forward).count, 32u);
+
+    ASSERT_EQ(stats.layers.size(), 3u);
+    EXPECT_EQ(stats.layers[0].forward.count, 0u);
+    EXPECT_EQ(stats.layers[1].forward.count, 32u);
+    EXPECT_EQ(stats.layers[1].backward.count, 32u);
+    EXPECT_EQ(stats.layers[2].backward.count, 0u); // Output deltas come from the loss
+    EXPECT_DOUBLE_EQ(stats.layers[1].forwardFlops, 32.0 * 2 * 8 * 32);
+    EXPECT_GT(stats.layers[1].totalGflops(), 0.0);
+    EXPECT_FALSE(stats.toString().empty());
+
+    network.resetPerfStats();
+    EXPECT_EQ(network.getPerfStats().samples, 0u);
+}
+
+TEST(PerfStatsTest, HardwareCountersDegradeGracefully) {
+    NetworkConfig config;
+    for (LayerSize size : {8u, 16u, 4u}) {
+        LayerConfig layerConfig;
+        layerConfig.size = size;
+        config.layers.push_back(layerConfig);
+    }
+
+    NeuralNetwork<float> network(config);
+    std::vector<std::vector<float>> inputs(8, std::vector<float>(8, 0.5f));
+    std::vector<std::vector<float>> targets(8, std::vector<float>(4, 1.0f));
+
+    const bool available = network.enableHardwareCounters();
+    EXPECT_EQ(network.isHardwareCountersEnabled(), available);
+    if (!available) {
+        network.enablePerfStats();
+    }
+    network.trainBatch(inputs, targets);
+
+    const auto stats = network.getPerfStats();
+    EXPECT_EQ(stats.samples, 8u);
+    EXPECT_EQ(stats.hardwareCounters, available);
+    EXPECT_FALSE(stats.toString().empty());
+    if (available) {
+        EXPECT_TRUE(stats.layers[1].forwardCounters.isValid(nnv::utils::HardwareCounter::Instructions));
+        EXPECT_GT(stats.layers[1].forwardCounters[nnv::utils::HardwareCounter::Instructions], 0u);
+        EXPECT_GT(stats.layers[1].forwardCounters.ipc(), 0.0);
+    } else {
+        EXPECT_EQ(stats.layers[1].forwardCounters.validMask, 0u);
+    }
+
+    EXPECT_TRUE(network.enableHardwareCounters(false));
+    EXPECT_FALSE(network.isHardwareCountersEnabled());
+}
+
+TEST(PerfStatsTest, NetworkWritesPrometheusMetrics) {
+    NetworkConfig config;
+    config.name = "net \"a\"";
+    for (LayerSize size : {4u, 8u, 2u}) {
+        LayerConfig layerConfig;
+        layerConfig.size = size;
+        config.layers.push_back(layerConfig);
+    }
+
+    NeuralNetwork<float> network(config);
+    std::vector<std::vector<float>> inputs(8, std::vector<float>(4, 0.5f));
+    std::vector<std::vector<float>> targets(8, std::vector<float>(2, 1.0f));
+
+    network.enablePerfStats();
+    auto stream = network.subscribeBatchMetrics(16);
+    network.trainBatch(inputs, targets);
+    network.trainBatch(inputs, targets);
+
+    nnv::utils::MetricsWriter writer;
+    network.writeMetrics(writer);
+    const std::string text = writer.str();
+
+    const std::string model = "model=\"net \\\"a\\\"\"";
+    EXPECT_NE(text.find("# TYPE nnv_training_samples_total counter\nnnv_training_samples_total{" + model + "} 16\n"),
+              std::string::npos) << text;
+    EXPECT_NE(text.find("nnv_training_batches_total{" + model + "} 2\n"), std::string::npos);
+    EXPECT_NE(text.find("nnv_training_step_seconds{" + model + ",quantile=\"0.99\"}"), std::string::npos);
+    EXPECT_NE(text.find("nnv_training_step_seconds_count{" + model + "} 2\n"), std::string::npos);
+    EXPECT_NE(text.find("nnv_training_phase_seconds_count{" + model + ",phase=\"update\"} 16\n"),
+              std::string::npos);
+    EXPECT_NE(text.find("nnv_batch_metrics_queue_depth{" + model + ",subscriber=\"0\"} 2\n"),
+              std::string::npos);
+    EXPECT_NE(text.find("nnv_model_memory_bytes{" + model + ",category=\"weights\"}"), std::string::npos);
+
+    // Memory comes from the snapshot the last training step published
+    const auto memory = network.memoryUsage().total();
+    EXPECT_GT(memory.activations, 0u);
+    EXPECT_NE(text.find("nnv_model_memory_bytes{" + model + ",category=\"activations\"} " +
+                        std::to_string(memory.activations) + "\n"), std::string::npos) << text;
+}
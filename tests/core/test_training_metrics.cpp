@@ -0,0 +1,128 @@
+/**
+ * @file test_training_metrics.cpp
+ * @brief Unit tests for per-step gradient and update telemetry
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <limits>
+#include "core/TrainingMetrics.hpp"
+#include "core/NeuralNetwork.hpp"
+#include "core/Types.hpp"
+
+using namespace nnv::core;
+
+class TrainingMetricsTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        NetworkConfig config;
+        config.name = "Metrics Test";
+        config.training.learning_rate = 0.1;
+
+        LayerConfig inputLayer;
+        inputLayer.size = 3;
+        inputLayer.activation = ActivationType::None;
+        config.layers.push_back(inputLayer);
+
+        LayerConfig hidden;
+        hidden.size = 4;
+        hidden.activation = ActivationType::Tanh;
+        config.layers.push_back(hidden);
+
+        LayerConfig outputLayer;
+        outputLayer.size = 2;
+        outputLayer.activation = ActivationType::Sigmoid;
+        config.layers.push_back(outputLayer);
+
+        network = std::make_unique<NeuralNetwork<double>>(config);
+    }
+
+    std::vector<double> inputs = {0.2, -0.4, 0.6};
+    std::vector<double> targets = {1.0, 0.0};
+    std::unique_ptr<NeuralNetwork<double>> network;
+};
+
+TEST_F(TrainingMetricsTest, DisabledByDefault) {
+    EXPECT_FALSE(network->isStepMetricsEnabled());
+    network->trainSample(inputs, targets);
+    EXPECT_TRUE(network->getLastStepMetrics().layers.empty());
+}
+
+TEST_F(TrainingMetricsTest, MatchesSeparateScan) {
+    network->enableStepMetrics();
+
+    // Expected values from a second pass over the pre-update state
+    auto outputs = network->forward(inputs);
+    std::vector<std::vector<std::vector<double>>> weightsBefore;
+    std::vector<std::vector<double>> biasesBefore;
+    for (std::size_t l = 0; l < network->getLayerCount(); ++l) {
+        weightsBefore.push_back(network->getLayer(l).getWeightMatrix());
+        std::vector<double> biases;
+        for (std::size_t k = 0; k < network->getLayer(l).getSize(); ++k) {
+            biases.push_back(network->getLayer(l).getNeuron(k).getBias());
+        }
+        biasesBefore.push_back(biases);
+    }
+
+    double loss = network->backward(targets, outputs);
+    auto metrics = network->getLastStepMetrics();
+
+    EXPECT_EQ(metrics.step, 1u);
+    EXPECT_DOUBLE_EQ(metrics.loss, loss);
+    ASSERT_EQ(metrics.layers.size(), network->getLayerCount());
+    EXPECT_EQ(metrics.layers[0].parameterCount, 0u);
+
+    const double learningRate = network->getLearningRate();
+    for (std::size_t l = 1; l < network->getLayerCount(); ++l) {
+        const auto& layer = network->getLayer(l);
+        auto prevActivations = network->getLayer(l - 1).getActivations();
+
+        double gradSq = 0.0;
+        double weightSq = 0.0;
+        for (std::size_t k = 0; k < layer.getSize(); ++k) {
+            double delta = layer.getNeuron(k).getDelta();
+            for (std::size_t i = 0; i < prevActivations.size(); ++i) {
+                double grad = delta * prevActivations[i];
+                gradSq += grad * grad;
+                weightSq += weightsBefore[l][k][i] * weightsBefore[l][k][i];
+            }
+            gradSq += delta * delta;
+            weightSq += biasesBefore[l][k] * biasesBefore[l][k];
+        }
+
+        const auto& m = metrics.layers[l];
+        EXPECT_NEAR(m.gradientNorm(), std::sqrt(gradSq), 1e-12);
+        EXPECT_NEAR(m.updateRatio(), learningRate * std::sqrt(gradSq / weightSq), 1e-12);
+        EXPECT_EQ(m.nonFiniteCount, 0u);
+        EXPECT_EQ(m.parameterCount, layer.getSize() * (prevActivations.size() + 1));
+    }
+}
+
+TEST_F(TrainingMetricsTest, CallbackSeesEveryStep) {
+    network->enableStepMetrics();
+
+    std::vector<std::uint64_t> steps;
+    network->setStepMetricsCallback([&steps](const StepMetrics& metrics) {
+        steps.push_back(metrics.step);
+        EXPECT_GT(metrics.gradientNorm(), 0.0);
+    });
+
+    for (int i = 0; i < 3; ++i) {
+        network->trainSample(inputs, targets);
+    }
+
+    EXPECT_EQ(steps, (std::vector<std::uint64_t>{1, 2, 3}));
+}
+
+TEST_F(TrainingMetricsTest, DetectsNonFiniteGradients) {
+    network->enableStepMetrics();
+
+    std::vector<double> badTargets = {std::numeric_limits<double>::quiet_NaN(), 0.0};
+    network->trainSample(inputs, badTargets);
+
+    auto metrics = network->getLastStepMetrics();
+    EXPECT_GT(metrics.nonFiniteCount(), 0u);
+    EXPECT_GT(metrics.layers.back().nonFiniteCount, 0u);
+}
@@ -0,0 +1,76 @@
+/**
+ * @file test_allocation_budgets.cpp
+ * @brief Heap allocation budgets of the per-frame render and animation paths
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+#include "core/NeuralNetwork.hpp"
+#include "graphics/AnimationSystem.hpp"
+#include "graphics/FrameBuilder.hpp"
+#include "utils/AllocationTracker.hpp"
+
+using namespace nnv;
+
+namespace {
+
+std::unique_ptr<core::DefaultNetwork> makeNetwork() {
+    auto network = std::make_unique<core::DefaultNetwork>("Budget");
+    for (int size : {16, 32, 8}) {
+        core::LayerConfig config;
+        config.size = static_cast<core::LayerSize>(size);
+        config.activation = network->getLayerCount() == 0 ? core::ActivationType::None : core::ActivationType::Sigmoid;
+        network->addLayer(config);
+    }
+    network->initializeWeights();
+    network->predict(std::vector<core::Scalar>(16, 0.5f));
+    return network;
+}
+
+} // namespace
+
+TEST(AllocationBudgetTest, SteadyStateFrameBuildDoesNotAllocate) {
+    ASSERT_TRUE(utils::AllocationTracker::isAvailable());
+    const auto network = makeNetwork();
+    const graphics::RenderConfig config;
+    graphics::Viewport viewport;
+    viewport.bounds = sf::FloatRect(0.0f, 0.0f, 1920.0f, 1080.0f);
+    viewport.center = sf::Vector2f(960.0f, 540.0f);
+
+    graphics::FrameBuilder builder(config);
+    const auto& first = builder.build(*network, viewport);
+    EXPECT_GT(first.stats.allocations.allocations, 0u);
+
+    utils::AllocationProbe probe;
+    for (int frame = 0; frame < 10; ++frame) {
+        const auto& geometry = builder.build(*network, viewport);
+        EXPECT_EQ(geometry.stats.allocations.allocations, 0u);
+    }
+    EXPECT_EQ(probe.counts().allocations, 0u);
+}
+
+TEST(AllocationBudgetTest, AnimationUpdateDoesNotAllocate) {
+    graphics::AnimationConfig config;
+    graphics::AnimationSystem animations(config);
+
+    std::vector<float> values(64, 0.0f);
+    for (auto& value : values) {
+        animations.animateFloat(value, 1.0f, 10.0f);
+    }
+
+    utils::AllocationProbe probe;
+    for (int frame = 0; frame < 60; ++frame) {
+        animations.update(1.0f / 60.0f);
+    }
+    EXPECT_EQ(probe.counts().allocations, 0u);
+    EXPECT_EQ(animations.getActiveAnimationCount(), values.size());
+
+    // Finishing animations only frees memory
+    probe.reset();
+    animations.update(20.0f);
+    EXPECT_EQ(probe.counts().allocations, 0u);
+    EXPECT_EQ(animations.getActiveAnimationCount(), 0u);
+}
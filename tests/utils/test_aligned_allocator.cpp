@@ -0,0 +1,49 @@
+/**
+ * @file test_aligned_allocator.cpp
+ * @brief Unit tests for the aligned allocator and memory tracker
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include "utils/AlignedAllocator.hpp"
+
+using namespace nnv::utils;
+
+TEST(AlignedAllocatorTest, BuffersAreCacheLineAligned) {
+    for (std::size_t n : {1u, 3u, 17u, 1000u}) {
+        AlignedVector<float, MemoryCategory::Workspace> buffer(n, 1.0f);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(buffer.data()) % kBufferAlignment, 0u) << n;
+    }
+}
+
+TEST(AlignedAllocatorTest, LargeBuffersAreHugePageAligned) {
+    ASSERT_TRUE(MemoryTracker::areHugePagesEnabled());
+
+    AlignedVector<double, MemoryCategory::Weights> buffer(kHugePageSize / sizeof(double));
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(buffer.data()) % kHugePageSize, 0u);
+}
+
+TEST(AlignedAllocatorTest, TracksBytesPerCategory) {
+    const std::size_t before = MemoryTracker::getAllocatedBytes(MemoryCategory::OptimizerState);
+    const std::size_t otherBefore = MemoryTracker::getAllocatedBytes(MemoryCategory::Activations);
+
+    {
+        AlignedVector<float, MemoryCategory::OptimizerState> buffer;
+        buffer.reserve(256);
+
+        EXPECT_EQ(MemoryTracker::getAllocatedBytes(MemoryCategory::OptimizerState),
+                  before + 256 * sizeof(float));
+        EXPECT_GE(MemoryTracker::getPeakBytes(MemoryCategory::OptimizerState),
+                  before + 256 * sizeof(float));
+        EXPECT_EQ(MemoryTracker::getAllocatedBytes(MemoryCategory::Activations), otherBefore);
+    }
+
+    EXPECT_EQ(MemoryTracker::getAllocatedBytes(MemoryCategory::OptimizerState), before);
+}
+
+TEST(AlignedAllocatorTest, CategoryNames) {
+    EXPECT_STREQ(MemoryTracker::getCategoryName(MemoryCategory::Weights), "weights");
+    EXPECT_STREQ(MemoryTracker::getCategoryName(MemoryCategory::Workspace), "workspace");
+}
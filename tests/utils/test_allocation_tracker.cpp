@@ -0,0 +1,117 @@
+/**
+ * @file test_allocation_tracker.cpp
+ * @brief Unit tests for heap allocation counting
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "utils/AllocationTracker.hpp"
+
+using namespace nnv::utils;
+
+namespace {
+
+struct alignas(128) OverAligned {
+    char data[128];
+};
+
+// Escapes pointers so the compiler cannot elide the new/delete pairs
+void* volatile g_sink = nullptr;
+
+template<typename P>
+void keep(const P& pointer) {
+    g_sink = static_cast<void*>(&*pointer);
+}
+
+} // namespace
+
+TEST(AllocationTrackerTest, HooksAreLinkedIntoTests) {
+    EXPECT_TRUE(AllocationTracker::isAvailable());
+}
+
+TEST(AllocationTrackerTest, CountsNewAndDelete) {
+    AllocationProbe probe;
+    auto value = std::make_unique<std::uint64_t>(1);
+    std::vector<int> values(100);
+    auto aligned = std::make_unique<OverAligned>();
+    keep(value);
+    keep(values.begin());
+    keep(aligned);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(aligned.get()) % alignof(OverAligned), 0u);
+
+    AllocationCounts counts = probe.counts();
+    EXPECT_EQ(counts.allocations, 3u);
+    EXPECT_EQ(counts.deallocations, 0u);
+    EXPECT_EQ(counts.bytes, sizeof(std::uint64_t) + 100 * sizeof(int) + sizeof(OverAligned));
+
+    value.reset();
+    std::vector<int>().swap(values);
+    aligned.reset();
+    counts = probe.counts();
+    EXPECT_EQ(counts.deallocations, 3u);
+
+    probe.reset();
+    EXPECT_EQ(probe.counts().allocations, 0u);
+}
+
+TEST(AllocationTrackerTest, ScopesChargeTheInnermostTag) {
+    const AllocationCounts trainingBefore = AllocationTracker::totalCounts(AllocationTag::Training);
+    const AllocationCounts renderingBefore = AllocationTracker::totalCounts(AllocationTag::Rendering);
+    EXPECT_EQ(AllocationTracker::currentTag(), AllocationTag::Untagged);
+
+    {
+        NNV_ALLOCATION_SCOPE(Training);
+        auto first = std::make_unique<int>(1);
+        keep(first);
+        {
+            NNV_ALLOCATION_SCOPE(Rendering);
+            EXPECT_EQ(AllocationTracker::currentTag(), AllocationTag::Rendering);
+            auto second = std::make_unique<int>(2);
+            auto third = std::make_unique<int>(3);
+            keep(second);
+            keep(third);
+        }
+        EXPECT_EQ(AllocationTracker::currentTag(), AllocationTag::Training);
+    }
+    EXPECT_EQ(AllocationTracker::currentTag(), AllocationTag::Untagged);
+
+    const AllocationCounts training = AllocationTracker::totalCounts(AllocationTag::Training) - trainingBefore;
+    const AllocationCounts rendering = AllocationTracker::totalCounts(AllocationTag::Rendering) - renderingBefore;
+    EXPECT_EQ(training.allocations, 1u);
+    EXPECT_EQ(training.deallocations, 1u);
+    EXPECT_EQ(rendering.allocations, 2u);
+    EXPECT_EQ(rendering.deallocations, 2u);
+    EXPECT_EQ(rendering.bytes, 2 * sizeof(int));
+}
+
+TEST(AllocationTrackerTest, ThreadsHaveSeparateCountersAndTotalsIncludeThem) {
+    const AllocationCounts before = AllocationTracker::totalCounts(AllocationTag::DataLoading);
+    AllocationProbe probe;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([]() {
+            NNV_ALLOCATION_SCOPE(DataLoading);
+            AllocationProbe threadProbe;
+            for (int i = 0; i < 1000; ++i) {
+                auto value = std::make_unique<int>(i);
+                keep(value);
+            }
+            EXPECT_EQ(threadProbe.counts().allocations, 1000u);
+        });
+    }
+    const AllocationCounts spawned = probe.counts();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Only std::thread bookkeeping is charged to this thread
+    EXPECT_EQ(probe.counts().allocations, spawned.allocations);
+    const AllocationCounts loading = AllocationTracker::totalCounts(AllocationTag::DataLoading) - before;
+    EXPECT_EQ(loading.allocations, 4000u);
+    EXPECT_EQ(loading.deallocations, 4000u);
+}
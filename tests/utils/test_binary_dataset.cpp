@@ -0,0 +1,188 @@
+/**
+ * @file test_binary_dataset.cpp
+ * @brief Unit tests for the memory-mapped .nnvd dataset format
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "utils/AllocationTracker.hpp"
+#include "utils/BinaryDataset.hpp"
+#include "utils/DataLoader.hpp"
+
+using namespace nnv::utils;
+
+namespace {
+
+/**
+ * @brief Provides a scratch dataset path that is removed afterwards
+ */
+class BinaryDatasetTest : public ::testing::Test {
+protected:
+    std::string path_;
+
+    void SetUp() override {
+        path_ = (std::filesystem::temp_directory_path() /
+                 ("nnv_test_dataset_" + std::to_string(::testing::UnitTest::GetInstance()->random_seed()) + ".nnvd"))
+                    .string();
+        std::remove(path_.c_str());
+    }
+
+    void TearDown() override {
+        std::remove(path_.c_str());
+    }
+
+    static Dataset<float> makeDataset(std::size_t samples) {
+        Dataset<float> dataset;
+        for (std::size_t i = 0; i < samples; ++i) {
+            dataset.inputs.push_back({static_cast<float>(i % 4) / 4.0f, 0.5f, 1.0f});
+            dataset.targets.push_back({static_cast<float>(i % 2)});
+        }
+        dataset.labelMap = {{"even", 0}, {"odd", 1}};
+        return dataset;
+    }
+};
+
+} // namespace
+
+TEST_F(BinaryDatasetTest, RoundTripsEveryElementType) {
+    const auto dataset = makeDataset(10);
+
+    for (auto type : {DatasetElementType::Float32, DatasetElementType::Float16, DatasetElementType::UInt8}) {
+        BinaryDatasetOptions options;
+        options.inputType = type;
+        options.targetType = type;
+        options.inputScale = 1.0f / 4.0f;
+        ASSERT_TRUE(writeBinaryDataset(dataset, path_, options)) << getDatasetElementTypeName(type);
+
+        MappedDataset mapped;
+        ASSERT_TRUE(mapped.open(path_));
+        EXPECT_EQ(mapped.size(), 10u);
+        EXPECT_EQ(mapped.getInputDim(), 3u);
+        EXPECT_EQ(mapped.getTargetDim(), 1u);
+        EXPECT_EQ(mapped.getInputType(), type);
+        EXPECT_EQ(mapped.getClassNames(), (std::vector<std::string>{"even", "odd"}));
+
+        // Each array starts on its own page
+        const auto base = reinterpret_cast<std::uintptr_t>(mapped.getRawInputs());
+        EXPECT_EQ(base % BinaryDatasetHeader::kArrayAlignment, 0u);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(mapped.getRawTargets()) % BinaryDatasetHeader::kArrayAlignment, 0u);
+
+        // Every test value is a multiple of 1/4, exact in all three types
+        const auto loaded = mapped.toDataset<float>();
+        EXPECT_EQ(loaded.inputs, dataset.inputs) << getDatasetElementTypeName(type);
+        EXPECT_EQ(loaded.targets, dataset.targets) << getDatasetElementTypeName(type);
+        EXPECT_EQ(loaded.labelMap, dataset.labelMap);
+        ASSERT_EQ(loaded.labels.size(), 10u);
+        EXPECT_EQ(loaded.labels[3], "odd");
+    }
+}
+
+TEST_F(BinaryDatasetTest, QuantizesToNearestRepresentableValue) {
+    Dataset<double> dataset;
+    dataset.inputs = {{0.1, -1.0, 2.0, 1.0 / 3.0}};
+    dataset.targets = {{65504.0 * 2.0}};
+
+    BinaryDatasetOptions options;
+    options.inputType = DatasetElementType::UInt8;
+    options.targetType = DatasetElementType::Float16;
+    ASSERT_TRUE(writeBinaryDataset(dataset, path_, options));
+
+    MappedDataset mapped;
+    ASSERT_TRUE(mapped.open(path_, DatasetAccess::Random));
+    std::vector<double> input(4);
+    double target = 0.0;
+    mapped.readInput(0, input.data());
+    mapped.readTarget(0, &target);
+
+    // u8 clamps to [0, 255] steps of 1/255; f16 overflows to infinity
+    EXPECT_NEAR(input[0], 0.1, 0.5 / 255.0);
+    EXPECT_EQ(input[1], 0.0);
+    EXPECT_NEAR(input[2], 1.0, 1e-6);
+    EXPECT_NEAR(input[3], 1.0 / 3.0, 0.5 / 255.0);
+    EXPECT_TRUE(std::isinf(target));
+}
+
+TEST_F(BinaryDatasetTest, DataLoaderReadsAndWritesNnvd) {
+    DataLoader<float> loader;
+    EXPECT_EQ(DataLoader<float>::detectFormat(path_), DataFormat::Binary);
+    ASSERT_TRUE(loader.saveToFile(makeDataset(6), path_, DataFormat::Binary));
+
+    PreprocessingConfig config;
+    config.normalize = false;
+    config.shuffle = false;
+    const auto dataset = loader.loadFromFile(path_, DataFormat::CSV, config);
+    ASSERT_EQ(dataset.size(), 6u);
+    EXPECT_EQ(dataset.inputs, makeDataset(6).inputs);
+    EXPECT_EQ(dataset.targets, makeDataset(6).targets);
+}
+
+TEST_F(BinaryDatasetTest, BatchReadsDoNotAllocateOnceSized) {
+    ASSERT_TRUE(writeBinaryDataset(makeDataset(64), path_));
+
+    MappedDataset mapped;
+    ASSERT_TRUE(mapped.open(path_, DatasetAccess::Random));
+
+    const std::size_t indices[] = {63, 0, 17, 42};
+    std::vector<std::vector<float>> inputs;
+    std::vector<std::vector<float>> targets;
+    mapped.readBatch(indices, 4, inputs, targets);
+    EXPECT_EQ(inputs[1], makeDataset(1).inputs[0]);
+    EXPECT_EQ(targets[0][0], 1.0f);
+
+    AllocationProbe probe;
+    for (int i = 0; i < 10; ++i) {
+        mapped.readBatch(indices, 4, inputs, targets);
+    }
+    if (AllocationTracker::isAvailable()) {
+        EXPECT_EQ(probe.counts().allocations, 0u);
+    }
+}
+
+TEST_F(BinaryDatasetTest, RejectsCorruptAndTruncatedFiles) {
+    MappedDataset mapped;
+    EXPECT_FALSE(mapped.open(path_));
+
+    {
+        std::ofstream file(path_, std::ios::binary);
+        file << "not a dataset";
+    }
+    EXPECT_FALSE(mapped.open(path_));
+    EXPECT_FALSE(mapped.isOpen());
+
+    ASSERT_TRUE(writeBinaryDataset(makeDataset(2000), path_));
+    std::filesystem::resize_file(path_, std::filesystem::file_size(path_) / 2);
+    EXPECT_FALSE(mapped.open(path_));
+
+    ASSERT_TRUE(writeBinaryDataset(makeDataset(4), path_));
+    {
+        std::fstream file(path_, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(0);
+        file.write("XXXX", 4);
+    }
+    EXPECT_FALSE(mapped.open(path_));
+
+    // An in-bounds but misaligned array offset is rejected
+    ASSERT_TRUE(writeBinaryDataset(makeDataset(4), path_));
+    {
+        std::fstream file(path_, std::ios::binary | std::ios::in | std::ios::out);
+        std::uint64_t inputOffset = 0;
+        file.seekg(offsetof(BinaryDatasetHeader, inputOffset));
+        file.read(reinterpret_cast<char*>(&inputOffset), sizeof(inputOffset));
+        inputOffset += 4;
+        file.seekp(offsetof(BinaryDatasetHeader, inputOffset));
+        file.write(reinterpret_cast<const char*>(&inputOffset), sizeof(inputOffset));
+    }
+    EXPECT_FALSE(mapped.open(path_));
+
+    DataLoader<float> loader;
+    EXPECT_TRUE(loader.loadBinary(path_).empty());
+}
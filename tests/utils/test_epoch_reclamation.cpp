@@ -0,0 +1,94 @@
+/**
+ * @file test_epoch_reclamation.cpp
+ * @brief Unit tests for epoch-based reclamation and RcuPointer
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include "utils/EpochReclamation.hpp"
+
+using namespace nnv::utils;
+
+namespace {
+
+struct Tracked {
+    explicit Tracked(int v, int* liveCount) : a(v), b(v), live(liveCount) { ++*live; }
+    ~Tracked() { --*live; }
+
+    int a;
+    int b;
+    int* live;
+};
+
+} // namespace
+
+TEST(EpochReclamationTest, ReadSeesLatestPublish) {
+    int live = 0;
+    {
+        RcuPointer<Tracked> pointer;
+        EXPECT_FALSE(pointer.read());
+
+        pointer.publish(std::make_unique<Tracked>(1, &live));
+        pointer.publish(std::make_unique<Tracked>(2, &live));
+
+        auto guard = pointer.read();
+        ASSERT_TRUE(guard);
+        EXPECT_EQ(guard->a, 2);
+        EXPECT_EQ(guard.version(), 2u);
+    }
+    EXPECT_EQ(live, 0);
+}
+
+TEST(EpochReclamationTest, PinnedVersionOutlivesPublish) {
+    int live = 0;
+    RcuPointer<Tracked> pointer;
+    pointer.publish(std::make_unique<Tracked>(1, &live));
+
+    auto guard = pointer.read();
+    pointer.publish(std::make_unique<Tracked>(2, &live));
+    pointer.publish(std::make_unique<Tracked>(3, &live));
+
+    EXPECT_EQ(guard->a, 1);
+    EXPECT_EQ(live, 3); // Versions 1 and 2 are retired but wait for the pinned reader
+    EXPECT_EQ(pointer.reclaim(), 2u);
+
+    guard = {};
+    EXPECT_EQ(pointer.reclaim(), 0u);
+    EXPECT_EQ(live, 1);
+}
+
+TEST(EpochReclamationTest, ConcurrentReadersSeeConsistentVersions) {
+    int live = 0;
+    RcuPointer<Tracked> pointer;
+    pointer.publish(std::make_unique<Tracked>(0, &live));
+
+    std::atomic<bool> done{false};
+    std::atomic<int> torn{0};
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 3; ++r) {
+        readers.emplace_back([&] {
+            while (!done.load()) {
+                auto guard = pointer.read();
+                if (guard->a != guard->b) {
+                    ++torn;
+                }
+            }
+        });
+    }
+
+    for (int i = 1; i <= 2000; ++i) {
+        pointer.publish(std::make_unique<Tracked>(i, &live));
+    }
+
+    done.store(true);
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    EXPECT_EQ(torn.load(), 0);
+    EXPECT_EQ(pointer.reclaim(), 0u);
+    EXPECT_EQ(live, 1);
+}
@@ -0,0 +1,229 @@
+/**
+ * @file test_event_log.cpp
+ * @brief Unit tests for the binary event log
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "utils/EventLog.hpp"
+
+using namespace nnv::utils;
+
+namespace {
+
+/**
+ * @brief Provides a scratch log path that is removed afterwards
+ */
+class EventLogTest : public ::testing::Test {
+protected:
+    std::string path_;
+
+    void SetUp() override {
+        path_ = (std::filesystem::temp_directory_path() /
+                 ("nnv_test_events_" + std::to_string(::testing::UnitTest::GetInstance()->random_seed()) + ".nnvlog"))
+                    .string();
+        std::remove(path_.c_str());
+    }
+
+    void TearDown() override {
+        std::remove(path_.c_str());
+    }
+
+    std::vector<EventRecord> readAll(bool* truncated = nullptr) const {
+        EventLogReader reader;
+        std::vector<EventRecord> records;
+        if (!reader.open(path_)) {
+            return records;
+        }
+        EventRecord record;
+        while (reader.next(record)) {
+            records.push_back(record);
+        }
+        if (truncated) {
+            *truncated = reader.isTruncated();
+        }
+        return records;
+    }
+};
+
+} // namespace
+
+TEST_F(EventLogTest, RoundTripsEveryEventType) {
+    EventLog log;
+    ASSERT_TRUE(log.open(path_));
+
+    StepEvent step;
+    step.step = 7;
+    step.samples = 32;
+    step.nanos = 1500;
+    step.loss = 0.25;
+    step.learningRate = 0.01;
+    step.gradientNorm = std::nan("");
+
+    EpochEvent epoch;
+    epoch.epoch = 2;
+    epoch.trainLoss = 0.5;
+
+    RunEndEvent end;
+    end.epochs = 3;
+    end.stopped = 1;
+
+    log.logRunStart("{\"epochs\":3}");
+    log.logStep(step);
+    log.logEpoch(epoch);
+    log.logCheckpoint(7, "model.json");
+    log.logTiming("eval", 2000, 4);
+    log.logMessage("hello");
+    log.logRunEnd(end);
+    EXPECT_EQ(log.getRecordCount(), 7u);
+
+    const auto size = log.getSize();
+    log.close();
+    EXPECT_FALSE(log.isOpen());
+    EXPECT_EQ(std::filesystem::file_size(path_), size);
+
+    bool truncated = true;
+    const auto records = readAll(&truncated);
+    EXPECT_FALSE(truncated);
+    ASSERT_EQ(records.size(), 7u);
+
+    EXPECT_EQ(records[0].type, EventType::RunStart);
+    EXPECT_EQ(records[0].text, "{\"epochs\":3}");
+
+    StepEvent readStep;
+    ASSERT_TRUE(records[1].get(readStep));
+    EXPECT_EQ(readStep.step, 7u);
+    EXPECT_EQ(readStep.samples, 32u);
+    EXPECT_EQ(readStep.nanos, 1500u);
+    EXPECT_DOUBLE_EQ(readStep.loss, 0.25);
+    EXPECT_TRUE(std::isnan(readStep.gradientNorm));
+
+    EpochEvent readEpoch;
+    ASSERT_TRUE(records[2].get(readEpoch));
+    EXPECT_EQ(readEpoch.epoch, 2u);
+
+    EXPECT_EQ(records[3].type, EventType::Checkpoint);
+    EXPECT_EQ(records[3].text, "model.json");
+
+    TimingEvent timing;
+    ASSERT_TRUE(records[4].get(timing));
+    EXPECT_EQ(records[4].text, "eval");
+    EXPECT_EQ(timing.count, 4u);
+
+    EXPECT_EQ(records[5].text, "hello");
+    EXPECT_FALSE(records[5].get(timing));
+
+    RunEndEvent readEnd;
+    ASSERT_TRUE(records[6].get(readEnd));
+    EXPECT_EQ(readEnd.epochs, 3u);
+    EXPECT_EQ(readEnd.stopped, 1u);
+
+    for (std::size_t i = 1; i < records.size(); ++i) {
+        EXPECT_GE(records[i].timestampNanos, records[i - 1].timestampNanos);
+    }
+}
+
+TEST_F(EventLogTest, GrowsPastInitialCapacity) {
+    EventLog log;
+    ASSERT_TRUE(log.open(path_, 4096));
+
+    constexpr std::uint64_t kSteps = 10000;
+    for (std::uint64_t i = 0; i < kSteps; ++i) {
+        StepEvent step;
+        step.step = i;
+        log.logStep(step);
+    }
+    log.close();
+
+    const auto records = readAll();
+    ASSERT_EQ(records.size(), kSteps);
+    StepEvent last;
+    records.back().get(last);
+    EXPECT_EQ(last.step, kSteps - 1);
+}
+
+TEST_F(EventLogTest, UnclosedLogIsReadableUpToLastRecord) {
+    {
+        EventLog log;
+        ASSERT_TRUE(log.open(path_, 8192));
+        log.logMessage("first");
+        log.logMessage("second");
+        log.flush();
+
+        // A reader sees the zero-filled reserve as the end of the log
+        EXPECT_GT(std::filesystem::file_size(path_), log.getSize());
+        bool truncated = true;
+        const auto records = readAll(&truncated);
+        EXPECT_FALSE(truncated);
+        ASSERT_EQ(records.size(), 2u);
+        EXPECT_EQ(records[1].text, "second");
+    }
+}
+
+TEST_F(EventLogTest, TornRecordIsReportedAsTruncated) {
+    {
+        EventLog log;
+        ASSERT_TRUE(log.open(path_));
+        log.logMessage("complete");
+        log.logMessage("cut short by a crash");
+    }
+
+    // Drop the tail of the last record
+    const auto size = std::filesystem::file_size(path_);
+    std::filesystem::resize_file(path_, size - 8);
+
+    bool truncated = false;
+    const auto records = readAll(&truncated);
+    EXPECT_TRUE(truncated);
+    ASSERT_EQ(records.size(), 1u);
+    EXPECT_EQ(records[0].text, "complete");
+}
+
+TEST_F(EventLogTest, RejectsOtherFiles) {
+    {
+        std::ofstream file(path_);
+        file << "epoch,loss\n0,0.5\n1,0.25\n2,0.125\n";
+    }
+
+    EventLogReader reader;
+    EXPECT_FALSE(reader.open(path_));
+}
+
+TEST_F(EventLogTest, ConvertsRecordsToJson) {
+    EventLog log;
+    ASSERT_TRUE(log.open(path_));
+    log.logRunStart("{\"network\":\"xor\"}");
+
+    EpochEvent epoch;
+    epoch.epoch = 1;
+    epoch.trainLoss = 0.5;
+    epoch.valLoss = std::nan("");
+    log.logEpoch(epoch);
+    log.close();
+
+    EventLogReader reader;
+    ASSERT_TRUE(reader.open(path_));
+    EventRecord record;
+
+    ASSERT_TRUE(reader.next(record));
+    auto json = eventToJson(record, reader.getStartNanos());
+    EXPECT_EQ(json["type"], "run_start");
+    EXPECT_EQ(json["config"]["network"], "xor");
+    EXPECT_GE(json["time"].get<double>(), 0.0);
+
+    ASSERT_TRUE(reader.next(record));
+    json = eventToJson(record, reader.getStartNanos());
+    EXPECT_EQ(json["type"], "epoch");
+    EXPECT_EQ(json["epoch"], 1);
+    EXPECT_DOUBLE_EQ(json["train_loss"].get<double>(), 0.5);
+    EXPECT_TRUE(json["val_loss"].is_null());
+
+    EXPECT_FALSE(reader.next(record));
+}
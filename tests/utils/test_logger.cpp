@@ -0,0 +1,220 @@
+/**
+ * @file test_logger.cpp
+ * @brief Unit tests for asynchronous logging
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "utils/Logger.hpp"
+
+using namespace nnv::utils;
+
+namespace {
+
+/**
+ * @brief Points the logger at a scratch file and restores the test setup afterwards
+ */
+class AsyncLoggerTest : public ::testing::Test {
+protected:
+    std::string logPath_;
+
+    void SetUp() override {
+        logPath_ = (std::filesystem::temp_directory_path() /
+                    ("nnv_test_logger_" + std::to_string(::testing::UnitTest::GetInstance()->random_seed()) + ".log"))
+                       .string();
+        std::remove(logPath_.c_str());
+
+        Logger::shutdown();
+        Logger::initialize(logPath_, LogLevel::Warning);
+    }
+
+    void TearDown() override {
+        Logger::shutdown();
+        std::remove(logPath_.c_str());
+        Logger::initialize("", LogLevel::Warning);
+    }
+
+    std::size_t countLines(const std::string& needle) const {
+        std::ifstream file(logPath_);
+        std::size_t count = 0;
+        std::string line;
+        while (std::getline(file, line)) {
+            if (line.find(needle) != std::string::npos) {
+                ++count;
+            }
+        }
+        return count;
+    }
+};
+
+} // namespace
+
+TEST_F(AsyncLoggerTest, FlushWritesEverythingLoggedBefore) {
+    AsyncLogOptions options;
+    options.overflowPolicy = LogOverflowPolicy::Block;
+    options.flushInterval = std::chrono::milliseconds(10000);
+    Logger::enableAsync(options);
+    ASSERT_TRUE(Logger::isAsync());
+
+    for (int i = 0; i < 100; ++i) {
+        Logger::warning("queued line " + std::to_string(i));
+    }
+    Logger::info("below the level");
+    Logger::flush();
+
+    EXPECT_EQ(countLines("queued line"), 100u);
+    EXPECT_EQ(countLines("below the level"), 0u);
+    EXPECT_EQ(Logger::getDroppedCount(), 0u);
+}
+
+TEST_F(AsyncLoggerTest, BlockPolicyLosesNothingUnderContention) {
+    AsyncLogOptions options;
+    options.queueCapacity = 16;
+    options.overflowPolicy = LogOverflowPolicy::Block;
+    Logger::enableAsync(options);
+
+    constexpr int kThreads = 4;
+    constexpr int kPerThread = 500;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([]() {
+            for (int i = 0; i < kPerThread; ++i) {
+                Logger::warning("blocking line");
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Disabling drains the queue
+    Logger::disableAsync();
+    EXPECT_FALSE(Logger::isAsync());
+    EXPECT_EQ(countLines("blocking line"), static_cast<std::size_t>(kThreads * kPerThread));
+    EXPECT_EQ(Logger::getDroppedCount(), 0u);
+}
+
+TEST_F(AsyncLoggerTest, DropPolicyCountsAndReportsDrops) {
+    AsyncLogOptions options;
+    options.queueCapacity = 4;
+    options.overflowPolicy = LogOverflowPolicy::Drop;
+    Logger::enableAsync(options);
+
+    constexpr std::size_t kMessages = 20000;
+    for (std::size_t i = 0; i < kMessages; ++i) {
+        Logger::warning("dropping line");
+    }
+    Logger::shutdown();
+
+    const std::uint64_t dropped = Logger::getDroppedCount();
+    EXPECT_EQ(countLines("dropping line") + dropped, kMessages);
+    if (dropped > 0) {
+        EXPECT_GE(countLines("dropped"), 1u);
+    }
+}
+
+TEST_F(AsyncLoggerTest, SetLevelAppliesToQueuedLogging) {
+    Logger::enableAsync();
+    Logger::setLevel(LogLevel::Error);
+    Logger::warning("filtered warning");
+    Logger::error("kept error");
+    Logger::flush();
+
+    EXPECT_EQ(countLines("filtered warning"), 0u);
+    EXPECT_EQ(countLines("kept error"), 1u);
+}
+
+TEST_F(AsyncLoggerTest, RuntimeLevelSkipsArgumentEvaluation) {
+    EXPECT_FALSE(Logger::isEnabled(LogLevel::Info));
+    EXPECT_TRUE(Logger::isEnabled(LogLevel::Warning));
+
+    int evaluated = 0;
+    auto argument = [&evaluated]() {
+        ++evaluated;
+        return evaluated;
+    };
+
+    NNV_LOG_AT(LogLevel::Info, "skipped {}", argument());
+    NNV_LOG_DISCARD("compiled out {}", argument());
+    EXPECT_EQ(evaluated, 0);
+
+    NNV_LOG_AT(LogLevel::Warning, "written {}", argument());
+    EXPECT_EQ(evaluated, 1);
+
+    Logger::setLevel(LogLevel::Debug);
+    EXPECT_TRUE(Logger::isEnabled(LogLevel::Debug));
+
+    Logger::shutdown();
+    EXPECT_FALSE(Logger::isEnabled(LogLevel::Critical));
+}
+
+TEST(LogRateLimiterTest, AllowsBurstThenRefills) {
+    LogRateLimiter limiter(1000.0, 3);
+    std::uint64_t suppressed = 0;
+    const std::int64_t start = 1'000'000'000;
+
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_TRUE(limiter.tryAcquireAt(start, suppressed));
+        EXPECT_EQ(suppressed, 0u);
+    }
+    EXPECT_FALSE(limiter.tryAcquireAt(start, suppressed));
+    EXPECT_FALSE(limiter.tryAcquireAt(start + 999'999, suppressed));
+
+    // One token refills per millisecond
+    EXPECT_TRUE(limiter.tryAcquireAt(start + 1'000'000, suppressed));
+    EXPECT_EQ(suppressed, 2u);
+    EXPECT_FALSE(limiter.tryAcquireAt(start + 1'000'000, suppressed));
+
+    // A long pause refills at most the burst
+    const std::int64_t later = start + 1'000'000'000;
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_TRUE(limiter.tryAcquireAt(later, suppressed));
+    }
+    EXPECT_FALSE(limiter.tryAcquireAt(later, suppressed));
+}
+
+TEST(LogEveryNTest, WritesFirstOfEveryN) {
+    LogEveryN site;
+    std::uint64_t suppressed = 0;
+    std::vector<int> written;
+
+    for (int i = 0; i < 10; ++i) {
+        if (site.shouldLog(4, suppressed)) {
+            written.push_back(i);
+            EXPECT_EQ(suppressed, i == 0 ? 0u : 3u);
+        }
+    }
+    EXPECT_EQ(written, (std::vector<int>{0, 4, 8}));
+}
+
+TEST_F(AsyncLoggerTest, RateLimitedMacroReportsSuppressedMessages) {
+    // One token per 1000 s: no refill however slowly the loop runs
+    for (int i = 0; i < 1000; ++i) {
+        NNV_LOG_WARNING_RATE_LIMITED(0.001, 2, "hot path warning {}", i);
+    }
+    EXPECT_EQ(countLines("hot path warning"), 2u);
+
+    for (int i = 0; i < 10; ++i) {
+        NNV_LOG_WARNING_EVERY_N(5, "sampled warning {}", i);
+    }
+    Logger::flush();
+    EXPECT_EQ(countLines("sampled warning"), 2u);
+    EXPECT_EQ(countLines("(suppressed 4 similar messages)"), 1u);
+
+    // Filtered levels do not consume tokens: one call site with a single
+    // token, filtered twice, then enabled. The first enabled call must get
+    // the token and the second must find the budget spent.
+    for (int i = 0; i < 4; ++i) {
+        Logger::setLevel(i < 2 ? LogLevel::Warning : LogLevel::Info);
+        NNV_LOG_RATE_LIMITED(LogLevel::Info, 0.001, 1, "filtered info");
+    }
+    Logger::flush();
+    EXPECT_EQ(countLines("filtered info"), 1u);
+}
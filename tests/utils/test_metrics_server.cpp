@@ -0,0 +1,164 @@
+/**
+ * @file test_metrics_server.cpp
+ * @brief Unit tests for Prometheus metrics and the HTTP endpoint
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <string>
+#include "utils/MetricsServer.hpp"
+
+#ifndef NNV_PLATFORM_WINDOWS
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+using namespace nnv::utils;
+
+namespace {
+
+#ifndef NNV_PLATFORM_WINDOWS
+/**
+ * @brief Send one raw HTTP request to 127.0.0.1 and return the whole response
+ */
+std::string httpRequest(std::uint16_t port, const std::string& request) {
+    const int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(port);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (::connect(fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0) {
+        ::close(fd);
+        return {};
+    }
+
+    ::send(fd, request.data(), request.size(), 0);
+    std::string response;
+    char buffer[4096];
+    ssize_t received = 0;
+    while ((received = ::recv(fd, buffer, sizeof(buffer), 0)) > 0) {
+        response.append(buffer, static_cast<std::size_t>(received));
+    }
+    ::close(fd);
+    return response;
+}
+#endif
+
+} // namespace
+
+TEST(MetricsWriterTest, FormatsCountersAndGauges) {
+    MetricsWriter writer;
+    writer.counter("nnv_requests_total", "Requests served", 3);
+    writer.gauge("nnv_temperature", "Line one\nline two", 0.5, {{"room", "a\"b\\c"}});
+    writer.gauge("nnv_nan", "Not a number", std::nan(""));
+
+    EXPECT_EQ(writer.str(),
+              "# HELP nnv_requests_total Requests served\n"
+              "# TYPE nnv_requests_total counter\n"
+              "nnv_requests_total 3\n"
+              "# HELP nnv_temperature Line one\\nline two\n"
+              "# TYPE nnv_temperature gauge\n"
+              "nnv_temperature{room=\"a\\\"b\\\\c\"} 0.5\n"
+              "# HELP nnv_nan Not a number\n"
+              "# TYPE nnv_nan gauge\n"
+              "nnv_nan NaN\n");
+}
+
+TEST(MetricsWriterTest, GroupsSamplesByFamily) {
+    MetricsWriter writer;
+    writer.gauge("nnv_loss", "Loss", 1.0, {{"model", "a"}});
+    writer.gauge("nnv_other", "Other", 2.0);
+    writer.gauge("nnv_loss", "Loss", 3.0, {{"model", "b"}});
+
+    EXPECT_EQ(writer.str(),
+              "# HELP nnv_loss Loss\n"
+              "# TYPE nnv_loss gauge\n"
+              "nnv_loss{model=\"a\"} 1\n"
+              "nnv_loss{model=\"b\"} 3\n"
+              "# HELP nnv_other Other\n"
+              "# TYPE nnv_other gauge\n"
+              "nnv_other 2\n");
+}
+
+TEST(MetricsWriterTest, HistogramBucketsAreCumulative) {
+    MetricsWriter writer;
+    writer.histogram("nnv_latency_seconds", "Latency", {0.001, 0.01}, {2, 3}, 0.05, 6, {{"op", "x"}});
+
+    EXPECT_EQ(writer.str(),
+              "# HELP nnv_latency_seconds Latency\n"
+              "# TYPE nnv_latency_seconds histogram\n"
+              "nnv_latency_seconds_bucket{op=\"x\",le=\"0.001\"} 2\n"
+              "nnv_latency_seconds_bucket{op=\"x\",le=\"0.01\"} 5\n"
+              "nnv_latency_seconds_bucket{op=\"x\",le=\"+Inf\"} 6\n"
+              "nnv_latency_seconds_sum{op=\"x\"} 0.05\n"
+              "nnv_latency_seconds_count{op=\"x\"} 6\n");
+}
+
+TEST(MetricsWriterTest, SummaryHasQuantileLabels) {
+    MetricsWriter writer;
+    writer.summary("nnv_step_seconds", "Steps", {{0.5, 0.002}, {0.99, 0.004}}, 0.3, 100);
+
+    EXPECT_EQ(writer.str(),
+              "# HELP nnv_step_seconds Steps\n"
+              "# TYPE nnv_step_seconds summary\n"
+              "nnv_step_seconds{quantile=\"0.5\"} 0.002\n"
+              "nnv_step_seconds{quantile=\"0.99\"} 0.004\n"
+              "nnv_step_seconds_sum 0.3\n"
+              "nnv_step_seconds_count 100\n");
+}
+
+TEST(MetricsRegistryTest, AddAndRemoveCollectors) {
+    MetricsRegistry registry;
+    const auto first = registry.add([](MetricsWriter& out) { out.gauge("nnv_first", "First", 1.0); });
+    registry.add([](MetricsWriter& out) { out.gauge("nnv_second", "Second", 2.0); });
+
+    std::string text = registry.collect();
+    EXPECT_NE(text.find("nnv_first 1\n"), std::string::npos);
+    EXPECT_NE(text.find("nnv_second 2\n"), std::string::npos);
+
+    registry.remove(first);
+    text = registry.collect();
+    EXPECT_EQ(text.find("nnv_first"), std::string::npos);
+    EXPECT_NE(text.find("nnv_second 2\n"), std::string::npos);
+}
+
+#ifndef NNV_PLATFORM_WINDOWS
+TEST(MetricsServerTest, ServesMetricsOverHttp) {
+    MetricsServer server;
+    addProcessMetrics(server.getRegistry());
+    server.getRegistry().add([](MetricsWriter& out) { out.counter("nnv_test_total", "Test counter", 42); });
+
+    ASSERT_TRUE(server.start(0));
+    ASSERT_TRUE(server.isRunning());
+    ASSERT_NE(server.getPort(), 0);
+
+    const std::string response = httpRequest(server.getPort(), "GET /metrics HTTP/1.1\r\nHost: localhost\r\n\r\n");
+    EXPECT_EQ(response.rfind("HTTP/1.1 200 OK\r\n", 0), 0u) << response;
+    EXPECT_NE(response.find("Content-Type: text/plain; version=0.0.4"), std::string::npos);
+    EXPECT_NE(response.find("\r\n\r\n# HELP "), std::string::npos);
+    EXPECT_NE(response.find("nnv_test_total 42\n"), std::string::npos);
+    EXPECT_NE(response.find("nnv_tracked_memory_bytes{category="), std::string::npos);
+    EXPECT_EQ(server.getScrapeCount(), 1u);
+
+    const std::string missing = httpRequest(server.getPort(), "GET /other HTTP/1.1\r\n\r\n");
+    EXPECT_EQ(missing.rfind("HTTP/1.1 404", 0), 0u) << missing;
+
+    const std::string head = httpRequest(server.getPort(), "HEAD /metrics HTTP/1.1\r\n\r\n");
+    EXPECT_EQ(head.rfind("HTTP/1.1 200 OK\r\n", 0), 0u);
+    EXPECT_EQ(head.find("nnv_test_total"), std::string::npos);
+
+    server.stop();
+    EXPECT_FALSE(server.isRunning());
+    EXPECT_EQ(server.getPort(), 0);
+}
+
+TEST(MetricsServerTest, RejectsInvalidBindAddress) {
+    MetricsServer server;
+    EXPECT_FALSE(server.start(0, "not an address"));
+    EXPECT_FALSE(server.isRunning());
+}
+#endif
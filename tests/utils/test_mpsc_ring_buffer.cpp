@@ -0,0 +1,85 @@
+/**
+ * @file test_mpsc_ring_buffer.cpp
+ * @brief Unit tests for the MPSC ring buffer
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+#include "utils/MpscRingBuffer.hpp"
+
+using namespace nnv::utils;
+
+TEST(MpscRingBufferTest, CapacityRoundsUpToPowerOfTwo) {
+    MpscRingBuffer<int> ring(5);
+    EXPECT_EQ(ring.capacity(), 8u);
+    EXPECT_EQ(ring.size(), 0u);
+}
+
+TEST(MpscRingBufferTest, FifoOrderAndFullRejectsPush) {
+    MpscRingBuffer<std::string> ring(4);
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(ring.tryPush(std::to_string(i)));
+    }
+
+    // A failed push leaves the element with the caller
+    std::string rejected = "rejected";
+    EXPECT_FALSE(ring.tryPush(std::move(rejected)));
+    EXPECT_EQ(rejected, "rejected");
+    EXPECT_EQ(ring.size(), 4u);
+
+    std::string value;
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(ring.tryPop(value));
+        EXPECT_EQ(value, std::to_string(i));
+    }
+    EXPECT_FALSE(ring.tryPop(value));
+    EXPECT_EQ(ring.totalPushed(), 4u);
+    EXPECT_EQ(ring.totalPopped(), 4u);
+
+    // Wraps around after draining
+    EXPECT_TRUE(ring.tryPush(std::string("7")));
+    ASSERT_TRUE(ring.tryPop(value));
+    EXPECT_EQ(value, "7");
+}
+
+TEST(MpscRingBufferTest, ConcurrentProducersKeepPerProducerOrder) {
+    MpscRingBuffer<std::uint64_t> ring(64);
+    constexpr std::uint64_t kProducers = 4;
+    constexpr std::uint64_t kPerProducer = 25000;
+
+    std::vector<std::thread> producers;
+    for (std::uint64_t p = 0; p < kProducers; ++p) {
+        producers.emplace_back([&ring, p]() {
+            for (std::uint64_t i = 0; i < kPerProducer; ++i) {
+                std::uint64_t value = p * kPerProducer + i;
+                while (!ring.tryPush(std::move(value))) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::vector<std::uint64_t> next(kProducers, 0);
+    std::uint64_t received = 0;
+    std::uint64_t value = 0;
+    while (received < kProducers * kPerProducer) {
+        if (ring.tryPop(value)) {
+            const std::uint64_t producer = value / kPerProducer;
+            ASSERT_LT(producer, kProducers);
+            ASSERT_EQ(value % kPerProducer, next[producer]);
+            ++next[producer];
+            ++received;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    EXPECT_EQ(ring.size(), 0u);
+}
@@ -0,0 +1,71 @@
+/**
+ * @file test_perf_counters.cpp
+ * @brief Unit tests for hardware performance counters
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include "utils/PerfCounters.hpp"
+
+using namespace nnv::utils;
+
+namespace {
+
+HardwareCounterValues makeValues(std::uint64_t cycles, std::uint64_t instructions, std::uint32_t validMask) {
+    HardwareCounterValues values;
+    values.counts[static_cast<std::size_t>(HardwareCounter::Cycles)] = cycles;
+    values.counts[static_cast<std::size_t>(HardwareCounter::Instructions)] = instructions;
+    values.validMask = validMask;
+    return values;
+}
+
+} // namespace
+
+TEST(PerfCountersTest, DeltasAndRatios) {
+    const std::uint32_t cyclesAndInstructions = 0b11;
+    HardwareCounterValues total;
+    EXPECT_TRUE(std::isnan(total.ipc()));
+
+    total.addDelta(makeValues(100, 200, cyclesAndInstructions), makeValues(300, 600, cyclesAndInstructions));
+    total.addDelta(makeValues(300, 600, cyclesAndInstructions), makeValues(500, 1000, cyclesAndInstructions));
+    EXPECT_EQ(total[HardwareCounter::Cycles], 400u);
+    EXPECT_EQ(total[HardwareCounter::Instructions], 800u);
+    EXPECT_DOUBLE_EQ(total.ipc(), 2.0);
+
+    // Events not measured in both readings stay invalid
+    EXPECT_FALSE(total.isValid(HardwareCounter::CacheMisses));
+    EXPECT_TRUE(std::isnan(total.cacheMissRate()));
+    EXPECT_TRUE(std::isnan(total.branchMissRate()));
+}
+
+TEST(PerfCountersTest, OpenSucceedsOrExplainsWhy) {
+    PerfCounterGroup group;
+    HardwareCounterValues start;
+
+    if (!group.open()) {
+        // Containers and VMs often hide the PMU
+        EXPECT_FALSE(group.isOpen());
+        EXPECT_FALSE(group.getError().empty());
+        EXPECT_FALSE(group.read(start));
+        return;
+    }
+
+    ASSERT_TRUE(group.read(start));
+    volatile double sum = 0.0;
+    for (int i = 0; i < 100000; ++i) {
+        sum = sum + static_cast<double>(i);
+    }
+    HardwareCounterValues end;
+    ASSERT_TRUE(group.read(end));
+
+    HardwareCounterValues delta;
+    delta.addDelta(start, end);
+    EXPECT_TRUE(delta.isValid(HardwareCounter::Cycles));
+    EXPECT_GT(delta[HardwareCounter::Cycles], 0u);
+
+    group.close();
+    EXPECT_FALSE(group.isOpen());
+    EXPECT_FALSE(group.read(end));
+}
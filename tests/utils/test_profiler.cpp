@@ -0,0 +1,131 @@
+/**
+ * @file test_profiler.cpp
+ * @brief Unit tests for the scoped profiler and Chrome trace export
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+#include <cstdio>
+#include <fstream>
+#include <thread>
+#include "utils/Profiler.hpp"
+
+using namespace nnv::utils;
+
+class ProfilerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        Profiler::setEnabled(true);
+        Profiler::clear();
+    }
+
+    void TearDown() override {
+        Profiler::clear();
+        std::remove(tracePath.c_str());
+    }
+
+    std::string tracePath = "test_profiler_trace.json";
+};
+
+TEST_F(ProfilerTest, ScopesRecordEvents) {
+    {
+        ProfileScope outer("outer", "test");
+        ProfileScope inner("inner", "test");
+    }
+    EXPECT_EQ(Profiler::getEventCount(), 2u);
+
+    Profiler::setEnabled(false);
+    {
+        ProfileScope ignored("ignored");
+    }
+    EXPECT_EQ(Profiler::getEventCount(), 2u);
+
+    Profiler::clear();
+    EXPECT_EQ(Profiler::getEventCount(), 0u);
+}
+
+TEST_F(ProfilerTest, MacroCompiledOutByDefault) {
+#if !defined(NNV_ENABLE_PROFILING)
+    NNV_PROFILE_SCOPE("compiled out");
+    NNV_PROFILE_FUNCTION();
+    EXPECT_EQ(Profiler::getEventCount(), 0u);
+#else
+    {
+        NNV_PROFILE_SCOPE("compiled in");
+    }
+    EXPECT_EQ(Profiler::getEventCount(), 1u);
+#endif
+}
+
+TEST_F(ProfilerTest, WritesChromeTraceFromAllThreads) {
+    Profiler::record("main work", "test", 1000, 3500);
+
+    std::thread worker([]() {
+        Profiler::setThreadName("worker \"1\"");
+        for (int i = 0; i < 5000; ++i) { // Spans more than one buffer chunk
+            ProfileScope scope("worker step", "test");
+        }
+    });
+    worker.join();
+
+    ASSERT_TRUE(Profiler::writeChromeTrace(tracePath));
+
+    std::ifstream file(tracePath);
+    auto trace = nlohmann::json::parse(file);
+    const auto& events = trace["traceEvents"];
+
+    std::size_t complete = 0;
+    bool sawThreadName = false;
+    bool sawMain = false;
+    for (const auto& event : events) {
+        if (event["ph"] == "X") {
+            ++complete;
+            if (event["name"] == "main work") {
+                sawMain = true;
+                EXPECT_DOUBLE_EQ(event["ts"].get<double>(), 1.0);
+                EXPECT_DOUBLE_EQ(event["dur"].get<double>(), 2.5);
+            }
+        } else if (event["ph"] == "M" && event["args"]["name"] == "worker \"1\"") {
+            sawThreadName = true;
+        }
+    }
+
+    EXPECT_EQ(complete, 5001u);
+    EXPECT_TRUE(sawMain);
+    EXPECT_TRUE(sawThreadName);
+}
+
+TEST_F(ProfilerTest, ClearMakesRoomInAFullThreadBuffer) {
+    std::thread worker([this]() {
+        const std::size_t droppedBefore = Profiler::getDroppedCount();
+        for (std::size_t i = 0; i <= Profiler::kMaxEventsPerThread; ++i) {
+            Profiler::record("fill", "test", i, i + 1);
+        }
+        EXPECT_EQ(Profiler::getEventCount(), Profiler::kMaxEventsPerThread);
+        EXPECT_EQ(Profiler::getDroppedCount(), droppedBefore + 1);
+
+        // The ring wraps into the chunks the cleared events occupied
+        Profiler::clear();
+        for (std::size_t i = 0; i < 5000; ++i) {
+            Profiler::record("after clear", "test", 1000 * i, 1000 * i + 500);
+        }
+        EXPECT_EQ(Profiler::getEventCount(), 5000u);
+        EXPECT_EQ(Profiler::getDroppedCount(), droppedBefore + 1);
+        ASSERT_TRUE(Profiler::writeChromeTrace(tracePath));
+    });
+    worker.join();
+
+    std::ifstream file(tracePath);
+    auto trace = nlohmann::json::parse(file);
+    double expectedTs = 0.0;
+    for (const auto& event : trace["traceEvents"]) {
+        if (event["ph"] == "X") {
+            EXPECT_EQ(event["name"], "after clear");
+            EXPECT_DOUBLE_EQ(event["ts"].get<double>(), expectedTs);
+            expectedTs += 1.0;
+        }
+    }
+    EXPECT_DOUBLE_EQ(expectedTs, 5000.0);
+}
@@ -0,0 +1,66 @@
+/**
+ * @file test_spsc_ring_buffer.cpp
+ * @brief Unit tests for the SPSC ring buffer
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include "utils/SpscRingBuffer.hpp"
+
+using namespace nnv::utils;
+
+TEST(SpscRingBufferTest, CapacityRoundsUpToPowerOfTwo) {
+    SpscRingBuffer<int> ring(5);
+    EXPECT_EQ(ring.capacity(), 8u);
+    EXPECT_EQ(ring.size(), 0u);
+}
+
+TEST(SpscRingBufferTest, FifoOrderAndFullRejectsPush) {
+    SpscRingBuffer<int> ring(4);
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(ring.tryPush(i));
+    }
+    EXPECT_FALSE(ring.tryPush(99));
+    EXPECT_EQ(ring.size(), 4u);
+
+    int value = -1;
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(ring.tryPop(value));
+        EXPECT_EQ(value, i);
+    }
+    EXPECT_FALSE(ring.tryPop(value));
+
+    // Wraps around after draining
+    EXPECT_TRUE(ring.tryPush(7));
+    ASSERT_TRUE(ring.tryPop(value));
+    EXPECT_EQ(value, 7);
+}
+
+TEST(SpscRingBufferTest, ConcurrentProducerAndConsumer) {
+    SpscRingBuffer<std::uint64_t> ring(64);
+    constexpr std::uint64_t kCount = 100000;
+
+    std::thread producer([&ring]() {
+        for (std::uint64_t i = 0; i < kCount; ++i) {
+            while (!ring.tryPush(i)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    std::uint64_t expected = 0;
+    std::uint64_t value = 0;
+    while (expected < kCount) {
+        if (ring.tryPop(value)) {
+            ASSERT_EQ(value, expected);
+            ++expected;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    producer.join();
+    EXPECT_EQ(ring.size(), 0u);
+}
@@ -0,0 +1,64 @@
+/**
+ * @file test_thread_pool.cpp
+ * @brief Unit tests for the thread pool and cancellation tokens
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ */
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include "utils/ThreadPool.hpp"
+
+using namespace nnv::utils;
+
+TEST(ThreadPoolTest, RunsTasksAndReturnsResults) {
+    ThreadPool pool(2);
+    EXPECT_EQ(pool.getThreadCount(), 2u);
+
+    std::vector<std::future<int>> results;
+    for (int i = 0; i < 16; ++i) {
+        results.push_back(pool.submit([i]() { return i * i; }));
+    }
+
+    for (int i = 0; i < 16; ++i) {
+        EXPECT_EQ(results[i].get(), i * i);
+    }
+}
+
+TEST(ThreadPoolTest, PropagatesExceptions) {
+    ThreadPool pool(1);
+    auto result = pool.submit([]() -> int { throw std::runtime_error("failed"); });
+    EXPECT_THROW(result.get(), std::runtime_error);
+}
+
+TEST(ThreadPoolTest, DestructorDrainsQueue) {
+    std::atomic<int> completed{0};
+    {
+        ThreadPool pool(1);
+        for (int i = 0; i < 8; ++i) {
+            pool.submit([&completed]() { ++completed; });
+        }
+    }
+    EXPECT_EQ(completed.load(), 8);
+}
+
+TEST(CancellationTokenTest, CopiesShareStateAndRunCallbacks) {
+    CancellationToken token;
+    CancellationToken copy = token;
+    int calls = 0;
+
+    auto kept = token.onCancel([&calls]() { ++calls; });
+    auto dropped = token.onCancel([&calls]() { calls += 10; });
+    dropped.reset();
+
+    EXPECT_FALSE(copy.isCancelled());
+    copy.cancel();
+    copy.cancel();
+
+    EXPECT_TRUE(token.isCancelled());
+    EXPECT_EQ(calls, 1);
+
+    // Registering after cancellation runs the callback immediately
+    auto late = token.onCancel([&calls]() { ++calls; });
+    EXPECT_EQ(calls, 2);
+}
@@ -0,0 +1,165 @@
+/**
+ * @file nnv_dataset.cpp
+ * @brief Converter from CSV, MNIST and image directories to .nnvd datasets
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ *
+ * Usage:
+ *   nnv_dataset <input> <output.nnvd> [--format csv|mnist|images]
+ *               [--labels FILE] [--dtype u8|f16|f32] [--target-dtype u8|f16|f32]
+ *               [--scale X] [--image-size WxH] [--color] [--no-header]
+ *
+ * The input format is guessed when not given: a directory is read as one
+ * subdirectory of images per class, an .idx3-ubyte file as MNIST images
+ * (with --labels naming the .idx1-ubyte file) and anything else as CSV with
+ * the target in the last column. u8 values are stored as value / scale,
+ * where scale defaults to 1/255 so [0, 1] inputs use the full byte range.
+ *
+ * Exit codes: 0 success, 1 conversion error, 2 usage error.
+ */
+
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "utils/BinaryDataset.hpp"
+#include "utils/DataLoader.hpp"
+#include "utils/Logger.hpp"
+
+namespace {
+
+using T = nnv::core::Scalar;
+using nnv::utils::DatasetElementType;
+
+struct Options {
+    std::string inputPath;
+    std::string outputPath;
+    std::string format;
+    std::string labelsPath;
+    bool hasHeader = true;
+    nnv::utils::BinaryDatasetOptions binary;
+    nnv::utils::PreprocessingConfig preprocessing;
+};
+
+bool parseElementType(const std::string& name, DatasetElementType& type) {
+    if (name == "u8") {
+        type = DatasetElementType::UInt8;
+    } else if (name == "f16") {
+        type = DatasetElementType::Float16;
+    } else if (name == "f32") {
+        type = DatasetElementType::Float32;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+bool parseArguments(int argc, char** argv, Options& options) {
+    std::vector<std::string> positional;
+    try {
+        for (int i = 1; i < argc; ++i) {
+            const std::string arg = argv[i];
+            const bool hasValue = i + 1 < argc;
+
+            if (arg == "--format" && hasValue) {
+                options.format = argv[++i];
+                if (options.format != "csv" && options.format != "mnist" && options.format != "images") {
+                    return false;
+                }
+            } else if (arg == "--labels" && hasValue) {
+                options.labelsPath = argv[++i];
+            } else if (arg == "--dtype" && hasValue) {
+                if (!parseElementType(argv[++i], options.binary.inputType)) {
+                    return false;
+                }
+            } else if (arg == "--target-dtype" && hasValue) {
+                if (!parseElementType(argv[++i], options.binary.targetType)) {
+                    return false;
+                }
+            } else if (arg == "--scale" && hasValue) {
+                options.binary.inputScale = std::stof(argv[++i]);
+                if (!(options.binary.inputScale > 0.0f)) {
+                    return false;
+                }
+            } else if (arg == "--image-size" && hasValue) {
+                const std::string size = argv[++i];
+                const auto separator = size.find('x');
+                if (separator == std::string::npos) {
+                    return false;
+                }
+                options.preprocessing.imageSize = {std::stoi(size.substr(0, separator)),
+                                                   std::stoi(size.substr(separator + 1))};
+            } else if (arg == "--color") {
+                options.preprocessing.grayscale = false;
+            } else if (arg == "--no-header") {
+                options.hasHeader = false;
+            } else if (!arg.empty() && arg[0] == '-') {
+                return false;
+            } else {
+                positional.push_back(arg);
+            }
+        }
+    } catch (const std::exception&) {
+        return false;
+    }
+
+    if (positional.size() != 2) {
+        return false;
+    }
+    options.inputPath = positional[0];
+    options.outputPath = positional[1];
+
+    if (options.format.empty()) {
+        if (std::filesystem::is_directory(options.inputPath)) {
+            options.format = "images";
+        } else if (nnv::utils::DataLoader<T>::detectFormat(options.inputPath) == nnv::utils::DataFormat::MNIST) {
+            options.format = "mnist";
+        } else {
+            options.format = "csv";
+        }
+    }
+    return options.format != "mnist" || !options.labelsPath.empty();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseArguments(argc, argv, options)) {
+        std::cerr << "usage: " << argv[0] << " <input> <output.nnvd> [--format csv|mnist|images]"
+                  << " [--labels FILE] [--dtype u8|f16|f32] [--target-dtype u8|f16|f32]"
+                  << " [--scale X] [--image-size WxH] [--color] [--no-header]\n"
+                  << "  mnist input requires --labels <labels.idx1-ubyte>\n";
+        return 2;
+    }
+
+    nnv::utils::Logger::initialize("", nnv::utils::LogLevel::Error);
+
+    nnv::utils::DataLoader<T> loader;
+    nnv::utils::Dataset<T> dataset;
+    if (options.format == "mnist") {
+        dataset = loader.loadMNIST(options.inputPath, options.labelsPath);
+    } else if (options.format == "images") {
+        dataset = loader.loadImagesFromDirectory(options.inputPath, options.preprocessing);
+    } else {
+        dataset = loader.loadCSV(options.inputPath, options.hasHeader);
+    }
+
+    if (dataset.empty()) {
+        std::cerr << "error: no samples read from " << options.inputPath << " as " << options.format << "\n";
+        return 1;
+    }
+
+    if (!nnv::utils::writeBinaryDataset(dataset, options.outputPath, options.binary)) {
+        std::cerr << "error: failed to write " << options.outputPath << "\n";
+        return 1;
+    }
+
+    std::cout << options.outputPath << ": " << dataset.size() << " samples, "
+              << dataset.inputs.front().size() << " x "
+              << nnv::utils::getDatasetElementTypeName(options.binary.inputType) << " inputs, "
+              << dataset.targets.front().size() << " x "
+              << nnv::utils::getDatasetElementTypeName(options.binary.targetType) << " targets\n";
+    return 0;
+}
@@ -0,0 +1,164 @@
+/**
+ * @file nnv_eventlog.cpp
+ * @brief Converts a binary training event log to JSON Lines or CSV
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ *
+ * Usage:
+ *   nnv_eventlog <run.nnvlog> [--format json|csv] [--type step|epoch|...] [--output file]
+ *
+ * JSON output has one object per record. CSV output has one row per record
+ * and the union of all record fields as columns, so filter with --type to
+ * get a dense table (e.g. --type epoch for learning curves). Times are
+ * seconds since the log was opened; non-finite values are empty/null.
+ *
+ * Exit codes: 0 success, 1 log ends with a torn record, 2 usage or input error.
+ */
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "utils/EventLog.hpp"
+
+namespace {
+
+using json = nlohmann::json;
+
+struct Options {
+    std::string inputPath;
+    std::string outputPath;
+    std::string format = "json";
+    std::string type;
+};
+
+bool parseArguments(int argc, char** argv, Options& options) {
+    std::vector<std::string> positional;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+
+        if (arg == "--format" && hasValue) {
+            options.format = argv[++i];
+            if (options.format != "json" && options.format != "csv") {
+                return false;
+            }
+        } else if (arg == "--type" && hasValue) {
+            options.type = argv[++i];
+        } else if (arg == "--output" && hasValue) {
+            options.outputPath = argv[++i];
+        } else if (!arg.empty() && arg[0] == '-') {
+            return false;
+        } else {
+            positional.push_back(arg);
+        }
+    }
+
+    if (positional.size() != 1) {
+        return false;
+    }
+    options.inputPath = positional[0];
+    return true;
+}
+
+std::string csvField(const json& value) {
+    if (value.is_null()) {
+        return "";
+    }
+
+    std::string text = value.is_string() ? value.get<std::string>() : value.dump();
+    if (text.find_first_of(",\"\n\r") == std::string::npos) {
+        return text;
+    }
+
+    std::string quoted = "\"";
+    for (char c : text) {
+        if (c == '"') {
+            quoted += '"';
+        }
+        quoted += c;
+    }
+    quoted += '"';
+    return quoted;
+}
+
+void writeCsv(std::ostream& out, const std::vector<json>& records) {
+    // Columns in order of first appearance
+    std::vector<std::string> columns;
+    for (const auto& record : records) {
+        for (const auto& item : record.items()) {
+            if (std::find(columns.begin(), columns.end(), item.key()) == columns.end()) {
+                columns.push_back(item.key());
+            }
+        }
+    }
+
+    for (std::size_t i = 0; i < columns.size(); ++i) {
+        out << (i > 0 ? "," : "") << columns[i];
+    }
+    out << "\n";
+
+    for (const auto& record : records) {
+        for (std::size_t i = 0; i < columns.size(); ++i) {
+            const auto it = record.find(columns[i]);
+            out << (i > 0 ? "," : "") << (it != record.end() ? csvField(*it) : "");
+        }
+        out << "\n";
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseArguments(argc, argv, options)) {
+        std::cerr << "usage: " << argv[0] << " <run.nnvlog> [--format json|csv]"
+                  << " [--type step|epoch|checkpoint|timing|message|run_start|run_end] [--output file]\n";
+        return 2;
+    }
+
+    nnv::utils::EventLogReader reader;
+    if (!reader.open(options.inputPath)) {
+        std::cerr << "error: " << options.inputPath << " is not a readable event log\n";
+        return 2;
+    }
+
+    std::ofstream file;
+    if (!options.outputPath.empty()) {
+        file.open(options.outputPath);
+        if (!file.is_open()) {
+            std::cerr << "error: cannot write " << options.outputPath << "\n";
+            return 2;
+        }
+    }
+    std::ostream& out = options.outputPath.empty() ? std::cout : file;
+
+    std::vector<json> records;
+    nnv::utils::EventRecord record;
+    while (reader.next(record)) {
+        if (!options.type.empty() && options.type != nnv::utils::getEventTypeName(record.type)) {
+            continue;
+        }
+
+        auto object = nnv::utils::eventToJson(record, reader.getStartNanos());
+        if (options.format == "json") {
+            out << object.dump() << "\n";
+        } else {
+            records.push_back(std::move(object));
+        }
+    }
+
+    if (options.format == "csv") {
+        writeCsv(out, records);
+    }
+
+    if (reader.isTruncated()) {
+        std::cerr << "warning: " << options.inputPath << " ends with an incomplete record\n";
+        return 1;
+    }
+    return 0;
+}
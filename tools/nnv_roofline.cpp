@@ -0,0 +1,209 @@
+/**
+ * @file nnv_roofline.cpp
+ * @brief Per-layer roofline report: analytic cost vs measured training time
+ * @author Neural Network Visualizer Team
+ * @version 1.0.0
+ *
+ * Usage:
+ *   nnv_roofline <network_config.json> [--batch-size N] [--steps N]
+ *                [--peak-gflops X] [--peak-gbps Y] [--format text|json]
+ *
+ * Builds the network from a config (e.g. examples/configs), trains it on
+ * random data for a number of timed steps, measures machine peaks with the
+ * built-in probes (unless both peaks are given) and prints achieved GFLOP/s
+ * and GB/s per layer and phase against the roofline. The compute roof is the
+ * widest vector FMA the CPU supports, not what the layers were compiled to;
+ * the report header names its source.
+ *
+ * Exit codes: 0 success, 2 usage or input error.
+ */
+
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "core/CostModel.hpp"
+#include "core/NeuralNetwork.hpp"
+#include "utils/ConfigManager.hpp"
+#include "utils/Logger.hpp"
+#include "utils/MachinePeaks.hpp"
+
+namespace {
+
+using json = nlohmann::json;
+using T = nnv::core::Scalar;
+
+struct Options {
+    std::string configPath;
+    std::size_t batchSize = 0;
+    std::size_t steps = 50;
+    double peakGflops = 0.0;
+    double peakGbps = 0.0;
+    std::string format = "text";
+};
+
+bool parseArguments(int argc, char** argv, Options& options) {
+    std::vector<std::string> positional;
+    try {
+        for (int i = 1; i < argc; ++i) {
+            const std::string arg = argv[i];
+            const bool hasValue = i + 1 < argc;
+
+            if (arg == "--batch-size" && hasValue) {
+                options.batchSize = std::stoul(argv[++i]);
+            } else if (arg == "--steps" && hasValue) {
+                options.steps = std::stoul(argv[++i]);
+            } else if (arg == "--peak-gflops" && hasValue) {
+                options.peakGflops = std::stod(argv[++i]);
+            } else if (arg == "--peak-gbps" && hasValue) {
+                options.peakGbps = std::stod(argv[++i]);
+            } else if (arg == "--format" && hasValue) {
+                options.format = argv[++i];
+                if (options.format != "text" && options.format != "json") {
+                    return false;
+                }
+            } else if (!arg.empty() && arg[0] == '-') {
+                return false;
+            } else {
+                positional.push_back(arg);
+            }
+        }
+    } catch (const std::exception&) {
+        return false;
+    }
+
+    if (positional.size() != 1 || options.steps == 0) {
+        return false;
+    }
+    options.configPath = positional[0];
+    return true;
+}
+
+std::vector<std::vector<T>> randomBatch(std::size_t rows, std::size_t cols, std::mt19937& gen) {
+    std::uniform_real_distribution<T> dist(T{0}, T{1});
+    std::vector<std::vector<T>> batch(rows, std::vector<T>(cols));
+    for (auto& row : batch) {
+        for (auto& value : row) {
+            value = dist(gen);
+        }
+    }
+    return batch;
+}
+
+std::vector<std::vector<T>> oneHotBatch(std::size_t rows, std::size_t classes, std::mt19937& gen) {
+    std::uniform_int_distribution<std::size_t> dist(0, classes - 1);
+    std::vector<std::vector<T>> batch(rows, std::vector<T>(classes, T{0}));
+    for (auto& row : batch) {
+        row[dist(gen)] = T{1};
+    }
+    return batch;
+}
+
+json toJson(const nnv::core::CostModel& model, const std::vector<nnv::core::RooflinePoint>& points,
+            const nnv::utils::MachinePeaks& peaks) {
+    json report;
+    report["batch_size"] = model.batchSize;
+    report["peak_gflops"] = peaks.gflops;
+    report["compute_roof"] = peaks.computeRoof;
+    report["peak_gbps"] = peaks.gbps;
+    report["parameter_bytes"] = model.parameterBytes();
+    report["activation_bytes"] = model.activationBytes();
+
+    report["points"] = json::array();
+    for (const auto& point : points) {
+        const auto& layer = model.layers[point.layer];
+        const auto& cost = layer.phase(point.phase);
+        report["points"].push_back({
+            {"layer", point.layer},
+            {"phase", nnv::core::getTrainingPhaseName(point.phase)},
+            {"inputs", layer.inputSize},
+            {"outputs", layer.outputSize},
+            {"flops_per_step", cost.flops},
+            {"bytes_per_step", cost.bytes},
+            {"seconds", point.seconds},
+            {"intensity", point.intensity},
+            {"gflops", point.gflops},
+            {"gbps", point.gbps},
+            {"attainable_gflops", point.attainableGflops},
+            {"efficiency", point.efficiency},
+            {"bound", nnv::core::getRooflineBoundName(point.bound)}
+        });
+    }
+    return report;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseArguments(argc, argv, options)) {
+        std::cerr << "usage: " << argv[0] << " <network_config.json> [--batch-size N] [--steps N]"
+                  << " [--peak-gflops X] [--peak-gbps Y] [--format text|json]\n";
+        return 2;
+    }
+
+    nnv::utils::Logger::initialize("", nnv::utils::LogLevel::Error);
+
+    std::ifstream file(options.configPath);
+    const json config = json::parse(file, nullptr, false);
+    if (!file.is_open() || config.is_discarded() || !config.is_object()) {
+        std::cerr << "error: " << options.configPath << " is not a readable network config\n";
+        return 2;
+    }
+    if (options.batchSize == 0) {
+        options.batchSize = config.contains("training") ? config["training"].value("batch_size", std::size_t{32}) : 32;
+    }
+
+    nnv::utils::ConfigManager configManager;
+    nnv::core::NeuralNetwork<T> network(configManager.loadNetworkConfig(config));
+    if (network.getLayerCount() < 2) {
+        std::cerr << "error: " << options.configPath << " needs at least two layers\n";
+        return 2;
+    }
+    network.initializeWeights();
+
+    std::mt19937 gen(42);
+    const auto inputs = randomBatch(options.batchSize, network.getLayer(0).getSize(), gen);
+    const auto targets = oneHotBatch(options.batchSize, network.getLayer(network.getLayerCount() - 1).getSize(), gen);
+
+    // One untimed step so buffers are sized and caches warm
+    network.trainBatch(inputs, targets);
+    network.enablePerfStats();
+    for (std::size_t step = 0; step < options.steps; ++step) {
+        network.trainBatch(inputs, targets);
+    }
+    const auto stats = network.getPerfStats();
+
+    nnv::utils::MachinePeaks peaks;
+    if (options.peakGflops > 0.0 && options.peakGbps > 0.0) {
+        peaks.gflops = options.peakGflops;
+        peaks.gbps = options.peakGbps;
+        peaks.computeRoof = "--peak-gflops";
+    } else {
+        peaks = nnv::utils::measureMachinePeaks();
+        if (options.peakGflops > 0.0) {
+            peaks.gflops = options.peakGflops;
+            peaks.computeRoof = "--peak-gflops";
+        }
+        if (options.peakGbps > 0.0) {
+            peaks.gbps = options.peakGbps;
+        }
+    }
+
+    const auto model = network.costModel(options.batchSize);
+    const auto points = nnv::core::computeRoofline(model, stats, peaks);
+
+    if (options.format == "json") {
+        std::cout << toJson(model, points, peaks).dump(2) << "\n";
+    } else {
+        std::cout << network.getName() << ": batch " << model.batchSize << ", "
+                  << model.parameterBytes() << " parameter bytes, "
+                  << model.activationBytes() << " activation bytes per batch\n"
+                  << nnv::core::formatRoofline(points, peaks);
+    }
+    return 0;
+}